@@ -40,11 +40,12 @@ extern "C" {
      @enum         AsynchronousIO_FileModes
      @constant     FileMode_Unspecified                 Invalid mode
      @constant     FileMode_Read                        Read the data in a file
-     @constant     FileMode_Write                       Delete the contents of the file and write new data
+     @constant     FileMode_Write                       Delete the contents of the file and write new data; with FileMode_Read the contents are kept unless FileMode_Create is also given
      @constant     FileMode_Create                      Create the file if it doesn't exist
      @constant     FileMode_Append                      Add new data at the end of old data without overwriting it
      @constant     FileMode_Text                        Processes newlines and other text specific stuff
      @constant     FileMode_Binary                      Raw access as opposed to FileMode_Text
+     @constant     FileMode_Direct                      Bypass the page cache (O_DIRECT); transfers that aren't aligned to AsynchronousIOStream_GetAlignment go through a bounce buffer
      */
     typedef enum AsynchronousIO_FileModes : uint8_t {
                    FileMode_Unspecified                 = 0,
@@ -54,6 +55,7 @@ extern "C" {
                    FileMode_Append                      = 8,
                    FileMode_Text                        = 16,
                    FileMode_Binary                      = 32,
+                   FileMode_Direct                      = 64,
     } AsynchronousIO_FileModes;
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX && PlatformIO_LanguageVersionCXX >= PlatformIO_LanguageVersionCXX11)
     extern "C++" {
@@ -91,6 +93,40 @@ extern "C" {
                   SeekType_End                          = 2,
     } AsynchronousIO_SeekTypes;
 
+    /*!
+     @enum        AsynchronousIO_AccessPatterns
+     @abstract                                          Hints to the OS about how data will be accessed.
+     @constant    AccessPattern_Unspecified             Invalid AccessPattern.
+     @constant    AccessPattern_Normal                  No particular order, the OS default.
+     @constant    AccessPattern_Sequential              Read from start to end; read ahead aggressively, pages behind the reader can go.
+     @constant    AccessPattern_Random                  Read in no particular order; don't read ahead.
+     @constant    AccessPattern_WillNeed                The range is needed soon; start loading it now.
+     @constant    AccessPattern_DontNeed                The range won't be needed again; it can be dropped from memory.
+     */
+    typedef enum AsynchronousIO_AccessPatterns : uint8_t {
+                  AccessPattern_Unspecified             = 0,
+                  AccessPattern_Normal                  = 1,
+                  AccessPattern_Sequential              = 2,
+                  AccessPattern_Random                  = 3,
+                  AccessPattern_WillNeed                = 4,
+                  AccessPattern_DontNeed                = 5,
+    } AsynchronousIO_AccessPatterns;
+
+    /*!
+     @enum        AsynchronousIO_Backends
+     @abstract                                          The engine an AsynchronousIOStream's transfers go through, chosen on its first transfer.
+     @constant    Backend_Unspecified                   Not chosen yet.
+     @constant    Backend_IOURing                       Linux io_uring; the descriptor is a registered fixed file, and buffers can be registered too.
+     @constant    Backend_POSIXAIO                      POSIX aio_read/aio_write, when io_uring isn't available.
+     @constant    Backend_Windows                       Windows CRT reads and writes.
+     */
+    typedef enum AsynchronousIO_Backends : uint8_t {
+                  Backend_Unspecified                   = 0,
+                  Backend_IOURing                       = 1,
+                  Backend_POSIXAIO                      = 2,
+                  Backend_Windows                       = 3,
+    } AsynchronousIO_Backends;
+
     /*!
      @enum        AsynchronousIO_PathTypes
      @constant    PathType_Unspecified                  Invalid PathType.
@@ -127,6 +163,60 @@ extern "C" {
      */
     typedef             int                             AsynchronousIO_Descriptor;
 
+    /*!
+     @enum        AsynchronousIO_VectorFlags
+     @abstract                                          Per-call flags for vectored reads and writes, the RWF_ flags of preadv2/pwritev2; ignored where they aren't supported.
+     @constant    VectorFlag_Unspecified                No flags.
+     @constant    VectorFlag_HighPriority               Poll for completion instead of sleeping, for low latency devices opened for direct IO.
+     @constant    VectorFlag_DataSync                   Write the data through to the device before returning, like O_DSYNC for this call alone.
+     @constant    VectorFlag_Sync                       Write the data and metadata through to the device before returning, like O_SYNC for this call alone.
+     @constant    VectorFlag_NoWait                     Fail instead of blocking when the data isn't already in the page cache.
+     */
+    typedef enum AsynchronousIO_VectorFlags : uint8_t {
+                  VectorFlag_Unspecified                = 0,
+                  VectorFlag_HighPriority               = 1,
+                  VectorFlag_DataSync                   = 2,
+                  VectorFlag_Sync                       = 4,
+                  VectorFlag_NoWait                     = 8,
+    } AsynchronousIO_VectorFlags;
+
+    /*!
+     @typedef           AsynchronousIO_Vector
+     @abstract                                          One buffer in a scatter/gather list.
+     @constant          Array                           The buffer.
+     @constant          NumBytes                        The size of the buffer in bytes.
+     */
+    typedef struct AsynchronousIO_Vector {
+        void                                           *Array;
+        size_t                                          NumBytes;
+    } AsynchronousIO_Vector;
+
+    /*!
+     @enum        AsynchronousIO_RequestTypes
+     @constant    RequestType_Unspecified               Invalid RequestType.
+     @constant    RequestType_Read                      Read from the stream into the request's Array.
+     @constant    RequestType_Write                     Write the request's Array to the stream.
+     */
+    typedef enum AsynchronousIO_RequestTypes : uint8_t {
+                  RequestType_Unspecified               = 0,
+                  RequestType_Read                      = 1,
+                  RequestType_Write                     = 2,
+    } AsynchronousIO_RequestTypes;
+
+    /*!
+     @typedef           AsynchronousIO_Request
+     @abstract                                          One read or write at an explicit offset, submitted now and reaped later.
+     */
+    typedef struct      AsynchronousIO_Request                 AsynchronousIO_Request;
+
+    /*!
+     @typedef           AsynchronousIO_CompletionFunction
+     @abstract                                          Called once when a request completes, on the thread that polled or waited for it.
+     @param             Request                         The request that completed, AsynchronousIO_Request_GetResult has its result.
+     @param             Context                         The pointer given to AsynchronousIO_Request_SetCallback.
+     */
+    typedef             void                           (*AsynchronousIO_CompletionFunction)(AsynchronousIO_Request *Request, void *Context);
+
     AsynchronousIOStream      *AsynchronousIOStream_Init(void);
 
     /*!
@@ -144,8 +234,9 @@ extern "C" {
 
     /*!
      @abstract                                          Gets the size of the AsynchronousIOStream file.
+     @remark                                            The size is read with fstat when the stream is opened, and grows with Write.
      @param             Stream                          AsynchronousIOStream Pointer.
-     @return                                            Returns the value in BitI->FileSize if it exists.
+     @return                                            Returns the size in bytes.
      */
     size_t              AsynchronousIOStream_GetSize(AsynchronousIOStream *Stream);
 
@@ -156,6 +247,13 @@ extern "C" {
      */
     size_t              AsynchronousIOStream_GetPosition(AsynchronousIOStream *Stream);
 
+    /*!
+     @abstract                                          Sets the position of the AsynchronousIOStream file from the start.
+     @param             Stream                          AsynchronousIOStream Pointer.
+     @param             Position                        The position in bytes from the beginning.
+     */
+    void                AsynchronousIOStream_SetPosition(AsynchronousIOStream *Stream, size_t Position);
+
     /*!
      @abstract                                          Gets the number of bytes remaining
      @remark                                            This only makes sense on read streams
@@ -163,6 +261,92 @@ extern "C" {
      @return                                            Returns the number of bytes remaining
      */
     size_t              AsynchronousIOStream_GetBytesRemaining(AsynchronousIOStream *Stream);
+
+    /*!
+     @abstract                                          Gets the engine Stream's transfers go through, choosing it if there hasn't been a transfer yet.
+     @remark                                            io_uring is used when the kernel has it, otherwise POSIX AIO.
+     @remark                                            A stream whose ring io_uring_enter keeps refusing falls back to POSIX AIO for good, until it's reopened.
+     @param             Stream                          AsynchronousIOStream Pointer.
+     @return                                            Returns the backend.
+     */
+    AsynchronousIO_Backends AsynchronousIOStream_GetBackend(AsynchronousIOStream *Stream);
+
+    /*!
+     @abstract                                          Gets the alignment FileMode_Direct needs for buffers, offsets, and sizes; the device's logical block size.
+     @remark                                            Transfers that meet it go straight to the device, Read and Write bounce the rest through an aligned buffer.
+     @param             Stream                          AsynchronousIOStream Pointer.
+     @return                                            Returns the alignment in bytes, or 0 if Stream wasn't opened with FileMode_Direct.
+     */
+    size_t              AsynchronousIOStream_GetAlignment(AsynchronousIOStream *Stream);
+
+    /*!
+     @abstract                                          Allocates a buffer that direct IO can use as is, free it with AsynchronousIOStream_FreeAligned.
+     @param             Stream                          AsynchronousIOStream Pointer.
+     @param             NumBytes                        The size of the buffer in bytes, rounded up to a multiple of the alignment.
+     @return                                            Returns the buffer, aligned to the stream's alignment or the cache line size, whichever is bigger.
+     */
+    void               *AsynchronousIOStream_AllocateAligned(AsynchronousIOStream *Stream, size_t NumBytes);
+
+    /*!
+     @abstract                                          Frees a buffer from AsynchronousIOStream_AllocateAligned.
+     @param             Buffer                          The buffer to free.
+     */
+    void                AsynchronousIOStream_FreeAligned(void *Buffer);
+
+    /*!
+     @abstract                                          Tells the OS how a range of Stream will be read.
+     @remark                                            Normal, Sequential, and Random also steer the stream's own readahead: Random turns it off, Sequential starts it at its largest window.
+     @param             Stream                          AsynchronousIOStream Pointer.
+     @param             AccessPattern                   How the range will be read.
+     @param             Offset                          Where the range starts, in bytes.
+     @param             NumBytes                        The size of the range in bytes, 0 runs to the end of the file.
+     @return                                            Returns true if the OS accepted the advice.
+     */
+    bool                AsynchronousIOStream_Advise(AsynchronousIOStream *Stream, AsynchronousIO_AccessPatterns AccessPattern, size_t Offset, size_t NumBytes);
+
+    /*!
+     @abstract                                          Gives Stream a write-behind buffer that coalesces small Writes into whole blocks.
+     @remark                                            The buffer belongs to whoever calls Write, like the position does; ReadAt and requests don't see what it's holding until it's flushed.
+     @param             Stream                          AsynchronousIOStream Pointer.
+     @param             BufferSize                      The size of the buffer in bytes, rounded up to a whole block; 0 flushes and removes the buffer.
+     @param             FlushInterval                   Milliseconds data can wait in the buffer before the next Write flushes it, 0 flushes on size alone.
+     */
+    void                AsynchronousIOStream_SetWriteBehind(AsynchronousIOStream *Stream, size_t BufferSize, uint32_t FlushInterval);
+
+    /*!
+     @abstract                                          Writes out whatever the write-behind buffer is holding.
+     @remark                                            Anything that couldn't be written stays in the buffer for the next Flush or Sync to retry.
+     @param             Stream                          AsynchronousIOStream Pointer.
+     @return                                            Returns true if everything was written.
+     */
+    bool                AsynchronousIOStream_Flush(AsynchronousIOStream *Stream);
+
+    /*!
+     @abstract                                          Durability barrier: flushes, then waits until everything written to Stream so far is on stable storage.
+     @remark                                            Safe to call from many threads at once; callers that overlap share a single fdatasync (group commit).
+     @param             Stream                          AsynchronousIOStream Pointer.
+     @return                                            Returns true if the data is durable.
+     */
+    bool                AsynchronousIOStream_Sync(AsynchronousIOStream *Stream);
+
+    /*!
+     @abstract                                          Sets how many requests Stream's io_uring can have queued at once, the default is 64.
+     @remark                                            The ring is recreated on the next transfer, so registered buffers have to be registered again.
+     @param             Stream                          AsynchronousIOStream Pointer.
+     @param             QueueDepth                      The number of submission queue entries, the kernel rounds it up to a power of two.
+     */
+    void                AsynchronousIOStream_SetQueueDepth(AsynchronousIOStream *Stream, uint32_t QueueDepth);
+
+    /*!
+     @abstract                                          Registers buffers with Stream's io_uring, transfers that land entirely inside one skip pinning its pages each time.
+     @remark                                            Replaces the buffers registered before; NumBuffers = 0 unregisters them.
+     @param             Stream                          AsynchronousIOStream Pointer.
+     @param             Buffers                         The buffers to register.
+     @param             BufferSizes                     The size of each buffer in bytes.
+     @param             NumBuffers                      The number of buffers.
+     @return                                            Returns true if the buffers were registered, false when the backend isn't io_uring or the kernel refused.
+     */
+    bool                AsynchronousIOStream_RegisterBuffers(AsynchronousIOStream *Stream, void *const *Buffers, const size_t *BufferSizes, uint16_t NumBuffers);
     /* AsynchronousIOStream */
     
     /* BitBuffer */
@@ -189,7 +373,7 @@ extern "C" {
      @param             Array                           A pointer to the Array to write the data to
      @param             ElementSize                     The size in bytes of the Array elements, aka the Array's underlying type
      @param             NumElements                     The number of ElementSize elements to read
-     @return                                            Returns the number of bytes actually read
+     @return                                            Returns the number of elements actually read, blocking until they've arrived or the stream ended
      */
     size_t              AsynchronousIOStream_Read(AsynchronousIOStream *Stream, void *Array, uint8_t ElementSize, size_t NumElements);
     
@@ -200,17 +384,146 @@ extern "C" {
      @param             Array                           A pointer to the Array to write the data from
      @param             ElementSize                     The size in bytes of the Array elements, aka the Array's underlying type
      @param             NumElements                     The number of ElementSize elements to write
-     @return                                            Returns the number of bytes actually written
+     @return                                            Returns the number of elements actually written
      */
     size_t              AsynchronousIOStream_Write(AsynchronousIOStream *Stream, void *Array, uint8_t ElementSize, size_t NumElements);
+
+    /*!
+     @abstract                                          Reads from an explicit offset, without using or moving the stream's position.
+     @remark                                            Touches nothing shared in Stream, so many threads can read one open stream at once.
+     @param             Stream                          The AsynchronousIOStream to read from
+     @param             Array                           A pointer to the Array to write the data to
+     @param             ElementSize                     The size in bytes of the Array elements, aka the Array's underlying type
+     @param             NumElements                     The number of ElementSize elements to read
+     @param             Offset                          Where to start reading, in bytes from the beginning
+     @return                                            Returns the number of elements actually read
+     */
+    size_t              AsynchronousIOStream_ReadAt(AsynchronousIOStream *Stream, void *Array, uint8_t ElementSize, size_t NumElements, size_t Offset);
+
+    /*!
+     @abstract                                          Writes at an explicit offset, without using or moving the stream's position.
+     @remark                                            Safe from many threads at once as long as the ranges don't overlap; doesn't update the size cached by GetSize.
+     @param             Stream                          The AsynchronousIOStream to write to
+     @param             Array                           A pointer to the Array to write the data from
+     @param             ElementSize                     The size in bytes of the Array elements, aka the Array's underlying type
+     @param             NumElements                     The number of ElementSize elements to write
+     @param             Offset                          Where to start writing, in bytes from the beginning
+     @return                                            Returns the number of elements actually written
+     */
+    size_t              AsynchronousIOStream_WriteAt(AsynchronousIOStream *Stream, void *Array, uint8_t ElementSize, size_t NumElements, size_t Offset);
+
+    /*!
+     @abstract                                          Reads into each of Vectors in turn with as few system calls as possible, starting at the stream's position.
+     @remark                                            On FileMode_Direct streams, vectors that aren't aligned are read one at a time through a bounce buffer.
+     @param             Stream                          The AsynchronousIOStream to read from.
+     @param             Vectors                         The buffers to scatter into, filled in order.
+     @param             NumVectors                      The number of Vectors.
+     @param             Flags                           VectorFlags for the reads.
+     @return                                            Returns the number of bytes actually read, the position is advanced by as much.
+     */
+    size_t              AsynchronousIOStream_ReadVectors(AsynchronousIOStream *Stream, const AsynchronousIO_Vector *Vectors, size_t NumVectors, AsynchronousIO_VectorFlags Flags);
+
+    /*!
+     @abstract                                          Writes each of Vectors in turn with as few system calls as possible, starting at the stream's position.
+     @remark                                            On FileMode_Direct streams, vectors that aren't aligned are written one at a time through a bounce buffer.
+     @param             Stream                          The AsynchronousIOStream to write to.
+     @param             Vectors                         The buffers to gather from, written in order.
+     @param             NumVectors                      The number of Vectors.
+     @param             Flags                           VectorFlags for the writes.
+     @return                                            Returns the number of bytes actually written, the position is advanced by as much.
+     */
+    size_t              AsynchronousIOStream_WriteVectors(AsynchronousIOStream *Stream, const AsynchronousIO_Vector *Vectors, size_t NumVectors, AsynchronousIO_VectorFlags Flags);
     
     /*!
-     @abstract                                          Closes the Descriptor, after flushing any unwritten data
+     @abstract                                          Closes the Descriptor, after flushing any unwritten data, and frees Stream
      @param             Stream                          The Stream to close
      @return                                            Returns true if the Descriptor was sucessfully (flushed, if necessary) and closed
      */
     bool                AsynchronousIOStream_Deinit(AsynchronousIOStream *Stream);
-    
+    /* BitBuffer */
+
+    /* AsynchronousIO_Request */
+    /*!
+     @abstract                                          Creates a request; it isn't started until it's given to AsynchronousIO_Submit.
+     @remark                                            Requests don't move the stream's position, and can be submitted again once they've completed.
+     @param             Stream                          The stream to transfer with.
+     @param             Type                            Read or Write.
+     @param             Array                           The buffer to read into or write from, it has to stay valid until the request completes.
+     @param             NumBytes                        The number of bytes to transfer.
+     @param             Offset                          Where in the stream to transfer, in bytes from the beginning.
+     @return                                            Returns the request.
+     */
+    AsynchronousIO_Request *AsynchronousIO_Request_Init(AsynchronousIOStream *Stream, AsynchronousIO_RequestTypes Type, void *Array, size_t NumBytes, size_t Offset);
+
+    /*!
+     @abstract                                          Sets the function to call when Request completes.
+     @param             Request                         The request to set the callback of.
+     @param             Callback                        The function to call, or NULL for none.
+     @param             Context                         Passed to Callback as is.
+     */
+    void                AsynchronousIO_Request_SetCallback(AsynchronousIO_Request *Request, AsynchronousIO_CompletionFunction Callback, void *Context);
+
+    /*!
+     @abstract                                          Has Request completed? Doesn't reap completions, call AsynchronousIO_Poll for that.
+     @param             Request                         The request to check.
+     */
+    bool                AsynchronousIO_Request_IsComplete(AsynchronousIO_Request *Request);
+
+    /*!
+     @abstract                                          Gets the result of a completed request.
+     @param             Request                         The request to get the result of.
+     @return                                            Returns the number of bytes transferred, or a negative errno if it failed.
+     */
+    int64_t             AsynchronousIO_Request_GetResult(AsynchronousIO_Request *Request);
+
+    /*!
+     @abstract                                          Gets the buffer Request transfers to or from.
+     @param             Request                         The request to get the buffer of.
+     */
+    void               *AsynchronousIO_Request_GetArray(AsynchronousIO_Request *Request);
+
+    /*!
+     @abstract                                          Frees Request, which has to be complete or never submitted.
+     @param             Request                         The request to free.
+     */
+    void                AsynchronousIO_Request_Deinit(AsynchronousIO_Request *Request);
+
+    /*!
+     @abstract                                          Starts a batch of requests, with one system call per stream when the backend is io_uring.
+     @remark                                            On FileMode_Direct streams, requests whose Array, size, or offset aren't aligned are carried out before Submit returns.
+     @remark                                            Requests the kernel refuses are complete when Submit returns, with -errno as their result.
+     @remark                                            When the system's AIO queue is full, Submit waits for earlier requests in the batch to finish, and their callbacks can run before it returns.
+     @param             Requests                        The requests to start.
+     @param             NumRequests                     The number of requests.
+     @return                                            Returns true if every request was started.
+     */
+    bool                AsynchronousIO_Submit(AsynchronousIO_Request **Requests, size_t NumRequests);
+
+    /*!
+     @abstract                                          Reaps whatever has completed without blocking, calling the callbacks of requests that just completed.
+     @param             Requests                        The requests to check.
+     @param             NumRequests                     The number of requests.
+     @return                                            Returns the number of Requests that are complete.
+     */
+    size_t              AsynchronousIO_Poll(AsynchronousIO_Request **Requests, size_t NumRequests);
+
+    /*!
+     @abstract                                          Blocks until at least one of Requests is complete.
+     @param             Requests                        The requests to wait on, all of them have to have been submitted.
+     @param             NumRequests                     The number of requests.
+     @return                                            Returns the index of the first complete request.
+     */
+    size_t              AsynchronousIO_WaitAny(AsynchronousIO_Request **Requests, size_t NumRequests);
+
+    /*!
+     @abstract                                          Blocks until every one of Requests is complete.
+     @param             Requests                        The requests to wait on, all of them have to have been submitted.
+     @param             NumRequests                     The number of requests.
+     @return                                            Returns true if every request transferred all of its bytes.
+     */
+    bool                AsynchronousIO_WaitAll(AsynchronousIO_Request **Requests, size_t NumRequests);
+    /* AsynchronousIO_Request */
+
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
 }
 #endif /* Extern C */
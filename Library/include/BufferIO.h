@@ -14,6 +14,7 @@
 
 #include "TextIO/TextIOTypes.h" /* Included for Text types */
 #include "GUUID.h"              /* Included for GUUIDTypes */
+#include "AsynchronousIO.h"      /* Included for AsynchronousIOStream */
 
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
 extern "C" {
@@ -89,18 +90,60 @@ extern "C" {
      @enum         CRCPolynomials
      @constant     CRCPolynomial_Unspecified       Invalid Polynomial.
      @constant     CRCPolynomial_IEEE802_3         CRC32 Polynomial used in PNG, MPEG-4, Zip, etc.
+     @constant     CRCPolynomial_Castagnoli        CRC32C Polynomial used in iSCSI, SCTP, Btrfs, ext4, etc.
      */
     typedef enum CRCPolynomials : uint64_t {
                    CRCPolynomial_Unspecified       = 0,
                    CRCPolynomial_IEEE802_3         = 0xEDB88320,
+                   CRCPolynomial_Castagnoli        = 0x82F63B78,
     } BufferIO_CRCPolynomials;
 
+    /*!
+     @typedef      BufferIO_CRC32
+     @abstract                                     Running state of a reflected CRC32, so it can be calculated over several buffers.
+     @constant     State                           The CRC register, before the final inversion.
+     @constant     Polynomial                      Which polynomial's tables to use.
+     */
+    typedef struct BufferIO_CRC32 {
+        uint32_t                 State;
+        BufferIO_CRCPolynomials  Polynomial;
+    } BufferIO_CRC32;
+
+    /*!
+     @typedef      BufferIO_Adler32
+     @abstract                                     Running state of an Adler32, so it can be calculated over several buffers.
+     @constant     A                               Sum of the bytes plus one, modulo 65521.
+     @constant     B                               Sum of each A, modulo 65521.
+     */
+    typedef struct BufferIO_Adler32 {
+        uint32_t                 A;
+        uint32_t                 B;
+    } BufferIO_Adler32;
+
+    /*!
+     @enum         BitBufferPoolOptions
+     @constant     BitBufferPoolOption_Unspecified   Reused BitBuffers keep whatever their array held.
+     @constant     BitBufferPoolOption_ZeroOnAcquire Zero the array of every BitBuffer handed out.
+     @constant     BitBufferPoolOption_ThreadCaches  Each thread keeps a few released BitBuffers per size class, so it can reuse them without taking the pool's lock; a thread caches for up to 4 pools at once.
+     */
+    typedef enum BitBufferPoolOptions : uint8_t {
+                   BitBufferPoolOption_Unspecified   = 0,
+                   BitBufferPoolOption_ZeroOnAcquire = 1,
+                   BitBufferPoolOption_ThreadCaches  = 2,
+    } BufferIO_BitBufferPoolOptions;
+
     /*!
      @typedef      BitBuffer
      @abstract                                     Contains variables and a pointer to a buffer for reading and writing bits.
      */
     typedef struct BitBuffer                       BitBuffer;
 
+    /*!
+     @typedef      BitBufferPool
+     @abstract                                     Keeps released BitBuffers in power of two size classes, to hand out again instead of allocating.
+     */
+    typedef struct BitBufferPool                   BitBufferPool;
+
     /*!
      @typedef      InsecurePRNG
      @abstract                                     Forward declaration from CryptographyIO.
@@ -115,6 +158,33 @@ extern "C" {
      */
     BitBuffer     *BitBuffer_Init(size_t BitBufferSize);
 
+    /*!
+     @abstract                                     Creates a BitBuffer whose array is the file at Path8, mapped read only.
+     @remark                                       Nothing is copied, pages are loaded as they're read; don't write to, resize, or stream into the BitBuffer.
+     @param        Path8                           The UTF-8 encoded path of the file to map.
+     @return                                       Returns the BitBuffer, or NULL if the file couldn't be opened, is empty, or couldn't be mapped.
+     */
+    BitBuffer     *BitBuffer_InitFromMappedFileUTF8(PlatformIO_Immutable(UTF8 *) Path8);
+
+    /*!
+     @abstract                                     Creates a BitBuffer whose array is Stream's file, mapped read only.
+     @remark                                       Stream can be closed afterwards, the mapping stays valid until BitBuffer_Deinit.
+     @param        Stream                          The opened file to map, from the beginning.
+     @return                                       Returns the BitBuffer, or NULL if the file is empty or couldn't be mapped.
+     */
+    BitBuffer     *BitBuffer_InitFromMappedFile(AsynchronousIOStream *Stream);
+
+    /*!
+     @abstract                                     Tells the OS how a mapped BitBuffer will be read.
+     @remark                                       The range is widened to whole pages; does nothing for BitBuffers that aren't mapped.
+     @param        BitB                            BitBuffer Pointer.
+     @param        AccessPattern                   How the range will be read.
+     @param        StartInBits                     Where the range starts.
+     @param        NumBits                         How big the range is, 0 means until the end.
+     @return                                       Returns true if the hint was accepted.
+     */
+    bool           BitBuffer_AdviseMapping(BitBuffer *BitB, AsynchronousIO_AccessPatterns AccessPattern, size_t StartInBits, size_t NumBits);
+
     /*!
      @abstract                                     Gets the size of the BitBuffer in bits.
      @param        BitB                            BitBuffer Pointer.
@@ -153,6 +223,7 @@ extern "C" {
     /*!
      @abstract                                     Gets a pointer to BitBuffer's array.
      @remark                                       This is a low level function, only really useful for implementing say a Huffman reader/writer.
+     @remark                                       Call BitBuffer_SetArray again after modifying the array directly, so the read cache is discarded.
      @param        BitB                            BitBuffer Pointer.
      @return                                       Returns the pointer for BitBuffer's array.
      */
@@ -203,10 +274,19 @@ extern "C" {
     /*!
      @abstract                                     Changes the size of an already initialized BitBuffer.
      @remark                                       Resizing a BitBuffer IS NOT destructive.
+     @remark                                       The array only grows when NewSizeInBytes is larger than its capacity, and then to the next power of two.
      @param        BitB                            BitBuffer Pointer to resize.
-     @param        NewSizeInBits                   The new size of the internal buffer in bytes.
+     @param        NewSizeInBytes                  The new size of the internal buffer in bytes.
+     */
+    void           BitBuffer_Resize(BitBuffer *BitB, size_t NewSizeInBytes);
+
+    /*!
+     @abstract                                     Slides the unread bytes to the start of the array, so the rest of it can be refilled.
+     @remark                                       The partially read byte is kept, the position becomes the bit offset within it.
+     @param        BitB                            BitBuffer Pointer to compact.
+     @return                                       Returns the number of bytes moved out of the way, the space now free at the end of the array.
      */
-    void           BitBuffer_Resize(BitBuffer *BitB, size_t NewSizeInBits);
+    size_t         BitBuffer_Compact(BitBuffer *BitB);
 
     /*!
      @abstract                                     Copies BitBuffer Source to Destination.
@@ -218,18 +298,48 @@ extern "C" {
      */
     void           BitBuffer_Copy(BitBuffer *Source, BitBuffer *Destination, size_t BitStart, size_t BitEnd);
 
+    /*!
+     @abstract                                     Sets the stream ReadStream reads from, starting at the stream's position.
+     @param        BitB                            BitBuffer Pointer.
+     @param        Input                           The stream to read from.
+     */
+    void           BitBuffer_SetInputStream(BitBuffer *BitB, AsynchronousIOStream *Input);
+
+    /*!
+     @abstract                                     Sets the stream WriteStream writes to, starting at the stream's position.
+     @param        BitB                            BitBuffer Pointer.
+     @param        Output                          The stream to write to.
+     */
+    void           BitBuffer_SetOutputStream(BitBuffer *BitB, AsynchronousIOStream *Output);
+
+    /*!
+     @abstract                                     Sets how many array sized chunks ReadStream keeps in flight, and WriteStream lets pile up, before blocking.
+     @remark                                       0, the default, makes ReadStream and WriteStream block on every call.
+     @remark                                       Waits for any pending writes, and discards any prefetched data that hasn't been read yet.
+     @param        BitB                            BitBuffer Pointer.
+     @param        PrefetchDepth                   The number of chunks, 2 is double buffering.
+     */
+    void           BitBuffer_SetPrefetchDepth(BitBuffer *BitB, uint8_t PrefetchDepth);
+
     /*!
      @abstract                                     Reads BitBuffer's Input Stream into BitBuffer's array
+     @remark                                       The unread bits are moved to the start of the array, and the rest is filled from the stream.
+     @remark                                       With a PrefetchDepth the data usually already arrived, and the chunk just drained is resubmitted.
+     @remark                                       Moving the Input Stream between calls throws away what was prefetched, and starts again from the new position.
+     @remark                                       BitBuffer_GetSize is smaller than the array once the end of the stream is reached.
      @param        BitB                            The BitBuffer to read to.
      */
     void           BitBuffer_ReadStream(BitBuffer *BitB);
 
     /*!
      @abstract                                     Writes BitBuffer's array to BitBuffer's Output Stream
-     @remark                                       Only writes actually used data.
+     @remark                                       Only writes whole bytes, the partial byte is moved to the start of the array.
+     @remark                                       With a PrefetchDepth the write is submitted without waiting, BitBuffer_Deinit waits for it.
+     @remark                                       A failed asynchronous write is reported by the WriteStream that waits for it, which can be a later call.
      @param        BitB                            The BitBuffer to write.
+     @return                                       Returns false if a write failed.
      */
-    void           BitBuffer_WriteStream(BitBuffer *BitB);
+    bool           BitBuffer_WriteStream(BitBuffer *BitB);
 
     /* Ignore clang's warning: shorten-64-to-32 aka Wnarrowing */
 
@@ -240,6 +350,15 @@ extern "C" {
 #pragma gcc diagnostic ignored "-Wconversion"
 #endif /* PlatformIO_Compiler */
 
+    /*!
+     @abstract                                     Sets the byte and bit order used by the Default read/write functions.
+     @remark                                       The order is resolved once here instead of on every read; BitBuffer_Init defaults to Left2Right/Left2Right.
+     @param        BitB                            BitBuffer Pointer.
+     @param        ByteOrder                       What byte order should the Default functions use?
+     @param        BitOrder                        What bit order should the Default functions use?
+     */
+    void           BitBuffer_SetDefaultOrder(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder);
+
     /*!
      @abstract                                     Peeks (reads but without recording that it's been read) bits from BitBuffer.
      @param        BitB                            BitBuffer Pointer.
@@ -259,13 +378,90 @@ extern "C" {
     uint64_t       BitBuffer_ReadBits(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t Bits2Read);
 
     /*!
-     @abstract                                     Reads Rice encoded bits from BitBuffer.
+     @abstract                                     Peeks bits from BitBuffer in the order set by BitBuffer_SetDefaultOrder.
+     @param        BitB                            BitBuffer Pointer.
+     @param        Bits2Peek                       The number of bits to peek from the BitBuffer.
+     */
+    uint64_t       BitBuffer_PeekBitsDefault(BitBuffer *BitB, uint8_t Bits2Peek);
+
+    /*!
+     @abstract                                     Reads bits from BitBuffer in the order set by BitBuffer_SetDefaultOrder.
+     @param        BitB                            BitBuffer Pointer.
+     @param        Bits2Read                       The number of bits to read from the BitBuffer.
+     */
+    uint64_t       BitBuffer_ReadBitsDefault(BitBuffer *BitB, uint8_t Bits2Read);
+
+    /*!
+     @abstract                                     Reads NumFields fixed size fields from BitBuffer into Array.
+     @remark                                       Equivalent to calling BitBuffer_ReadBits NumFields times, but the order is resolved once, and common field sizes are unpacked with SIMD.
+     @param        BitB                            BitBuffer Pointer.
+     @param        ByteOrder                       What byte order are the fields to be read?
+     @param        BitOrder                        What bit order are the fields to be read?
+     @param        FieldSize                       The size of each field in bits, must fit in an element of Array.
+     @param        Array                           Where to put the fields.
+     @param        NumFields                       The number of fields to read.
+     */
+    void           BitBuffer_ReadBitsArray16(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t FieldSize, uint16_t *Array, size_t NumFields);
+
+    /*!
+     @abstract                                     Reads NumFields fixed size fields from BitBuffer into Array.
+     @remark                                       Equivalent to calling BitBuffer_ReadBits NumFields times, but the order is resolved once, and common field sizes are unpacked with SIMD.
+     @param        BitB                            BitBuffer Pointer.
+     @param        ByteOrder                       What byte order are the fields to be read?
+     @param        BitOrder                        What bit order are the fields to be read?
+     @param        FieldSize                       The size of each field in bits, must fit in an element of Array.
+     @param        Array                           Where to put the fields.
+     @param        NumFields                       The number of fields to read.
+     */
+    void           BitBuffer_ReadBitsArray32(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t FieldSize, uint32_t *Array, size_t NumFields);
+
+    /*!
+     @abstract                                     Reads NumFields fixed size fields from BitBuffer into Array.
+     @remark                                       Equivalent to calling BitBuffer_ReadBits NumFields times, but the order is resolved once.
+     @param        BitB                            BitBuffer Pointer.
+     @param        ByteOrder                       What byte order are the fields to be read?
+     @param        BitOrder                        What bit order are the fields to be read?
+     @param        FieldSize                       The size of each field in bits.
+     @param        Array                           Where to put the fields.
+     @param        NumFields                       The number of fields to read.
+     */
+    void           BitBuffer_ReadBitsArray64(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t FieldSize, uint64_t *Array, size_t NumFields);
+
+#define            BitBuffer_ReadBitsArray(BitB, ByteOrder, BitOrder, FieldSize, Array, NumFields) _Generic((Array), uint16_t*:BitBuffer_ReadBitsArray16, uint32_t*:BitBuffer_ReadBitsArray32, uint64_t*:BitBuffer_ReadBitsArray64)(BitB, ByteOrder, BitOrder, FieldSize, Array, NumFields)
+
+    /*!
+     @abstract                                     Reads a Rice encoded value from BitBuffer.
+     @remark                                       The quotient is unary coded, followed by RiceParameter bits of remainder.
+     @param        BitB                            BitBuffer Pointer.
+     @param        ByteOrder                       What byte order are the bits to be read?
+     @param        BitOrder                        What bit order are the bits to be read?
+     @param        Terminator                      Should we stop at zero or one?
+     @param        RiceParameter                   The number of remainder bits, aka k.
+     @return                                       Returns (Quotient << RiceParameter) | Remainder.
+     */
+    uint64_t       BitBuffer_ReadRICE(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, BufferIO_UnaryTerminators Terminator, uint8_t RiceParameter);
+
+    /*!
+     @abstract                                     Reads NumValues Rice encoded values sharing one RiceParameter, like a block of residuals.
      @param        BitB                            BitBuffer Pointer.
      @param        ByteOrder                       What byte order are the bits to be read?
      @param        BitOrder                        What bit order are the bits to be read?
      @param        Terminator                      Should we stop at zero or one?
+     @param        RiceParameter                   The number of remainder bits, aka k; must be less than 32.
+     @param        Array                           Where to put the decoded values.
+     @param        NumValues                       The number of values to decode.
+     */
+    void           BitBuffer_ReadRICEArray(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, BufferIO_UnaryTerminators Terminator, uint8_t RiceParameter, uint32_t *Array, size_t NumValues);
+
+    /*!
+     @abstract                                     Reads an Exp-Golomb encoded value from BitBuffer.
+     @remark                                       N leading zeros, a one, then N + Order bits; Order 0 is H.264's ue(v).
+     @param        BitB                            BitBuffer Pointer.
+     @param        ByteOrder                       What byte order are the bits to be read?
+     @param        BitOrder                        What bit order are the bits to be read?
+     @param        Order                           The Exp-Golomb order, aka k.
      */
-    uint64_t       BitBuffer_ReadRICE(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, BufferIO_UnaryTerminators Terminator);
+    uint64_t       BitBuffer_ReadExpGolomb(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t Order);
 
     /*!
      @abstract                                     Reads unary encoded fields from the BitBuffer.
@@ -337,22 +533,46 @@ extern "C" {
 
     /*!
      @abstract                                     Calculates CRC32 from BitBuffer starting at Offset ending at Offset + NumBytes
+     @remark                                       The bytes are read in place, the BitBuffer's position is not changed.
      @param        BitB                            BitBuffer Pointer.
-     @param        OffsetInBits                    The Offset into the BitBuffer.
+     @param        OffsetInBits                    The Offset into the BitBuffer, must be byte aligned.
      @param        NumBytes                        The number of bytes to calculate.
+     @param        InitValue                       The value to preset the CRC register with, usually 0xFFFFFFFF.
+     @param        Polynomial                      The polynomial to use.
      @return                                       Returns the calculated CRC.
      */
-    uint32_t       BitBuffer_CalculateCRC(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, size_t OffsetInBits, size_t NumBytes, uint64_t InitValue, BufferIO_CRCPolynomials Polynomial);
+    uint32_t       BitBuffer_CalculateCRC(BitBuffer *BitB, size_t OffsetInBits, size_t NumBytes, uint32_t InitValue, BufferIO_CRCPolynomials Polynomial);
+
+    /*!
+     @abstract                                     Continues a running CRC32 with NumBytes from the BitBuffer starting at Offset.
+     @remark                                       The bytes are read in place, the BitBuffer's position is not changed.
+     @param        BitB                            BitBuffer Pointer.
+     @param        CRC                             The running CRC from BufferIO_CRC32_Init.
+     @param        OffsetInBits                    The Offset into the BitBuffer, must be byte aligned.
+     @param        NumBytes                        The number of bytes to calculate.
+     */
+    void           BitBuffer_UpdateCRC(BitBuffer *BitB, BufferIO_CRC32 *CRC, size_t OffsetInBits, size_t NumBytes);
 
     /*!
      @abstract                                     Runs Adler32 hash over the BitBuffer starting at Offset
+     @remark                                       The bytes are read in place, the BitBuffer's position is not changed.
      @param        BitB                            The BitBuffer pointer.
-     @param        OffsetInBits                    The Offset into the BitBuffer
+     @param        OffsetInBits                    The Offset into the BitBuffer, must be byte aligned.
      @param        NumBytes                        The number of bytes to read
      @return                                       Returns the calculated Adler32.
      */
     uint32_t       BitBuffer_CalculateAdler32(BitBuffer *BitB, size_t OffsetInBits, size_t NumBytes);
 
+    /*!
+     @abstract                                     Continues a running Adler32 with NumBytes from the BitBuffer starting at Offset.
+     @remark                                       The bytes are read in place, the BitBuffer's position is not changed.
+     @param        BitB                            The BitBuffer pointer.
+     @param        Adler                           The running Adler32 from BufferIO_Adler32_Init.
+     @param        OffsetInBits                    The Offset into the BitBuffer, must be byte aligned.
+     @param        NumBytes                        The number of bytes to read
+     */
+    void           BitBuffer_UpdateAdler32(BitBuffer *BitB, BufferIO_Adler32 *Adler, size_t OffsetInBits, size_t NumBytes);
+
     /*!
      @abstract                                     Writes bits to the BitBuffer.
      @param        BitB                            BitBuffer Pointer.
@@ -363,6 +583,52 @@ extern "C" {
      */
     void           BitBuffer_WriteBits(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t NumBits2Write, uint64_t Bits2Write);
 
+    /*!
+     @abstract                                     Writes bits to the BitBuffer in the order set by BitBuffer_SetDefaultOrder.
+     @param        BitB                            BitBuffer Pointer.
+     @param        NumBits2Write                   How many bits from Bits2Write should we write?
+     @param        Bits2Write                      The actual data to write.
+     */
+    void           BitBuffer_WriteBitsDefault(BitBuffer *BitB, uint8_t NumBits2Write, uint64_t Bits2Write);
+
+    /*!
+     @abstract                                     Writes the low FieldSize bits of each element of Array to the BitBuffer.
+     @remark                                       Equivalent to calling BitBuffer_WriteBits NumFields times, bits around the written range are preserved.
+     @param        BitB                            BitBuffer Pointer.
+     @param        ByteOrder                       What byte order should the fields be in?
+     @param        BitOrder                        What bit order should the fields be in?
+     @param        FieldSize                       The size of each field in bits.
+     @param        Array                           The fields to write.
+     @param        NumFields                       The number of fields to write.
+     */
+    void           BitBuffer_WriteBitsArray16(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t FieldSize, const uint16_t *Array, size_t NumFields);
+
+    /*!
+     @abstract                                     Writes the low FieldSize bits of each element of Array to the BitBuffer.
+     @remark                                       Equivalent to calling BitBuffer_WriteBits NumFields times, bits around the written range are preserved.
+     @param        BitB                            BitBuffer Pointer.
+     @param        ByteOrder                       What byte order should the fields be in?
+     @param        BitOrder                        What bit order should the fields be in?
+     @param        FieldSize                       The size of each field in bits.
+     @param        Array                           The fields to write.
+     @param        NumFields                       The number of fields to write.
+     */
+    void           BitBuffer_WriteBitsArray32(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t FieldSize, const uint32_t *Array, size_t NumFields);
+
+    /*!
+     @abstract                                     Writes the low FieldSize bits of each element of Array to the BitBuffer.
+     @remark                                       Equivalent to calling BitBuffer_WriteBits NumFields times, bits around the written range are preserved.
+     @param        BitB                            BitBuffer Pointer.
+     @param        ByteOrder                       What byte order should the fields be in?
+     @param        BitOrder                        What bit order should the fields be in?
+     @param        FieldSize                       The size of each field in bits.
+     @param        Array                           The fields to write.
+     @param        NumFields                       The number of fields to write.
+     */
+    void           BitBuffer_WriteBitsArray64(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t FieldSize, const uint64_t *Array, size_t NumFields);
+
+#define            BitBuffer_WriteBitsArray(BitB, ByteOrder, BitOrder, FieldSize, Array, NumFields) _Generic((Array), uint16_t*:BitBuffer_WriteBitsArray16, const uint16_t*:BitBuffer_WriteBitsArray16, uint32_t*:BitBuffer_WriteBitsArray32, const uint32_t*:BitBuffer_WriteBitsArray32, uint64_t*:BitBuffer_WriteBitsArray64, const uint64_t*:BitBuffer_WriteBitsArray64)(BitB, ByteOrder, BitOrder, FieldSize, Array, NumFields)
+
     /*!
      @abstract                                     Writes unary encoded bits to the BitBuffer.
      @param        BitB                            BitBuffer Pointer.
@@ -370,9 +636,30 @@ extern "C" {
      @param        BitOrder                        What bit order should the Bits2Write be in?
      @param        UnaryType                       What type of Unary coding should we use?
      @param        UnaryTerminator                 Is the stop bit a one or a zero?
-     @param        Bits2Write                      The actual data to write.
+     @param        Field2Write                     The value to write.
+     */
+    void           BitBuffer_WriteUnary(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, BufferIO_UnaryTypes UnaryType, BufferIO_UnaryTerminators UnaryTerminator, uint64_t Field2Write);
+
+    /*!
+     @abstract                                     Writes a Rice encoded value to the BitBuffer.
+     @param        BitB                            BitBuffer Pointer.
+     @param        ByteOrder                       What byte order should the value be in?
+     @param        BitOrder                        What bit order should the value be in?
+     @param        Terminator                      Is the stop bit a one or a zero?
+     @param        RiceParameter                   The number of remainder bits, aka k.
+     @param        Value2Write                     The value to write.
+     */
+    void           BitBuffer_WriteRICE(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, BufferIO_UnaryTerminators Terminator, uint8_t RiceParameter, uint64_t Value2Write);
+
+    /*!
+     @abstract                                     Writes an Exp-Golomb encoded value to the BitBuffer.
+     @param        BitB                            BitBuffer Pointer.
+     @param        ByteOrder                       What byte order should the value be in?
+     @param        BitOrder                        What bit order should the value be in?
+     @param        Order                           The Exp-Golomb order, aka k.
+     @param        Value2Write                     The value to write.
      */
-    void           BitBuffer_WriteUnary(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, BufferIO_UnaryTypes UnaryType, BufferIO_UnaryTerminators UnaryTerminator, uint8_t Bits2Write);
+    void           BitBuffer_WriteExpGolomb(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t Order, uint64_t Value2Write);
 
     /*!
      @abstract                                     Writes a UTF-8 encoded string to the BitBuffer.
@@ -405,18 +692,131 @@ extern "C" {
     void           BitBuffer_Deinit(BitBuffer *BitB);
     /* BitBuffer */
 
+    /* BitBufferPool */
+    /*!
+     @abstract                                     Creates a BitBufferPool.
+     @param        Options                         BitBufferPoolOptions ORed together.
+     @return                                       Returns a pointer to the BitBufferPool.
+     */
+    BitBufferPool *BitBufferPool_Init(BufferIO_BitBufferPoolOptions Options);
+
+    /*!
+     @abstract                                     Hands out a BitBuffer, reusing a released one of the same size class when there is one.
+     @remark                                       Only the first acquire of each size class allocates, as long as BitBuffers are released back to the pool.
+     @param        Pool                            BitBufferPool Pointer.
+     @param        BitBufferSize                   The number of bytes the BitBuffer needs, its array is rounded up to the next power of two; 0 hands out an empty BitBuffer from the smallest class.
+     @return                                       Returns a BitBuffer positioned at 0, with no streams attached.
+     */
+    BitBuffer     *BitBufferPool_Acquire(BitBufferPool *Pool, size_t BitBufferSize);
+
+    /*!
+     @abstract                                     Gives a BitBuffer back to the pool, it must not be used afterwards.
+     @remark                                       Mapped BitBuffers, and ones smaller than the smallest size class, are deinitialized instead.
+     @param        Pool                            BitBufferPool Pointer.
+     @param        BitB                            The BitBuffer to release, it doesn't have to have come from this pool.
+     */
+    void           BitBufferPool_Release(BitBufferPool *Pool, BitBuffer *BitB);
+
+    /*!
+     @abstract                                     Moves the calling thread's cached BitBuffers back into the pool.
+     @remark                                       Threads that used a pool with BitBufferPoolOption_ThreadCaches must call this before exiting, or before the pool is deinitialized.
+     @param        Pool                            BitBufferPool Pointer.
+     */
+    void           BitBufferPool_FlushThreadCache(BitBufferPool *Pool);
+
+    /*!
+     @abstract                                     Frees every BitBuffer in the pool, and the pool.
+     @remark                                       BitBuffers still acquired are not freed, deinit or release them first.
+     @param        Pool                            BitBufferPool Pointer.
+     */
+    void           BitBufferPool_Deinit(BitBufferPool *Pool);
+    /* BitBufferPool */
+
     /* Standard Replacements */
+    /*!
+     @abstract                                     Sets the size at which MemoryCopy and MemorySet switch to non-temporal stores, so large copies don't evict the cache.
+     @param        ThresholdInBytes                The size in bytes, defaults to 4MiB; SIZE_MAX disables non-temporal stores.
+     */
+    void   BufferIO_SetNonTemporalThreshold(size_t ThresholdInBytes);
+
+    /*!
+     @abstract                                     The copy and set kernels are chosen on first use from the CPU's SIMD extensions, AVX-512/AVX2/SSE2 or a portable fallback.
+     @remark                                       The arrays must not overlap, and must be aligned to their element size.
+     @return                                       Returns the number of elements copied or set.
+     */
     size_t BufferIO_MemoryCopy8(uint8_t *restrict Destination, const uint8_t *restrict Source, const size_t NumElements2Copy);
-    size_t BufferIO_MemoryCopy16(uint64_t *restrict Destination, const uint64_t *restrict Source, const size_t NumElements2Copy);
-    size_t BufferIO_MemoryCopy32(uint64_t *restrict Destination, const uint64_t *restrict Source, const size_t NumElements2Copy);
+    size_t BufferIO_MemoryCopy16(uint16_t *restrict Destination, const uint16_t *restrict Source, const size_t NumElements2Copy);
+    size_t BufferIO_MemoryCopy32(uint32_t *restrict Destination, const uint32_t *restrict Source, const size_t NumElements2Copy);
     size_t BufferIO_MemoryCopy64(uint64_t *restrict Destination, const uint64_t *restrict Source, const size_t NumElements2Copy);
 
+    /*!
+     @abstract                                     Copies bytes between arrays that may overlap, like memmove.
+     @remark                                       Copies forward when Destination is before Source and backward when it's after, both with the same SIMD kernels as MemoryCopy.
+     @return                                       Returns the number of bytes moved.
+     */
+    size_t BufferIO_MemoryMove8(uint8_t *Destination, const uint8_t *Source, const size_t NumElements2Move);
+
     size_t BufferIO_MemorySet8(uint8_t *Array, uint8_t Value2Set, size_t NumElements2Set);
     size_t BufferIO_MemorySet16(uint16_t *Array, uint16_t Value2Set, size_t NumElements2Set);
-    size_t BufferIO_MemorySet32(uint32_t *Array, uint16_t Value2Set, size_t NumElements2Set);
-    size_t BufferIO_MemorySet64(uint64_t *Array, uint16_t Value2Set, size_t NumElements2Set);
+    size_t BufferIO_MemorySet32(uint32_t *Array, uint32_t Value2Set, size_t NumElements2Set);
+    size_t BufferIO_MemorySet64(uint64_t *Array, uint64_t Value2Set, size_t NumElements2Set);
     /* Standard Replacements */
 
+    /* Checksums */
+    /*!
+     @abstract                                     Starts a running CRC32.
+     @param        CRC                             The CRC state to initialize.
+     @param        Polynomial                      The polynomial to use.
+     @param        InitValue                       The value to preset the CRC register with, usually 0xFFFFFFFF.
+     */
+    void           BufferIO_CRC32_Init(BufferIO_CRC32 *CRC, BufferIO_CRCPolynomials Polynomial, uint32_t InitValue);
+
+    /*!
+     @abstract                                     Adds bytes to a running CRC32, using PCLMULQDQ folding when available and slicing by 8 otherwise.
+     @param        CRC                             The CRC state.
+     @param        Bytes                           The bytes to add.
+     @param        NumBytes                        The number of bytes to add.
+     */
+    void           BufferIO_CRC32_Update(BufferIO_CRC32 *CRC, const uint8_t *Bytes, size_t NumBytes);
+
+    /*!
+     @abstract                                     Finishes a running CRC32.
+     @param        CRC                             The CRC state.
+     @return                                       Returns the inverted CRC register.
+     */
+    uint32_t       BufferIO_CRC32_Final(BufferIO_CRC32 *CRC);
+
+    /*!
+     @abstract                                     Starts a running Adler32.
+     @param        Adler                           The Adler32 state to initialize.
+     */
+    void           BufferIO_Adler32_Init(BufferIO_Adler32 *Adler);
+
+    /*!
+     @abstract                                     Adds bytes to a running Adler32, the modulo is deferred to once per 5552 bytes and the sums are vectorized with AVX2/SSE2 when available.
+     @param        Adler                           The Adler32 state.
+     @param        Bytes                           The bytes to add.
+     @param        NumBytes                        The number of bytes to add.
+     */
+    void           BufferIO_Adler32_Update(BufferIO_Adler32 *Adler, const uint8_t *Bytes, size_t NumBytes);
+
+    /*!
+     @abstract                                     Finishes a running Adler32.
+     @param        Adler                           The Adler32 state.
+     @return                                       Returns the Adler32, B in the high 16 bits and A in the low 16.
+     */
+    uint32_t       BufferIO_Adler32_Final(BufferIO_Adler32 *Adler);
+
+    /*!
+     @abstract                                     Combines the Adler32s of two consecutive chunks, as if they had been calculated in one pass.
+     @param        Adler1                          The Adler32 of the first chunk.
+     @param        Adler2                          The Adler32 of the second chunk.
+     @param        Chunk2Size                      The size of the second chunk in bytes.
+     @return                                       Returns the Adler32 of both chunks.
+     */
+    uint32_t       BufferIO_Adler32_Combine(uint32_t Adler1, uint32_t Adler2, size_t Chunk2Size);
+    /* Checksums */
+
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
 }
 #endif /* Extern C */
@@ -21,6 +21,103 @@ extern "C" {
 
     typedef struct      FileIO_FILE                     FileIO_FILE; // Eventually replace all FILE references with our own implementation.
 
+    typedef struct      FileIO_MapView                  FileIO_MapView;
+
+    typedef struct      FileIO_DirectoryWalker          FileIO_DirectoryWalker;
+
+    /*!
+     @enum         FileIO_EntryTypes
+     @constant     EntryType_Unknown                    Never reported, entries the directory listing doesn't give a type for are stat'd
+     @constant     EntryType_File                       Regular file
+     @constant     EntryType_Directory                  Directory, the walker descends into it
+     @constant     EntryType_SymbolicLink               Symbolic link (reparse point on Windows), never followed
+     @constant     EntryType_Other                      Device, pipe, socket, etc
+     */
+    typedef enum FileIO_EntryTypes : uint8_t {
+                   EntryType_Unknown                    = 0,
+                   EntryType_File                       = 1,
+                   EntryType_Directory                  = 2,
+                   EntryType_SymbolicLink               = 3,
+                   EntryType_Other                      = 4,
+    } FileIO_EntryTypes;
+
+    /*!
+     @enum         FileIO_EntryFields
+     @abstract                                          Which FileIO_DirectoryEntry fields need filling in; entries are only stat'd for fields the directory listing doesn't have.
+     @constant     EntryField_None                      Just the path and type
+     @constant     EntryField_Size                      Size
+     @constant     EntryField_ModificationTime          ModificationTime
+     @constant     EntryField_Inode                     Inode
+     */
+    typedef enum FileIO_EntryFields : uint8_t {
+                   EntryField_None                      = 0,
+                   EntryField_Size                      = 1,
+                   EntryField_ModificationTime          = 2,
+                   EntryField_Inode                     = 4,
+    } FileIO_EntryFields;
+#if (PlatformIO_Language == PlatformIO_LanguageIsCXX && PlatformIO_LanguageVersionCXX >= PlatformIO_LanguageVersionCXX11)
+    extern "C++" {
+        constexpr inline FileIO_EntryFields operator | (FileIO_EntryFields A, FileIO_EntryFields B) {
+            return static_cast<FileIO_EntryFields>(static_cast<uint8_t>(A) | static_cast<uint8_t>(B));
+        }
+    }
+#endif /* PlatformIO_Language */
+
+    /*!
+     @abstract                                          What the walker knows about one directory entry, only valid during the callback.
+     @param             Path                            The entry's path, the root joined with every directory down to it.
+     @param             Name                            The last component of Path.
+     @param             Size                            Size in bytes, 0 unless EntryField_Size was requested.
+     @param             ModificationTime                Nanoseconds since 1970, 0 unless EntryField_ModificationTime was requested.
+     @param             Inode                           Inode number, 0 unless EntryField_Inode was requested, always 0 on Windows.
+     @param             Depth                           0 for the root's children, 1 for their children, etc.
+     @param             Type                            What kind of entry it is.
+     */
+    typedef struct FileIO_DirectoryEntry {
+        PlatformIO_Immutable(UTF8 *)                    Path;
+        PlatformIO_Immutable(UTF8 *)                    Name;
+        uint64_t                                        Size;
+        int64_t                                         ModificationTime;
+        uint64_t                                        Inode;
+        uint16_t                                        Depth;
+        FileIO_EntryTypes                               Type;
+    } FileIO_DirectoryEntry;
+
+    /*!
+     @abstract                                          Called for each entry the walker finds, from any of the walker's threads at once.
+     @param             Entry                           The entry.
+     @param             Context                         The pointer given to FileIO_DirectoryWalker_Walk.
+     @return                                            Return false to stop the walk.
+     */
+    typedef bool (*FileIO_WalkFunction)(const FileIO_DirectoryEntry *Entry, void *Context);
+
+    /*!
+     @enum         FileIO_MapModes
+     @constant     MapMode_Unspecified                  Invalid mode
+     @constant     MapMode_Read                         The view can only be read
+     @constant     MapMode_Write                        Writes to the view go to the file, the file is created or grown to fit the view
+     @constant     MapMode_CopyOnWrite                  Writes to the view stay private to the process, the file isn't changed
+     @constant     MapMode_HugePages                    Ask for huge pages to back the view where the OS supports it, ignored otherwise
+     */
+    typedef enum FileIO_MapModes : uint8_t {
+                   MapMode_Unspecified                  = 0,
+                   MapMode_Read                         = 1,
+                   MapMode_Write                        = 2,
+                   MapMode_CopyOnWrite                  = 4,
+                   MapMode_HugePages                    = 8,
+    } FileIO_MapModes;
+#if (PlatformIO_Language == PlatformIO_LanguageIsCXX && PlatformIO_LanguageVersionCXX >= PlatformIO_LanguageVersionCXX11)
+    extern "C++" {
+        constexpr inline FileIO_MapModes operator | (FileIO_MapModes A, FileIO_MapModes B) {
+            return static_cast<FileIO_MapModes>(static_cast<uint8_t>(A) | static_cast<uint8_t>(B));
+        }
+
+        constexpr inline FileIO_MapModes operator & (FileIO_MapModes A, FileIO_MapModes B) {
+            return static_cast<FileIO_MapModes>(static_cast<uint8_t>(A) & static_cast<uint8_t>(B));
+        }
+    }
+#endif /* PlatformIO_Language */
+
     /*!
      @abstract                                          Returns just the filename portion of a path string
      @remark                                            Equilivent to `basename` command,
@@ -134,6 +231,114 @@ extern "C" {
     bool                FileIO_Close(FILE *File);
     /* File Operations */
 
+    /* Mapped Views */
+    /*!
+     @abstract                                          Maps part of the file at Path8 into memory.
+     @remark                                            Offset doesn't need to be page aligned, the view is widened internally and the pointer adjusted.
+     @param             Path8                           The UTF-8 encoded path of the file to map.
+     @param             Offset                          Where in the file the view starts.
+     @param             Length                          How many bytes to map, 0 means until the end of the file.
+     @param             Mode                            MapMode_Read, MapMode_Write, or MapMode_CopyOnWrite, optionally with MapMode_HugePages.
+     @return                                            Returns the view, or NULL if the file couldn't be opened, the range is empty, or couldn't be mapped.
+     */
+    FileIO_MapView     *FileIO_MapView_InitFromPathUTF8(PlatformIO_Immutable(UTF8 *) Path8, size_t Offset, size_t Length, FileIO_MapModes Mode);
+
+    /*!
+     @abstract                                          Maps part of Stream's file into memory.
+     @remark                                            Stream can be closed afterwards, the view stays valid until FileIO_MapView_Deinit.
+     @remark                                            MapMode_Write needs Stream to be opened for reading and writing.
+     @param             Stream                          The opened file to map.
+     @param             Offset                          Where in the file the view starts.
+     @param             Length                          How many bytes to map, 0 means until the end of the file.
+     @param             Mode                            MapMode_Read, MapMode_Write, or MapMode_CopyOnWrite, optionally with MapMode_HugePages.
+     @return                                            Returns the view, or NULL if the range is empty or couldn't be mapped.
+     */
+    FileIO_MapView     *FileIO_MapView_InitFromStream(AsynchronousIOStream *Stream, size_t Offset, size_t Length, FileIO_MapModes Mode);
+
+    /*!
+     @abstract                                          Gets the first byte of the view, Offset bytes into the file.
+     @param             View                            The view.
+     */
+    void               *FileIO_MapView_GetPointer(FileIO_MapView *View);
+
+    /*!
+     @abstract                                          Gets the number of bytes that can be accessed through the view.
+     @param             View                            The view.
+     */
+    size_t              FileIO_MapView_GetSize(FileIO_MapView *View);
+
+    /*!
+     @abstract                                          Writes the view's modified pages back to the file and waits for them to reach the disk.
+     @remark                                            Only MapMode_Write views have anything to write back, the others always succeed.
+     @param             View                            The view.
+     @return                                            Returns true if the pages were written.
+     */
+    bool                FileIO_MapView_Sync(FileIO_MapView *View);
+
+    /*!
+     @abstract                                          Unmaps the view; modified MapMode_Write pages are still written back by the OS eventually.
+     @param             View                            The view.
+     */
+    void                FileIO_MapView_Deinit(FileIO_MapView *View);
+    /* Mapped Views */
+
+    /* Transfers */
+    /*!
+     @abstract                                          Copies bytes from Source to Destination without bringing them into user memory where the OS allows.
+     @remark                                            On Linux files are copied with copy_file_range, files go to sockets and pipes with sendfile, and pipes and sockets are spliced; everything else, and every other OS, goes through a buffer.
+     @remark                                            Neither stream's position changes; the offsets are ignored for pipes and sockets.
+     @param             Destination                     Where to copy the bytes to.
+     @param             DestinationOffset               Where in Destination the bytes go.
+     @param             Source                          Where to copy the bytes from.
+     @param             SourceOffset                    Where in Source the bytes start.
+     @param             NumBytes                        How many bytes to copy, 0 means until the end of Source.
+     @return                                            Returns the number of bytes copied, less than NumBytes if Source ended or an error occurred.
+     */
+    size_t              FileIO_Transfer(AsynchronousIOStream *Destination, size_t DestinationOffset, AsynchronousIOStream *Source, size_t SourceOffset, size_t NumBytes);
+    /* Transfers */
+
+    /* Directory Walking */
+    /*!
+     @abstract                                          Creates a walker that reads directories with a pool of threads.
+     @param             NumThreads                      How many threads read directories, including the caller's; 0 means one per CPU.
+     @return                                            Returns the walker.
+     */
+    FileIO_DirectoryWalker *FileIO_DirectoryWalker_Init(uint16_t NumThreads);
+
+    /*!
+     @abstract                                          Sets which fields entries get, EntryField_None by default.
+     @param             Walker                          The walker.
+     @param             Fields                          The fields wanted.
+     */
+    void                FileIO_DirectoryWalker_SetFields(FileIO_DirectoryWalker *Walker, FileIO_EntryFields Fields);
+
+    /*!
+     @abstract                                          Only reports entries that aren't directories when their name ends in one of the extensions; directories are still reported and descended into.
+     @remark                                            Extensions are copied, and compared without regard to ASCII case.
+     @param             Walker                          The walker.
+     @param             Extensions                      The extensions, without the leading period, e.g. "txt"; NULL reports everything again.
+     @param             NumExtensions                   How many extensions there are.
+     */
+    void                FileIO_DirectoryWalker_SetExtensions(FileIO_DirectoryWalker *Walker, PlatformIO_Immutable(UTF8 *) const *Extensions, size_t NumExtensions);
+
+    /*!
+     @abstract                                          Walks every directory under Root, calling Function for each entry as it's read.
+     @remark                                            Entries are reported in no particular order; symbolic links are reported but not followed.
+     @param             Walker                          The walker.
+     @param             Root                            The UTF-8 encoded path of the directory to walk.
+     @param             Function                        Called for each entry, from several threads at once.
+     @param             Context                         Passed to Function.
+     @return                                            Returns true if every directory could be read and Function never stopped the walk.
+     */
+    bool                FileIO_DirectoryWalker_Walk(FileIO_DirectoryWalker *Walker, PlatformIO_Immutable(UTF8 *) Root, FileIO_WalkFunction Function, void *Context);
+
+    /*!
+     @abstract                                          Frees the walker.
+     @param             Walker                          The walker.
+     */
+    void                FileIO_DirectoryWalker_Deinit(FileIO_DirectoryWalker *Walker);
+    /* Directory Walking */
+
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
 }
 #endif /* Extern C */
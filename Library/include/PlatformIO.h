@@ -539,6 +539,24 @@ int64_t
 #endif /* PlatformIO_Compiler */
 #endif /* PlatformIO_Private */
 
+#ifndef             PlatformIO_TargetFeatures
+#if   (PlatformIO_Compiler == PlatformIO_CompilerIsClang) || (PlatformIO_Compiler == PlatformIO_CompilerIsGCC)
+#define             PlatformIO_TargetFeatures(Features)                                 __attribute__((target(Features)))
+#else
+#define             PlatformIO_TargetFeatures(Features)
+#endif /* PlatformIO_Compiler */
+#endif /* PlatformIO_TargetFeatures */
+
+#ifndef             PlatformIO_ThreadLocal
+#if   (PlatformIO_Language == PlatformIO_LanguageIsCXX)
+#define             PlatformIO_ThreadLocal                                              thread_local
+#elif (PlatformIO_Compiler == PlatformIO_CompilerIsMSVC)
+#define             PlatformIO_ThreadLocal                                              __declspec(thread)
+#else
+#define             PlatformIO_ThreadLocal                                              _Thread_local
+#endif /* PlatformIO_Language */
+#endif /* PlatformIO_ThreadLocal */
+
 #ifndef             PlatformIO_Enum2Index
 #define             PlatformIO_Enum2Index(EnumName)                                     (EnumName - 1)
 #endif /* PlatformIO_Enum2Index */
@@ -587,6 +605,43 @@ extern "C" {
      */
     size_t          PlatformIO_GetTotalMemoryInBytes(void);
 
+    /*!
+     @enum         PlatformIO_SIMDExtensions
+     @abstract                                    The SIMD extensions the CPU we're running on supports, for runtime dispatch.
+     @constant     SIMDExtension_Unspecified      No SIMD extensions are available.
+     @constant     SIMDExtension_SSE2             x86-64 baseline.
+     @constant     SIMDExtension_SSSE3            Adds PSHUFB.
+     @constant     SIMDExtension_SSE41            Adds PMULLD, PBLENDVB, PTEST.
+     @constant     SIMDExtension_SSE42            Adds PCMPISTRI and CRC32C.
+     @constant     SIMDExtension_AVX              256 bit floating point, requires OS support for YMM state.
+     @constant     SIMDExtension_AVX2             256 bit integer.
+     @constant     SIMDExtension_AVX512F          512 bit foundation, requires OS support for ZMM state.
+     @constant     SIMDExtension_AVX512BW         512 bit byte and word operations.
+     @constant     SIMDExtension_PCLMUL           Carry-less multiplication.
+     @constant     SIMDExtension_BMI2             PDEP/PEXT, SHLX/SHRX.
+     @constant     SIMDExtension_NEON             ARM Advanced SIMD.
+     */
+    typedef enum PlatformIO_SIMDExtensions : uint32_t {
+                   SIMDExtension_Unspecified      = 0,
+                   SIMDExtension_SSE2             = 1,
+                   SIMDExtension_SSSE3            = 2,
+                   SIMDExtension_SSE41            = 4,
+                   SIMDExtension_SSE42            = 8,
+                   SIMDExtension_AVX              = 16,
+                   SIMDExtension_AVX2             = 32,
+                   SIMDExtension_AVX512F          = 64,
+                   SIMDExtension_AVX512BW         = 128,
+                   SIMDExtension_PCLMUL           = 256,
+                   SIMDExtension_BMI2             = 512,
+                   SIMDExtension_NEON             = 1024,
+    } PlatformIO_SIMDExtensions;
+
+    /*!
+     @abstract      Gets the SIMD extensions supported by the CPU and OS.
+     @remark        Detected on the first call with CPUID, then cached.
+     */
+    PlatformIO_SIMDExtensions PlatformIO_GetSIMDExtensions(void);
+
     typedef struct PlatformIO_Range {
         size_t Start;
         size_t End;
@@ -0,0 +1,55 @@
+/*!
+ @header          BufferIOTables.h
+ @author          Marcus Johnson
+ @copyright       2023+
+ @version         1.0.0
+ @brief           This header contains the CRC tables, folding constants, and checksum constants used by BufferIO.
+ @remark          The slicing tables are for the reflected (LSBit first) polynomials, CRC32Table[0] is the classic byte at a time table.
+ @remark          The folding constants are bit reflected and shifted left by one, for PCLMULQDQ.
+ */
+
+#pragma once
+
+#ifndef FoundationIO_BufferIOTables_H
+#define FoundationIO_BufferIOTables_H
+
+#include "../PlatformIO.h"    /* Included for Platform Independence macros */
+
+#if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
+extern "C" {
+#endif
+
+    typedef enum BufferIOConstants {
+        CRC32NumSlices                   = 8,
+        CRC32TableSize                   = 256,
+        Adler32Modulus                   = 65521,
+        Adler32BlockSize                 = 5552, // Most bytes that can be summed before B overflows 32 bits, zlib's NMAX
+    } BufferIOConstants;
+
+    /*!
+     @abstract                           Constants to fold 512 and 128 bit blocks, then reduce the final 128 bits to the 32 bit CRC.
+     @constant   Fold4                   x^(4*128+32) mod P, x^(4*128-32) mod P.
+     @constant   Fold1                   x^(128+32) mod P, x^(128-32) mod P.
+     @constant   Reduce64                x^64 mod P.
+     @constant   Barrett                 P, and floor(x^64 / P).
+     */
+    typedef struct BufferIO_CRC32FoldConstants {
+        uint64_t Fold4[2];
+        uint64_t Fold1[2];
+        uint64_t Reduce64[2];
+        uint64_t Barrett[2];
+    } BufferIO_CRC32FoldConstants;
+
+    PlatformIO_Private extern const uint32_t                    CRC32Table_IEEE802_3[CRC32NumSlices][CRC32TableSize];
+
+    PlatformIO_Private extern const BufferIO_CRC32FoldConstants CRC32Fold_IEEE802_3;
+
+    PlatformIO_Private extern const uint32_t                    CRC32Table_Castagnoli[CRC32NumSlices][CRC32TableSize];
+
+    PlatformIO_Private extern const BufferIO_CRC32FoldConstants CRC32Fold_Castagnoli;
+
+#if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
+}
+#endif /* Extern C */
+
+#endif /* FoundationIO_BufferIOTables_H */
@@ -36,6 +36,7 @@ extern "C" {
     
     /*!
      @abstract                                   Sets the name or path of the program to give the logs more context.
+     @remark                                     Log_Deinit releases ProgramName with UTF8_Deinit, so it has to come from UTF8_Init or a function that returns one.
      @param      ProgramName                     String containing either the name or the path of the program that this library was linked into.
      */
     void         Log_SetProgramName(UTF8 *ProgramName);
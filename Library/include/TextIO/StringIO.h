@@ -196,20 +196,103 @@ extern "C" {
         Comparison_NormalizedNFKC  = 6,
 } StringIO_Comparisons;
 
+    /*!
+     @typedef          TextIO_Arena
+     @abstract                                           Bump allocator for strings that only live as long as a batch of work, see TextIO_Arena_SetDefault.
+     */
+    typedef struct TextIO_Arena                          TextIO_Arena;
+
+    /*!
+     @abstract                                           A position in a TextIO_Arena to reset back to.
+     @param            Block                             The block that was current when the mark was taken.
+     @param            Offset                            How much of that block was in use.
+     */
+    typedef struct TextIO_ArenaMark {
+        struct TextIO_ArenaBlock                        *Block;
+        size_t                                           Offset;
+    } TextIO_ArenaMark;
+
+    /* TextIO_Arena */
+    /*!
+     @abstract                                           Creates an arena, along with its first block.
+     @remark                                             An arena is not thread safe; share strings between threads, not arenas.
+     @param            BlockSize                         How many bytes each block holds, larger allocations get a block of their own.
+     @return                                             Returns the arena.
+     */
+    TextIO_Arena      *TextIO_Arena_Init(size_t BlockSize);
+
+    /*!
+     @abstract                                           Carves NumBytes out of the arena, aligned for any string type.
+     @remark                                             The memory is not zeroed, and is only reclaimed by resetting the arena.
+     @param            Arena                             The arena to allocate from.
+     @param            NumBytes                          How many bytes are needed.
+     @return                                             Returns the memory.
+     */
+    void              *TextIO_Arena_Allocate(TextIO_Arena *Arena, size_t NumBytes);
+
+    /*!
+     @abstract                                           Records how much of the arena is in use.
+     @param            Arena                             The arena to mark.
+     @return                                             Returns the mark to give to TextIO_Arena_ResetToMark.
+     */
+    TextIO_ArenaMark   TextIO_Arena_GetMark(TextIO_Arena *Arena);
+
+    /*!
+     @abstract                                           Frees everything allocated after Mark was taken, in one step.
+     @remark                                             Blocks that are no longer in use are kept for the next allocations instead of being freed.
+     @param            Arena                             The arena to reset.
+     @param            Mark                              A mark taken from this arena, that has not been reset past.
+     */
+    void               TextIO_Arena_ResetToMark(TextIO_Arena *Arena, TextIO_ArenaMark Mark);
+
+    /*!
+     @abstract                                           Frees everything allocated from the arena, in one step.
+     @param            Arena                             The arena to reset.
+     */
+    void               TextIO_Arena_Reset(TextIO_Arena *Arena);
+
+    /*!
+     @abstract                                           Makes UTF8_Init, UTF16_Init, and UTF32_Init on this thread allocate from Arena, including the temporaries StringIO makes internally.
+     @remark                                             Strings from an arena can still be passed to the Deinit functions, which leave them for the arena to reclaim.
+     @param            Arena                             The arena to use, or NULL to go back to the heap.
+     @return                                             Returns the previous default, so scopes can nest.
+     */
+    TextIO_Arena      *TextIO_Arena_SetDefault(TextIO_Arena *Arena);
+
+    /*!
+     @abstract                                           Gets this thread's default arena.
+     @return                                             Returns the default arena, or NULL when strings come from the heap.
+     */
+    TextIO_Arena      *TextIO_Arena_GetDefault(void);
+
+    /*!
+     @abstract                                           Frees the arena and every block it holds.
+     @remark                                             Every string allocated from the arena is invalid afterwards, and it must not be any thread's default.
+     @param            Arena                             The arena to deinitialize.
+     */
+    void               TextIO_Arena_Deinit(TextIO_Arena *Arena);
+    /* TextIO_Arena */
+
     /*!
      @abstract                                           Creates a UTF8 string plus a NULL terminator.
+     @remark                                             Comes from this thread's default TextIO_Arena when one is set, otherwise from the heap.
+     @remark                                             The string sits after its allocation's bookkeeping, so release it with UTF8_Deinit, never with free().
      @param            NumCodeUnits                      The size of the string not counting the NULL terminator.
      */
     UTF8              *UTF8_Init(size_t NumCodeUnits);
     
     /*!
      @abstract                                           Creates a UTF16 string plus a NULL terminator.
+     @remark                                             Comes from this thread's default TextIO_Arena when one is set, otherwise from the heap.
+     @remark                                             The string sits after its allocation's bookkeeping, so release it with UTF16_Deinit, never with free().
      @param            NumCodeUnits                      The size of the string not counting the NULL terminator.
      */
     UTF16             *UTF16_Init(size_t NumCodeUnits);
     
     /*!
      @abstract                                           Creates a UTF32 string plus a NULL terminator.
+     @remark                                             Comes from this thread's default TextIO_Arena when one is set, otherwise from the heap.
+     @remark                                             The string sits after its allocation's bookkeeping, so release it with UTF32_Deinit, never with free().
      @param            NumCodePoints                     The size of the string not counting the NULL terminator.
      */
     UTF32             *UTF32_Init(size_t NumCodePoints);
@@ -471,10 +554,20 @@ extern "C" {
     
     /*!
      @abstract                                           Tells if the UTF-8 string pointed to by String is a valid UTF-8 encoded string.
+     @remark                                             Rejects overlong encodings, surrogates, code points over U+10FFFF, and truncated or stray continuation bytes.
      @param            String                            The string to get the validity status from.
      @return                                             Returns Yes if the string is valid, otherwise it returns No.
      */
     bool               UTF8_IsValid(PlatformIO_Immutable(UTF8 *) String);
+
+    /*!
+     @abstract                                           Tells if the first NumCodeUnits of String are valid UTF-8, without looking for a NULL terminator.
+     @remark                                             Validated 16 or 32 code units at a time with AVX2/SSSE3 when the CPU has them, skipping 64 at a time through ASCII.
+     @param            String                            The code units to check, NULLs included are valid.
+     @param            NumCodeUnits                      How many code units to check.
+     @return                                             Returns Yes if the code units are valid, otherwise it returns No.
+     */
+    bool               UTF8_IsValidWithSize(PlatformIO_Immutable(UTF8 *) String, size_t NumCodeUnits);
     
     /*!
      @abstract                                           Tells if the UTF-16 string pointed to by String is a valid UTF-16 encoded string.
@@ -605,6 +698,66 @@ extern "C" {
      */
     UTF8              *UTF16_Convert(PlatformIO_Immutable(UTF16 *) String);
 
+    /*!
+     @abstract                                           Converts a UTF8 string to UTF16 in a buffer the caller owns, without going through UTF32.
+     @remark                                             Malformed code units become U+FFFD, one per code unit.
+     @param            String                            The NULL terminated string to convert.
+     @param            Destination                       Where to write the converted string and its NULL terminator, may be NULL when Capacity is 0.
+     @param            Capacity                          The size of Destination in code units, including room for the NULL terminator.
+     @return                                             Returns the size of the converted string in code units, not counting the NULL; nothing is written when that is not less than Capacity.
+     */
+    size_t             UTF8_ConvertInto(PlatformIO_Immutable(UTF8 *) String, UTF16 *Destination, size_t Capacity);
+
+    /*!
+     @abstract                                           Converts a UTF16 string to UTF8 in a buffer the caller owns, without going through UTF32.
+     @remark                                             Unpaired surrogates become U+FFFD.
+     @param            String                            The NULL terminated string to convert.
+     @param            Destination                       Where to write the converted string and its NULL terminator, may be NULL when Capacity is 0.
+     @param            Capacity                          The size of Destination in code units, including room for the NULL terminator.
+     @return                                             Returns the size of the converted string in code units, not counting the NULL; nothing is written when that is not less than Capacity.
+     */
+    size_t             UTF16_ConvertInto(PlatformIO_Immutable(UTF16 *) String, UTF8 *Destination, size_t Capacity);
+
+    /*!
+     @abstract                                           Decodes a UTF8 string to UTF32 in a buffer the caller owns.
+     @remark                                             Malformed code units become U+FFFD, one per code unit.
+     @param            String                            The NULL terminated string to decode.
+     @param            Destination                       Where to write the decoded string and its NULL terminator, may be NULL when Capacity is 0.
+     @param            Capacity                          The size of Destination in code points, including room for the NULL terminator.
+     @return                                             Returns the size of the decoded string in code points, not counting the NULL; nothing is written when that is not less than Capacity.
+     */
+    size_t             UTF8_DecodeInto(PlatformIO_Immutable(UTF8 *) String, UTF32 *Destination, size_t Capacity);
+
+    /*!
+     @abstract                                           Decodes a UTF16 string to UTF32 in a buffer the caller owns.
+     @remark                                             Unpaired surrogates become U+FFFD.
+     @param            String                            The NULL terminated string to decode.
+     @param            Destination                       Where to write the decoded string and its NULL terminator, may be NULL when Capacity is 0.
+     @param            Capacity                          The size of Destination in code points, including room for the NULL terminator.
+     @return                                             Returns the size of the decoded string in code points, not counting the NULL; nothing is written when that is not less than Capacity.
+     */
+    size_t             UTF16_DecodeInto(PlatformIO_Immutable(UTF16 *) String, UTF32 *Destination, size_t Capacity);
+
+    /*!
+     @abstract                                           Encodes a UTF32 string to UTF8 in a buffer the caller owns.
+     @remark                                             Surrogates and values past U+10FFFF become U+FFFD.
+     @param            String                            The NULL terminated string to encode.
+     @param            Destination                       Where to write the encoded string and its NULL terminator, may be NULL when Capacity is 0.
+     @param            Capacity                          The size of Destination in code units, including room for the NULL terminator.
+     @return                                             Returns the size of the encoded string in code units, not counting the NULL; nothing is written when that is not less than Capacity.
+     */
+    size_t             UTF8_EncodeInto(PlatformIO_Immutable(UTF32 *) String, UTF8 *Destination, size_t Capacity);
+
+    /*!
+     @abstract                                           Encodes a UTF32 string to UTF16 in a buffer the caller owns.
+     @remark                                             Surrogates and values past U+10FFFF become U+FFFD.
+     @param            String                            The NULL terminated string to encode.
+     @param            Destination                       Where to write the encoded string and its NULL terminator, may be NULL when Capacity is 0.
+     @param            Capacity                          The size of Destination in code units, including room for the NULL terminator.
+     @return                                             Returns the size of the encoded string in code units, not counting the NULL; nothing is written when that is not less than Capacity.
+     */
+    size_t             UTF16_EncodeInto(PlatformIO_Immutable(UTF32 *) String, UTF16 *Destination, size_t Capacity);
+
     /* TextIOTables Operations */
     /*!
      @abstract                                           Checks if a given CodePoint is in the specified Table from TextIO.
@@ -660,6 +813,16 @@ extern "C" {
      @return                                             Returns the case folded string.
      */
     UTF8              *UTF8_CaseFold(PlatformIO_Immutable(UTF8 *) String);
+
+    /*!
+     @abstract                                           Casefolds a string into a buffer the caller owns.
+     @remark                                             Builds the result with the allocating version and copies it, so a temporary is still taken from the default TextIO_Arena when one is set, or the heap otherwise.
+     @param            String                            The NULL terminated string to be casefolded.
+     @param            Destination                       Where to write the casefolded string and its NULL terminator, may be NULL when Capacity is 0.
+     @param            Capacity                          The size of Destination in code units, including room for the NULL terminator.
+     @return                                             Returns the size of the casefolded string in code units, not counting the NULL; Destination only holds the result when that is less than Capacity.
+     */
+    size_t             UTF8_CaseFoldInto(PlatformIO_Immutable(UTF8 *) String, UTF8 *Destination, size_t Capacity);
     
     /*!
      @abstract                                           Casefolds string for case insensitive comparison.
@@ -668,6 +831,16 @@ extern "C" {
      @return                                             Returns the case folded string.
      */
     UTF16             *UTF16_CaseFold(PlatformIO_Immutable(UTF16 *) String);
+
+    /*!
+     @abstract                                           Casefolds a string into a buffer the caller owns.
+     @remark                                             Builds the result with the allocating version and copies it, so a temporary is still taken from the default TextIO_Arena when one is set, or the heap otherwise.
+     @param            String                            The NULL terminated string to be casefolded.
+     @param            Destination                       Where to write the casefolded string and its NULL terminator, may be NULL when Capacity is 0.
+     @param            Capacity                          The size of Destination in code units, including room for the NULL terminator.
+     @return                                             Returns the size of the casefolded string in code units, not counting the NULL; Destination only holds the result when that is less than Capacity.
+     */
+    size_t             UTF16_CaseFoldInto(PlatformIO_Immutable(UTF16 *) String, UTF16 *Destination, size_t Capacity);
     
     /*!
      @abstract                                           Casefolds string for case insensitive comparison.
@@ -676,6 +849,16 @@ extern "C" {
      @return                                             Returns the case folded string.
      */
     UTF32             *UTF32_CaseFold(PlatformIO_Immutable(UTF32 *) String);
+
+    /*!
+     @abstract                                           Casefolds a string into a buffer the caller owns.
+     @remark                                             Builds the result with the allocating version and copies it, so a temporary is still taken from the default TextIO_Arena when one is set, or the heap otherwise.
+     @param            String                            The NULL terminated string to be casefolded.
+     @param            Destination                       Where to write the casefolded string and its NULL terminator, may be NULL when Capacity is 0.
+     @param            Capacity                          The size of Destination in code points, including room for the NULL terminator.
+     @return                                             Returns the size of the casefolded string in code points, not counting the NULL; Destination only holds the result when that is less than Capacity.
+     */
+    size_t             UTF32_CaseFoldInto(PlatformIO_Immutable(UTF32 *) String, UTF32 *Destination, size_t Capacity);
     
     /*!
      @abstract                                           Converts string to use precomposed forms, otherwise it orders the combining CodePoints in lexiographic order.
@@ -702,6 +885,39 @@ extern "C" {
      @param            NormalizedForm                    The type of normalization to use on the String.
      */
     UTF32             *UTF32_Normalize(PlatformIO_Immutable(UTF32 *) String, StringIO_NormalizationForms NormalizedForm);
+
+    /*!
+     @abstract                                           Normalizes a string into a buffer the caller owns.
+     @remark                                             Builds the result with the allocating version and copies it, so a temporary is still taken from the default TextIO_Arena when one is set, or the heap otherwise.
+     @param            String                            The NULL terminated string to be normalized.
+     @param            NormalizedForm                    The type of normalization to use on the String.
+     @param            Destination                       Where to write the normalized string and its NULL terminator, may be NULL when Capacity is 0.
+     @param            Capacity                          The size of Destination in code units, including room for the NULL terminator.
+     @return                                             Returns the size of the normalized string in code units, not counting the NULL; Destination only holds the result when that is less than Capacity.
+     */
+    size_t             UTF8_NormalizeInto(PlatformIO_Immutable(UTF8 *) String, StringIO_NormalizationForms NormalizedForm, UTF8 *Destination, size_t Capacity);
+
+    /*!
+     @abstract                                           Normalizes a string into a buffer the caller owns.
+     @remark                                             Builds the result with the allocating version and copies it, so a temporary is still taken from the default TextIO_Arena when one is set, or the heap otherwise.
+     @param            String                            The NULL terminated string to be normalized.
+     @param            NormalizedForm                    The type of normalization to use on the String.
+     @param            Destination                       Where to write the normalized string and its NULL terminator, may be NULL when Capacity is 0.
+     @param            Capacity                          The size of Destination in code units, including room for the NULL terminator.
+     @return                                             Returns the size of the normalized string in code units, not counting the NULL; Destination only holds the result when that is less than Capacity.
+     */
+    size_t             UTF16_NormalizeInto(PlatformIO_Immutable(UTF16 *) String, StringIO_NormalizationForms NormalizedForm, UTF16 *Destination, size_t Capacity);
+
+    /*!
+     @abstract                                           Normalizes a string into a buffer the caller owns.
+     @remark                                             Builds the result with the allocating version and copies it, so a temporary is still taken from the default TextIO_Arena when one is set, or the heap otherwise.
+     @param            String                            The NULL terminated string to be normalized.
+     @param            NormalizedForm                    The type of normalization to use on the String.
+     @param            Destination                       Where to write the normalized string and its NULL terminator, may be NULL when Capacity is 0.
+     @param            Capacity                          The size of Destination in code points, including room for the NULL terminator.
+     @return                                             Returns the size of the normalized string in code points, not counting the NULL; Destination only holds the result when that is less than Capacity.
+     */
+    size_t             UTF32_NormalizeInto(PlatformIO_Immutable(UTF32 *) String, StringIO_NormalizationForms NormalizedForm, UTF32 *Destination, size_t Capacity);
     /* TextIOTables Operations */
     
     /*!
@@ -1022,6 +1238,39 @@ extern "C" {
      @param            Integer2Convert                   The number to convert into a string.
      */
     UTF32             *UTF32_Integer2String(TextIO_Bases Base, int64_t Integer2Convert);
+
+    /*!
+     @abstract                                           Converts an integer to a string in a buffer the caller owns.
+     @remark                                             Formats the integer exactly like Integer2String, with a leading '-' only in base 10; the result never needs more than 65 code units.
+     @param            Base                              The base to output the integer in.
+     @param            Integer2Convert                   The number to convert into a string.
+     @param            Destination                       Where to write the string and its NULL terminator, may be NULL when Capacity is 0.
+     @param            Capacity                          The size of Destination in code units, including room for the NULL terminator.
+     @return                                             Returns the size of the string in code units, not counting the NULL; nothing is written when that is not less than Capacity.
+     */
+    size_t             UTF8_Integer2StringInto(TextIO_Bases Base, int64_t Integer2Convert, UTF8 *Destination, size_t Capacity);
+
+    /*!
+     @abstract                                           Converts an integer to a string in a buffer the caller owns.
+     @remark                                             Formats the integer exactly like Integer2String, with a leading '-' only in base 10; the result never needs more than 65 code units.
+     @param            Base                              The base to output the integer in.
+     @param            Integer2Convert                   The number to convert into a string.
+     @param            Destination                       Where to write the string and its NULL terminator, may be NULL when Capacity is 0.
+     @param            Capacity                          The size of Destination in code units, including room for the NULL terminator.
+     @return                                             Returns the size of the string in code units, not counting the NULL; nothing is written when that is not less than Capacity.
+     */
+    size_t             UTF16_Integer2StringInto(TextIO_Bases Base, int64_t Integer2Convert, UTF16 *Destination, size_t Capacity);
+
+    /*!
+     @abstract                                           Converts an integer to a string in a buffer the caller owns.
+     @remark                                             Formats the integer exactly like Integer2String, with a leading '-' only in base 10; the result never needs more than 65 code points.
+     @param            Base                              The base to output the integer in.
+     @param            Integer2Convert                   The number to convert into a string.
+     @param            Destination                       Where to write the string and its NULL terminator, may be NULL when Capacity is 0.
+     @param            Capacity                          The size of Destination in code points, including room for the NULL terminator.
+     @return                                             Returns the size of the string in code points, not counting the NULL; nothing is written when that is not less than Capacity.
+     */
+    size_t             UTF32_Integer2StringInto(TextIO_Bases Base, int64_t Integer2Convert, UTF32 *Destination, size_t Capacity);
     
     /*!
      @abstract                                           Converts a string to a double; replaces strtod, strtof, strold, atof, and atof_l.
@@ -1468,18 +1717,24 @@ extern "C" {
     
     /*!
      @abstract                                           Deletes String.
+     @remark                                             Strings that came from a TextIO_Arena are left for the arena to reclaim.
+     @remark                                             Every string from UTF8_Init, or a function that returns one, has to be released here; passing it to free() is invalid.
      @param            String                            The string to deinitialize.
      */
     void               UTF8_Deinit(UTF8 *String);
     
     /*!
      @abstract                                           Deletes String.
+     @remark                                             Strings that came from a TextIO_Arena are left for the arena to reclaim.
+     @remark                                             Every string from UTF16_Init, or a function that returns one, has to be released here; passing it to free() is invalid.
      @param            String                            The string to deinitialize.
      */
     void               UTF16_Deinit(UTF16 *String);
     
     /*!
      @abstract                                           Deletes String.
+     @remark                                             Strings that came from a TextIO_Arena are left for the arena to reclaim.
+     @remark                                             Every string from UTF32_Init, or a function that returns one, has to be released here; passing it to free() is invalid.
      @param            String                            The string to deinitialize.
      */
     void               UTF32_Deinit(UTF32 *String);
@@ -23,11 +23,40 @@
 #if __has_include(<sys/types.h>)
 #include <sys/types.h>
 #endif /* <sys/types.h> */
+#if __has_include(<sys/stat.h>)
+#include <sys/stat.h>                     /* Included for fstat, statx */
+#endif /* <sys/stat.h> */
+#if __has_include(<sys/ioctl.h>) && __has_include(<linux/fs.h>)
+#include <sys/ioctl.h>                    /* Included for ioctl */
+#include <linux/fs.h>                     /* Included for BLKSSZGET */
+#endif /* <linux/fs.h> */
 #if __has_include(<sys/epoll.h>)
 #include <sys/epoll.h>
 #endif /* <sys/epoll.h> */
+#if PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsLinux) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>               /* Included for io_uring_params, io_uring_sqe, io_uring_cqe */
+#include <poll.h>                         /* Included for poll, to wait on several rings at once */
+#include <sys/mman.h>                     /* Included for mmap, to map the rings */
+#include <sys/syscall.h>                  /* Included for __NR_io_uring_setup, __NR_io_uring_enter, __NR_io_uring_register */
+#define AsynchronousIO_HasIOURing         (1)
+#endif /* <linux/io_uring.h> */
+#if __has_include(<sys/uio.h>)
+#include <sys/uio.h>                      /* Included for iovec, preadv, pwritev, and RWF flags on Linux */
+#endif /* <sys/uio.h> */
+#if __has_include(<unistd.h>)
+#include <unistd.h>                       /* Included for close, syscall */
+#endif /* <unistd.h> */
 #endif /* __has_include */
 
+#include <errno.h>                        /* Included for EINTR, EINPROGRESS */
+#include <limits.h>                       /* Included for INT_MAX */
+#include <string.h>                       /* Included for memset */
+#include <time.h>                         /* Included for clock_gettime */
+
+#if PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+#include <pthread.h>                      /* Included for pthread_mutex_lock, pthread_cond_wait, for group commit */
+#endif /* PlatformIO_TargetOS */
+
 /*
  MacOS: KQueue for Networking, AIO for DiskIO
  */
@@ -35,44 +64,1184 @@
 #if PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
 // use IO Completion Ports
 #include <IOAPI.h>
+#include <io.h>                           /* Included for _get_osfhandle, _close */
+#include <windows.h>                      /* Included for ReadFile, WriteFile, OVERLAPPED */
 #endif /* Windows */
 
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
 extern "C" {
 #endif
 
+    typedef struct AsynchronousIO_Ring AsynchronousIO_Ring;
+
     typedef struct AsynchronousIOStream {
         size_t                         StreamPosition;
         ssize_t                        StreamSize;
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        pthread_mutex_t                SyncLock;
+        pthread_mutex_t                WriteBehindLock; // Held while the write-behind buffer is filled or flushed
+        pthread_cond_t                 SyncDone;
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        SRWLOCK                        SyncLock;
+        SRWLOCK                        WriteBehindLock;
+        CONDITION_VARIABLE             SyncDone;
+#endif /* PlatformIO_TargetOS */
+        uint64_t                       SyncsStarted;
+        uint64_t                       SyncsFinished;
+        uint64_t                       WriteBehindDeadline; // Milliseconds, the buffer is flushed by the first Write after it
+        uint8_t                       *WriteBehind;         // NULL when writes go straight out
+        size_t                         WriteBehindSize;
+        size_t                         WriteBehindFill;
+        size_t                         WriteBehindOffset;   // Where WriteBehind[0] goes in the file
+        AsynchronousIO_Ring           *Ring;
+        size_t                         Alignment; // FileMode_Direct's block size, 0 when the stream goes through the page cache
+        uint8_t                       *Bounce;    // AsynchronousIO_BounceSize bytes at Alignment, for direct transfers that aren't aligned
+        size_t                         ExpectedOffset;  // Where the next Read starts if the reader is sequential
+        size_t                         ReadaheadEnd;    // End of the window already asked for
+        size_t                         ReadaheadWindow; // Doubles while the reader stays sequential
+        uint32_t                       QueueDepth;
         AsynchronousIO_Descriptor      StreamID;
         AsynchronousIO_DescriptorTypes DescriptorType;
+        uint32_t                       WriteBehindInterval; // Milliseconds, 0 flushes on size alone
+        AsynchronousIO_Backends        Backend;
+        AsynchronousIO_AccessPatterns  AccessPattern;
+        bool                           IsSyncing;
+        bool                           SyncSucceeded;
+        bool                           IsBounceClaimed;
     } AsynchronousIOStream;
 
+    typedef enum AsynchronousIOConstants {
+        AsynchronousIO_DefaultQueueDepth = 64,
+        AsynchronousIO_MaxTransferSize   = 1024 * 1024 * 1024, // io_uring lengths are 32 bits, larger transfers are split
+        AsynchronousIO_MaxVectors        = 64,                 // iovecs per system call, well under every IOV_MAX
+        AsynchronousIO_DefaultAlignment  = 4096,               // When the device won't say, every logical block size in use divides it
+        AsynchronousIO_MinimumAlignment  = 64,                 // Cache line, for buffers from AsynchronousIOStream_AllocateAligned on buffered streams
+        AsynchronousIO_BounceSize        = 1024 * 1024,        // Largest unaligned direct transfer done in one go
+        AsynchronousIO_ReadaheadMinimum  = 128 * 1024,         // First readahead window once two reads in a row are sequential
+        AsynchronousIO_ReadaheadMaximum  = 8 * 1024 * 1024,    // The window stops doubling here
+        AsynchronousIO_WriteBehindBlock  = 4096,               // Write-behind buffers are whole blocks, and flushed on block boundaries
+        AsynchronousIO_PathBufferSize    = 512,                // Paths transcoded for open go on the stack up to this many code units
+        AsynchronousIO_RingRetries       = 8,                  // io_uring_enter attempts on transient errors before a stream gives up on its ring
+    } AsynchronousIOConstants;
+
+    /* Where a transfer's result lands, the ring's user_data points at it */
+    typedef struct AsynchronousIO_Completion {
+        AsynchronousIO_CompletionFunction Callback;
+        void                          *Context;
+        AsynchronousIO_Request        *Request; // NULL for the stream's own blocking transfers
+        ssize_t                        Result;  // Bytes transferred, or -errno
+        bool                           IsComplete;
+    } AsynchronousIO_Completion;
+
+    typedef struct AsynchronousIO_Request {
+        AsynchronousIO_Completion      Completion;
+#if PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        struct aiocb                   Async;
+#endif /* PlatformIO_TargetOS */
+        AsynchronousIOStream          *Stream;
+        void                          *Array;
+        size_t                         NumBytes;
+        size_t                         Offset;
+        AsynchronousIO_RequestTypes    Type;
+        AsynchronousIO_Backends        Backend; // The stream's backend when it was submitted, it can fall back from io_uring afterwards
+        bool                           IsSubmitted;
+    } AsynchronousIO_Request;
+
+    static void AsynchronousIO_Complete(AsynchronousIO_Completion *Completion, ssize_t Result) {
+        Completion->Result            = Result;
+        Completion->IsComplete        = Yes;
+        if (Completion->Callback != NULL) {
+            Completion->Callback(Completion->Request, Completion->Context);
+        }
+    }
+
+#ifdef AsynchronousIO_HasIOURing
+    /*
+     io_uring engine.
+
+     The submission and completion rings are mapped once, the stream's descriptor is registered as fixed file 0 so the kernel doesn't look it up on every request,
+     and transfers that land entirely inside a registered buffer use READ_FIXED/WRITE_FIXED so the pages aren't pinned on every request either.
+     Entries are filled at LocalTail and only published to the kernel by AsynchronousIO_Ring_Submit, so many can be queued with one io_uring_enter.
+     */
+    typedef struct AsynchronousIO_Ring {
+        struct io_uring_sqe           *Entries;
+        struct io_uring_cqe           *Completions;
+        uint32_t                      *SubmissionHead;
+        uint32_t                      *SubmissionTail;
+        uint32_t                      *SubmissionArray;
+        uint32_t                      *CompletionHead;
+        uint32_t                      *CompletionTail;
+        void                          *SubmissionMap;
+        void                          *CompletionMap;
+        struct iovec                  *Buffers;
+        size_t                         SubmissionMapSize;
+        size_t                         CompletionMapSize;
+        size_t                         EntriesMapSize;
+        uint32_t                       SubmissionMask;
+        uint32_t                       CompletionMask;
+        uint32_t                       NumEntries;
+        uint32_t                       LocalTail;
+        int                            RingID;
+        int                            FileIndex; // -1 when the descriptor couldn't be registered
+        uint16_t                       NumBuffers;
+    } AsynchronousIO_Ring;
+
+    static void AsynchronousIO_Ring_Deinit(AsynchronousIO_Ring *Ring) {
+        if (Ring->Entries != NULL && Ring->Entries != MAP_FAILED) {
+            munmap(Ring->Entries, Ring->EntriesMapSize);
+        }
+        if (Ring->CompletionMap != NULL && Ring->CompletionMap != MAP_FAILED && Ring->CompletionMap != Ring->SubmissionMap) {
+            munmap(Ring->CompletionMap, Ring->CompletionMapSize);
+        }
+        if (Ring->SubmissionMap != NULL && Ring->SubmissionMap != MAP_FAILED) {
+            munmap(Ring->SubmissionMap, Ring->SubmissionMapSize);
+        }
+        close(Ring->RingID);
+        free(Ring->Buffers);
+        free(Ring);
+    }
+
+    /* Returns NULL when the kernel doesn't have io_uring, or it's been disabled */
+    static AsynchronousIO_Ring *AsynchronousIO_Ring_Init(uint32_t QueueDepth, AsynchronousIO_Descriptor Descriptor) {
+        struct io_uring_params Parameters;
+        memset(&Parameters, 0, sizeof(Parameters));
+        int RingID                    = (int) syscall(__NR_io_uring_setup, QueueDepth, &Parameters);
+        if (RingID < 0) {
+            return NULL;
+        }
+        AsynchronousIO_Ring *Ring     = calloc(1, sizeof(AsynchronousIO_Ring));
+        AssertIO(Ring != NULL);
+        Ring->RingID                  = RingID;
+        Ring->SubmissionMapSize       = Parameters.sq_off.array + Parameters.sq_entries * sizeof(uint32_t);
+        Ring->CompletionMapSize       = Parameters.cq_off.cqes + Parameters.cq_entries * sizeof(struct io_uring_cqe);
+        Ring->EntriesMapSize          = Parameters.sq_entries * sizeof(struct io_uring_sqe);
+        if ((Parameters.features & IORING_FEAT_SINGLE_MMAP) == IORING_FEAT_SINGLE_MMAP) {
+            Ring->SubmissionMapSize   = Ring->SubmissionMapSize > Ring->CompletionMapSize ? Ring->SubmissionMapSize : Ring->CompletionMapSize;
+            Ring->CompletionMapSize   = Ring->SubmissionMapSize;
+        }
+        Ring->SubmissionMap           = mmap(NULL, Ring->SubmissionMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingID, IORING_OFF_SQ_RING);
+        if ((Parameters.features & IORING_FEAT_SINGLE_MMAP) == IORING_FEAT_SINGLE_MMAP) {
+            Ring->CompletionMap       = Ring->SubmissionMap;
+        } else {
+            Ring->CompletionMap       = mmap(NULL, Ring->CompletionMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingID, IORING_OFF_CQ_RING);
+        }
+        Ring->Entries                 = mmap(NULL, Ring->EntriesMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingID, IORING_OFF_SQES);
+        if (Ring->SubmissionMap == MAP_FAILED || Ring->CompletionMap == MAP_FAILED || Ring->Entries == MAP_FAILED) {
+            AsynchronousIO_Ring_Deinit(Ring);
+            return NULL;
+        }
+        uint8_t *Submission           = (uint8_t *) Ring->SubmissionMap;
+        uint8_t *Completion           = (uint8_t *) Ring->CompletionMap;
+        Ring->SubmissionHead          = (uint32_t *) &Submission[Parameters.sq_off.head];
+        Ring->SubmissionTail          = (uint32_t *) &Submission[Parameters.sq_off.tail];
+        Ring->SubmissionArray         = (uint32_t *) &Submission[Parameters.sq_off.array];
+        Ring->SubmissionMask          = *(uint32_t *) &Submission[Parameters.sq_off.ring_mask];
+        Ring->CompletionHead          = (uint32_t *) &Completion[Parameters.cq_off.head];
+        Ring->CompletionTail          = (uint32_t *) &Completion[Parameters.cq_off.tail];
+        Ring->CompletionMask          = *(uint32_t *) &Completion[Parameters.cq_off.ring_mask];
+        Ring->Completions             = (struct io_uring_cqe *) &Completion[Parameters.cq_off.cqes];
+        Ring->NumEntries              = Parameters.sq_entries;
+        Ring->LocalTail               = *Ring->SubmissionTail;
+        Ring->FileIndex               = syscall(__NR_io_uring_register, RingID, IORING_REGISTER_FILES, &Descriptor, 1) == 0 ? 0 : -1;
+        return Ring;
+    }
+
+    /* Publishes every queued entry, and waits until at least WaitFor completions are available */
+    static int AsynchronousIO_Ring_Submit(AsynchronousIO_Ring *Ring, uint32_t WaitFor) {
+        __atomic_store_n(Ring->SubmissionTail, Ring->LocalTail, __ATOMIC_RELEASE);
+        uint32_t ToSubmit             = Ring->LocalTail - __atomic_load_n(Ring->SubmissionHead, __ATOMIC_ACQUIRE);
+        int      Result               = 0;
+        do {
+            Result                    = (int) syscall(__NR_io_uring_enter, Ring->RingID, ToSubmit, WaitFor, WaitFor > 0 ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+        } while (Result < 0 && errno == EINTR);
+        return Result;
+    }
+
+    /* Returns a zeroed entry to fill in, submitting what's queued first if the ring is full */
+    static struct io_uring_sqe *AsynchronousIO_Ring_GetEntry(AsynchronousIO_Ring *Ring) {
+        if (Ring->LocalTail - __atomic_load_n(Ring->SubmissionHead, __ATOMIC_ACQUIRE) >= Ring->NumEntries) {
+            AsynchronousIO_Ring_Submit(Ring, 0);
+            if (Ring->LocalTail - __atomic_load_n(Ring->SubmissionHead, __ATOMIC_ACQUIRE) >= Ring->NumEntries) {
+                return NULL;
+            }
+        }
+        uint32_t Index                = Ring->LocalTail & Ring->SubmissionMask;
+        struct io_uring_sqe *Entry    = &Ring->Entries[Index];
+        memset(Entry, 0, sizeof(struct io_uring_sqe));
+        Ring->SubmissionArray[Index]  = Index;
+        Ring->LocalTail              += 1;
+        return Entry;
+    }
+
+    static void AsynchronousIO_Ring_PrepareTransfer(AsynchronousIO_Ring *Ring, struct io_uring_sqe *Entry, AsynchronousIO_Descriptor Descriptor, void *Array, size_t NumBytes, size_t Offset, bool IsWrite) {
+        int BufferIndex               = -1;
+        for (uint16_t Buffer = 0; Buffer < Ring->NumBuffers; Buffer++) {
+            uint8_t *Start            = (uint8_t *) Ring->Buffers[Buffer].iov_base;
+            if ((uint8_t *) Array >= Start && (uint8_t *) Array + NumBytes <= Start + Ring->Buffers[Buffer].iov_len) {
+                BufferIndex           = Buffer;
+                break;
+            }
+        }
+        if (BufferIndex >= 0) {
+            Entry->opcode             = IsWrite ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED;
+            Entry->buf_index          = (uint16_t) BufferIndex;
+        } else {
+            Entry->opcode             = IsWrite ? IORING_OP_WRITE : IORING_OP_READ;
+        }
+        if (Ring->FileIndex >= 0) {
+            Entry->fd                 = Ring->FileIndex;
+            Entry->flags              = IOSQE_FIXED_FILE;
+        } else {
+            Entry->fd                 = Descriptor;
+        }
+        Entry->off                    = Offset;
+        Entry->addr                   = (uint64_t) (uintptr_t) Array;
+        Entry->len                    = (uint32_t) NumBytes;
+    }
+
+    /*
+     Hands every available completion's result to the AsynchronousIO_Completion in its user_data, returns the number reaped.
+     The head is released before each callback runs, so a callback can poll or submit on the same ring.
+     */
+    static uint32_t AsynchronousIO_Ring_Reap(AsynchronousIO_Ring *Ring) {
+        uint32_t NumReaped            = 0;
+        uint32_t Head                 = *Ring->CompletionHead;
+        while (Head != __atomic_load_n(Ring->CompletionTail, __ATOMIC_ACQUIRE)) {
+            struct io_uring_cqe *Entry = &Ring->Completions[Head & Ring->CompletionMask];
+            AsynchronousIO_Completion *Completion = (AsynchronousIO_Completion *) (uintptr_t) Entry->user_data;
+            ssize_t              Result = Entry->res;
+            __atomic_store_n(Ring->CompletionHead, Head + 1, __ATOMIC_RELEASE);
+            if (Completion != NULL) {
+                AsynchronousIO_Complete(Completion, Result);
+            }
+            NumReaped                += 1;
+            Head                      = *Ring->CompletionHead;
+        }
+        return NumReaped;
+    }
+
+    /*
+     Takes back the entries from Position on that the kernel hasn't consumed, after io_uring_enter refused them, and completes each with -Error.
+     Without SQPOLL the kernel only reads the submission ring inside io_uring_enter, so pulling the tail back is safe.
+     Entries before Position, or ones the kernel already has, complete as usual; returns whether the entry at Position was unlinked.
+     */
+    static bool AsynchronousIO_Ring_Unlink(AsynchronousIO_Ring *Ring, uint32_t Position, int Error) {
+        uint32_t Head                 = __atomic_load_n(Ring->SubmissionHead, __ATOMIC_ACQUIRE);
+        uint32_t First                = (int32_t) (Position - Head) >= 0 ? Position : Head;
+        uint32_t Last                 = Ring->LocalTail;
+        Ring->LocalTail               = First;
+        __atomic_store_n(Ring->SubmissionTail, First, __ATOMIC_RELEASE);
+        for (uint32_t Unlinked = First; Unlinked != Last; Unlinked++) {
+            struct io_uring_sqe *Entry = &Ring->Entries[Ring->SubmissionArray[Unlinked & Ring->SubmissionMask]];
+            AsynchronousIO_Completion *Completion = (AsynchronousIO_Completion *) (uintptr_t) Entry->user_data;
+            if (Completion != NULL) {
+                AsynchronousIO_Complete(Completion, -Error);
+            }
+        }
+        return First == Position && First != Last;
+    }
+
+    /* io_uring_enter fails with these while the kernel is short of memory or the completion ring is backed up; older kernels fail with EINVAL for good */
+    static bool AsynchronousIO_Ring_IsTransient(int Error) {
+        return Error == ENOMEM || Error == EAGAIN || Error == EBUSY;
+    }
+
+    /*
+     Hands what's queued to the kernel, waiting for WaitFor completions; transient refusals are retried, reaping in between, AsynchronousIO_RingRetries times.
+     If the kernel still refuses, what was queued from Position on is unlinked and failed.
+     */
+    static bool AsynchronousIO_Ring_Publish(AsynchronousIO_Ring *Ring, uint32_t Position, uint32_t WaitFor) {
+        int Error                     = 0;
+        for (uint8_t Attempt = 0; Attempt < AsynchronousIO_RingRetries; Attempt++) {
+            if (AsynchronousIO_Ring_Submit(Ring, WaitFor) >= 0) {
+                return Yes;
+            }
+            Error                     = errno;
+            if (AsynchronousIO_Ring_IsTransient(Error) == No) {
+                break;
+            }
+            AsynchronousIO_Ring_Reap(Ring);
+        }
+        AsynchronousIO_Ring_Unlink(Ring, Position, Error);
+        return No;
+    }
+
+    /*
+     Submits Entry, which has to be the last one taken from the ring, and blocks until it's completed; returns No if the kernel wouldn't take it.
+     Entry points at a Completion on this stack frame, so once io_uring_enter has refused it AsynchronousIO_RingRetries times, or for good, it's unlinked.
+     If the kernel had already consumed it by then, its completion is waited for by watching the completion ring instead.
+     */
+    static bool AsynchronousIO_Ring_Run(AsynchronousIO_Ring *Ring, struct io_uring_sqe *Entry, ssize_t *Result) {
+        AsynchronousIO_Completion Completion = {.Result = 0, .IsComplete = No};
+        uint32_t                  Position   = Ring->LocalTail - 1;
+        uint8_t                   Refusals   = 0;
+        Entry->user_data              = (uint64_t) (uintptr_t) &Completion;
+        while (Completion.IsComplete == No) {
+            if (Refusals < AsynchronousIO_RingRetries) {
+                if (AsynchronousIO_Ring_Submit(Ring, 1) >= 0) {
+                    Refusals          = 0;
+                } else {
+                    int Error         = errno;
+                    Refusals          = AsynchronousIO_Ring_IsTransient(Error) ? Refusals + 1 : AsynchronousIO_RingRetries;
+                    if (Refusals == AsynchronousIO_RingRetries && AsynchronousIO_Ring_Unlink(Ring, Position, Error)) {
+                        return No;
+                    }
+                }
+            } else {
+                struct timespec Pause = {.tv_sec = 0, .tv_nsec = 50000};
+                nanosleep(&Pause, NULL);
+            }
+            AsynchronousIO_Ring_Reap(Ring);
+        }
+        *Result                       = Completion.Result;
+        return Yes;
+    }
+#endif /* AsynchronousIO_HasIOURing */
+
+    static void AsynchronousIOStream_SelectBackend(AsynchronousIOStream *Stream) {
+        if (Stream->Backend == Backend_Unspecified) {
+#ifdef AsynchronousIO_HasIOURing
+            Stream->Ring              = AsynchronousIO_Ring_Init(Stream->QueueDepth > 0 ? Stream->QueueDepth : AsynchronousIO_DefaultQueueDepth, Stream->StreamID);
+            if (Stream->Ring != NULL) {
+                Stream->Backend       = Backend_IOURing;
+                return;
+            }
+#endif /* AsynchronousIO_HasIOURing */
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+            Stream->Backend           = Backend_POSIXAIO;
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+            Stream->Backend           = Backend_Windows;
+#endif /* PlatformIO_TargetOS */
+        }
+    }
+
+#ifdef AsynchronousIO_HasIOURing
+    /* The kernel keeps refusing the stream's ring, so new transfers go through POSIX AIO; the ring stays until the backend is released, for requests already on it */
+    static void AsynchronousIOStream_AbandonRing(AsynchronousIOStream *Stream) {
+        Stream->Backend               = Backend_POSIXAIO;
+    }
+#endif /* AsynchronousIO_HasIOURing */
+
+    static void AsynchronousIOStream_ReleaseBackend(AsynchronousIOStream *Stream) {
+#ifdef AsynchronousIO_HasIOURing
+        if (Stream->Ring != NULL) {
+            AsynchronousIO_Ring_Deinit(Stream->Ring);
+            Stream->Ring              = NULL;
+        }
+#endif /* AsynchronousIO_HasIOURing */
+        AsynchronousIOStream_FreeAligned(Stream->Bounce); // Sized for the old descriptor's alignment
+        Stream->Bounce                = NULL;
+        Stream->Backend               = Backend_Unspecified;
+    }
+
+    /* Moves up to NumBytes at Offset with whichever backend the stream has, blocking until it's done; returns the bytes moved or -errno */
+    static ssize_t AsynchronousIOStream_Transfer(AsynchronousIOStream *Stream, void *Array, size_t NumBytes, size_t Offset, bool IsWrite) {
+        AsynchronousIOStream_SelectBackend(Stream);
+        ssize_t Result                = -1;
+#ifdef AsynchronousIO_HasIOURing
+        if (Stream->Backend == Backend_IOURing) {
+            struct io_uring_sqe *Entry = AsynchronousIO_Ring_GetEntry(Stream->Ring);
+            if (Entry != NULL) {
+                AsynchronousIO_Ring_PrepareTransfer(Stream->Ring, Entry, Stream->StreamID, Array, NumBytes, Offset, IsWrite);
+                if (AsynchronousIO_Ring_Run(Stream->Ring, Entry, &Result)) {
+                    return Result;
+                }
+                AsynchronousIOStream_AbandonRing(Stream);
+            }
+        }
+#endif /* AsynchronousIO_HasIOURing */
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        struct aiocb Async;
+        memset(&Async, 0, sizeof(Async));
+        Async.aio_fildes              = Stream->StreamID;
+        Async.aio_offset              = (off_t) Offset;
+        Async.aio_buf                 = Array;
+        Async.aio_nbytes              = NumBytes;
+        Async.aio_sigevent.sigev_notify = SIGEV_NONE;
+        if ((IsWrite ? aio_write(&Async) : aio_read(&Async)) == 0) {
+            const struct aiocb *Pending[1] = {&Async};
+            while (aio_error(&Async) == EINPROGRESS) {
+                aio_suspend(Pending, 1, NULL);
+            }
+            int Error                 = aio_error(&Async);
+            Result                    = aio_return(&Async);
+            Result                    = Result < 0 ? -Error : Result;
+        } else {
+            Result                    = -errno;
+        }
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        _lseeki64(Stream->StreamID, (__int64) Offset, SEEK_SET);
+        Result                        = IsWrite ? _write(Stream->StreamID, Array, (unsigned int) NumBytes) : _read(Stream->StreamID, Array, (unsigned int) NumBytes);
+        Result                        = Result < 0 ? -errno : Result;
+#endif /* PlatformIO_TargetOS */
+        return Result;
+    }
+
+    static void AsynchronousIOStream_LockSync(AsynchronousIOStream *Stream) {
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        pthread_mutex_lock(&Stream->SyncLock);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        AcquireSRWLockExclusive(&Stream->SyncLock);
+#endif /* PlatformIO_TargetOS */
+    }
+
+    static void AsynchronousIOStream_UnlockSync(AsynchronousIOStream *Stream) {
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        pthread_mutex_unlock(&Stream->SyncLock);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        ReleaseSRWLockExclusive(&Stream->SyncLock);
+#endif /* PlatformIO_TargetOS */
+    }
+
+    static void AsynchronousIOStream_LockWriteBehind(AsynchronousIOStream *Stream) {
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        pthread_mutex_lock(&Stream->WriteBehindLock);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        AcquireSRWLockExclusive(&Stream->WriteBehindLock);
+#endif /* PlatformIO_TargetOS */
+    }
+
+    static void AsynchronousIOStream_UnlockWriteBehind(AsynchronousIOStream *Stream) {
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        pthread_mutex_unlock(&Stream->WriteBehindLock);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        ReleaseSRWLockExclusive(&Stream->WriteBehindLock);
+#endif /* PlatformIO_TargetOS */
+    }
+
+    /*
+     Like AsynchronousIOStream_Transfer, but with pread/pwrite, which touch nothing in Stream, the descriptor's offset, or the ring;
+     so any number of threads can be in here on the same stream at once; on Windows they take turns, to put the file pointer back.
+     */
+    static ssize_t AsynchronousIOStream_TransferAt(AsynchronousIOStream *Stream, void *Array, size_t NumBytes, size_t Offset, bool IsWrite) {
+        ssize_t Result                = -1;
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        do {
+            Result                    = IsWrite ? pwrite(Stream->StreamID, Array, NumBytes, (off_t) Offset) : pread(Stream->StreamID, Array, NumBytes, (off_t) Offset);
+        } while (Result < 0 && errno == EINTR);
+        Result                        = Result < 0 ? -errno : Result;
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        HANDLE        File            = (HANDLE) _get_osfhandle(Stream->StreamID);
+        OVERLAPPED    Position        = {0};
+        DWORD         Moved           = 0;
+        LARGE_INTEGER Zero            = {0};
+        LARGE_INTEGER Saved           = {0};
+        Position.Offset               = (DWORD) (Offset & 0xFFFFFFFF);
+        Position.OffsetHigh           = (DWORD) ((uint64_t) Offset >> 32);
+        AsynchronousIOStream_LockSync(Stream); // A synchronous handle still moves its file pointer to the end of an OVERLAPPED transfer
+        SetFilePointerEx(File, Zero, &Saved, FILE_CURRENT);
+        if ((IsWrite ? WriteFile(File, Array, (DWORD) NumBytes, &Moved, &Position) : ReadFile(File, Array, (DWORD) NumBytes, &Moved, &Position)) || GetLastError() == ERROR_HANDLE_EOF) {
+            Result                    = (ssize_t) Moved;
+        }
+        SetFilePointerEx(File, Saved, NULL, FILE_BEGIN);
+        AsynchronousIOStream_UnlockSync(Stream);
+#endif /* PlatformIO_TargetOS */
+        return Result;
+    }
+
+    /* preadv2/pwritev2 flags, and io_uring's rw_flags, are the RWF_ values */
+    static int AsynchronousIO_VectorFlags_ToRWF(AsynchronousIO_VectorFlags Flags) {
+        int RWF                       = 0;
+#if defined(RWF_NOWAIT)
+        RWF                          |= (Flags & VectorFlag_HighPriority) ? RWF_HIPRI  : 0;
+        RWF                          |= (Flags & VectorFlag_DataSync)     ? RWF_DSYNC  : 0;
+        RWF                          |= (Flags & VectorFlag_Sync)         ? RWF_SYNC   : 0;
+        RWF                          |= (Flags & VectorFlag_NoWait)       ? RWF_NOWAIT : 0;
+#endif /* RWF_NOWAIT */
+        return RWF;
+    }
+
+    /* One vectored system call at Offset; returns the bytes moved or -errno */
+    static ssize_t AsynchronousIOStream_TransferVector(AsynchronousIOStream *Stream, struct iovec *Vectors, size_t NumVectors, size_t Offset, AsynchronousIO_VectorFlags Flags, bool IsWrite) {
+        AsynchronousIOStream_SelectBackend(Stream);
+        ssize_t Result                = -1;
+#ifdef AsynchronousIO_HasIOURing
+        if (Stream->Backend == Backend_IOURing) {
+            struct io_uring_sqe *Entry = AsynchronousIO_Ring_GetEntry(Stream->Ring);
+            if (Entry != NULL) {
+                Entry->opcode         = IsWrite ? IORING_OP_WRITEV : IORING_OP_READV;
+                if (Stream->Ring->FileIndex >= 0) {
+                    Entry->fd         = Stream->Ring->FileIndex;
+                    Entry->flags      = IOSQE_FIXED_FILE;
+                } else {
+                    Entry->fd         = Stream->StreamID;
+                }
+                Entry->off            = Offset;
+                Entry->addr           = (uint64_t) (uintptr_t) Vectors;
+                Entry->len            = (uint32_t) NumVectors;
+                Entry->rw_flags       = AsynchronousIO_VectorFlags_ToRWF(Flags);
+                if (AsynchronousIO_Ring_Run(Stream->Ring, Entry, &Result)) {
+                    return Result;
+                }
+                AsynchronousIOStream_AbandonRing(Stream);
+            }
+        }
+#endif /* AsynchronousIO_HasIOURing */
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+#if defined(RWF_NOWAIT)
+        Result                        = IsWrite ? pwritev2(Stream->StreamID, Vectors, (int) NumVectors, (off_t) Offset, AsynchronousIO_VectorFlags_ToRWF(Flags)) : preadv2(Stream->StreamID, Vectors, (int) NumVectors, (off_t) Offset, AsynchronousIO_VectorFlags_ToRWF(Flags));
+#else
+        Result                        = IsWrite ? pwritev(Stream->StreamID, Vectors, (int) NumVectors, (off_t) Offset) : preadv(Stream->StreamID, Vectors, (int) NumVectors, (off_t) Offset);
+        if (Result >= 0 && (Flags & (VectorFlag_DataSync | VectorFlag_Sync)) != 0 && IsWrite) {
+            fsync(Stream->StreamID);
+        }
+#endif /* RWF_NOWAIT */
+        Result                        = Result < 0 ? -errno : Result;
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        Result                        = 0;
+        for (size_t Vector = 0; Vector < NumVectors; Vector++) {
+            ssize_t Moved             = AsynchronousIOStream_Transfer(Stream, Vectors[Vector].iov_base, Vectors[Vector].iov_len, Offset + Result, IsWrite);
+            if (Moved <= 0) {
+                break;
+            }
+            Result                   += Moved;
+            if ((size_t) Moved < Vectors[Vector].iov_len) {
+                break;
+            }
+        }
+#endif /* PlatformIO_TargetOS */
+        return Result;
+    }
+
+    static void *AsynchronousIO_AllocateAligned(size_t Alignment, size_t NumBytes) {
+        void *Buffer                  = NULL;
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        if (posix_memalign(&Buffer, Alignment, NumBytes) != 0) {
+            Buffer                    = NULL;
+        }
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        Buffer                        = _aligned_malloc(NumBytes, Alignment);
+#endif /* PlatformIO_TargetOS */
+        return Buffer;
+    }
+
+    /* The stream's bounce buffer, allocated on first use; a thread that finds another one using it gets a buffer of its own */
+    static uint8_t *AsynchronousIOStream_ClaimBounce(AsynchronousIOStream *Stream) {
+        uint8_t *Bounce               = NULL;
+        AsynchronousIOStream_LockSync(Stream);
+        if (Stream->IsBounceClaimed == No) {
+            if (Stream->Bounce == NULL) {
+                Stream->Bounce        = AsynchronousIO_AllocateAligned(Stream->Alignment, AsynchronousIO_BounceSize);
+            }
+            Bounce                    = Stream->Bounce;
+            Stream->IsBounceClaimed   = Bounce != NULL;
+        }
+        AsynchronousIOStream_UnlockSync(Stream);
+        return Bounce != NULL ? Bounce : AsynchronousIO_AllocateAligned(Stream->Alignment, AsynchronousIO_BounceSize);
+    }
+
+    static void AsynchronousIOStream_ReturnBounce(AsynchronousIOStream *Stream, uint8_t *Bounce) {
+        if (Bounce == Stream->Bounce) {
+            AsynchronousIOStream_LockSync(Stream);
+            Stream->IsBounceClaimed   = No;
+            AsynchronousIOStream_UnlockSync(Stream);
+        } else {
+            AsynchronousIOStream_FreeAligned(Bounce);
+        }
+    }
+
+    /*
+     A direct write past the end of the file leaves it padded out to End; cut it back to NewEnd, but only while End is still the file's size,
+     so a write that has since gone further isn't cut off. Windows has no O_DIRECT, so nothing gets padded there.
+     */
+    static bool AsynchronousIOStream_TrimPadding(AsynchronousIOStream *Stream, size_t NewEnd, size_t End) {
+        bool Trimmed                  = Yes;
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        struct stat Status;
+        if (fstat(Stream->StreamID, &Status) != 0) {
+            Trimmed                   = No;
+        } else if ((size_t) Status.st_size == End) {
+            Trimmed                   = ftruncate(Stream->StreamID, (off_t) NewEnd) == 0;
+        }
+#endif /* PlatformIO_TargetOS */
+        return Trimmed;
+    }
+
+    /*
+     Direct IO only moves whole blocks from aligned memory. Aligned requests go straight through, at most the aligned part at a time;
+     anything else moves through the stream's bounce buffer covering the blocks around it. Writes read back the partial blocks at either edge first,
+     none at all when only the memory is unaligned, and trim the file back afterwards if the last block ran past its end.
+     Returns the bytes of Array moved, which can be fewer than NumBytes, or -errno.
+     Unaligned positional writes from several threads can still race each other on the blocks they share.
+     */
+    static ssize_t AsynchronousIOStream_TransferDirect(AsynchronousIOStream *Stream, void *Array, size_t NumBytes, size_t Offset, bool IsWrite, bool IsPositional) {
+        ssize_t (*Transfer)(AsynchronousIOStream *, void *, size_t, size_t, bool) = IsPositional ? AsynchronousIOStream_TransferAt : AsynchronousIOStream_Transfer;
+        size_t   Mask                 = Stream->Alignment - 1;
+        if (((uintptr_t) Array & Mask) == 0 && (Offset & Mask) == 0 && NumBytes > Mask) {
+            return Transfer(Stream, Array, NumBytes & ~Mask, Offset, IsWrite);
+        }
+        size_t   Start                = Offset & ~Mask;
+        size_t   Lead                 = Offset - Start;
+        size_t   Span                 = NumBytes < AsynchronousIO_BounceSize - Lead ? NumBytes : AsynchronousIO_BounceSize - Lead;
+        size_t   End                  = (Offset + Span + Mask) & ~Mask;
+        size_t   Last                 = End - Stream->Alignment; // Where the last block starts
+        uint8_t *Bounce               = AsynchronousIOStream_ClaimBounce(Stream);
+        if (Bounce == NULL) {
+            return -ENOMEM;
+        }
+        ssize_t  Result               = 0;
+        if (IsWrite == No) {
+            Result                    = Transfer(Stream, Bounce, End - Start, Start, No);
+            Result                    = Result < 0 ? Result : (size_t) Result > Lead ? (ssize_t) ((size_t) Result - Lead < Span ? (size_t) Result - Lead : Span) : 0;
+            if (Result > 0) {
+                memcpy(Array, &Bounce[Lead], (size_t) Result);
+            }
+        } else {
+            size_t FileEnd            = End; // Only read when the last block is partial
+            if (Lead > 0) {
+                Result                = Transfer(Stream, Bounce, Stream->Alignment, Start, No);
+                if (Result >= 0) {
+                    memset(&Bounce[Result], 0, Stream->Alignment - (size_t) Result);
+                    FileEnd           = Start + (size_t) Result;
+                }
+            }
+            if (Result >= 0 && Offset + Span < End && (Last > Start || Lead == 0)) {
+                Result                = Transfer(Stream, &Bounce[Last - Start], Stream->Alignment, Last, No);
+                if (Result >= 0) {
+                    memset(&Bounce[Last - Start + (size_t) Result], 0, Stream->Alignment - (size_t) Result);
+                    FileEnd           = Last + (size_t) Result;
+                }
+            }
+            if (Result >= 0) {
+                size_t NewEnd         = FileEnd > Offset + Span ? FileEnd : Offset + Span;
+                memcpy(&Bounce[Lead], Array, Span);
+                Result                = Transfer(Stream, Bounce, End - Start, Start, Yes);
+                if (Result >= 0 && NewEnd < End && AsynchronousIOStream_TrimPadding(Stream, NewEnd, End) == No) {
+                    Result            = -errno;
+                }
+                Result                = Result >= 0 ? (ssize_t) Span : Result;
+            }
+        }
+        AsynchronousIOStream_ReturnBounce(Stream, Bounce);
+        return Result;
+    }
+
+    /* Direct IO refuses memory, offsets and lengths off the stream's alignment; buffered streams take anything */
+    static bool AsynchronousIOStream_IsAligned(AsynchronousIOStream *Stream, const void *Array, size_t NumBytes, size_t Offset) {
+        size_t Mask                   = Stream->Alignment > 0 ? Stream->Alignment - 1 : 0;
+        return (((uintptr_t) Array | NumBytes | Offset) & Mask) == 0;
+    }
+
+    /* All of NumBytes at Offset through TransferDirect, for requests that can't go to the kernel as they are; returns the bytes moved, or -errno if none were */
+    static ssize_t AsynchronousIOStream_TransferDirectAll(AsynchronousIOStream *Stream, void *Array, size_t NumBytes, size_t Offset, bool IsWrite) {
+        uint8_t *Bytes                = (uint8_t *) Array;
+        size_t   Moved                = 0;
+        ssize_t  Result               = 0;
+        while (Moved < NumBytes) {
+            Result                    = AsynchronousIOStream_TransferDirect(Stream, &Bytes[Moved], NumBytes - Moved, Offset + Moved, IsWrite, Yes);
+            if (Result <= 0) {
+                break;
+            }
+            Moved                    += (size_t) Result;
+        }
+        return Moved == 0 && Result < 0 ? Result : (ssize_t) Moved;
+    }
+
+    /*
+     Walks Vectors in batches of AsynchronousIO_MaxVectors, picking up partway through a vector after a short transfer.
+     On FileMode_Direct streams a batch stops before the first vector direct IO would refuse, which then goes through TransferDirect on its own.
+     Returns the total number of bytes moved, and advances the stream's position by as much.
+     */
+    static size_t AsynchronousIOStream_TransferVectors(AsynchronousIOStream *Stream, const AsynchronousIO_Vector *Vectors, size_t NumVectors, AsynchronousIO_VectorFlags Flags, bool IsWrite) {
+        struct iovec Batch[AsynchronousIO_MaxVectors];
+        size_t       Vector           = 0;
+        size_t       VectorOffset     = 0; // Bytes of Vectors[Vector] already moved
+        size_t       Total            = 0;
+        while (Vector < NumVectors) {
+            size_t NumBatched         = 0;
+            bool   Bounce             = AsynchronousIOStream_IsAligned(Stream, NULL, 0, Stream->StreamPosition) == No;
+            for (size_t Next = Vector; Next < NumVectors && NumBatched < AsynchronousIO_MaxVectors; Next++) {
+                size_t   Skip         = Next == Vector ? VectorOffset : 0;
+                if (Vectors[Next].NumBytes > Skip) {
+                    uint8_t *Array    = (uint8_t *) Vectors[Next].Array + Skip;
+                    size_t   NumBytes = Vectors[Next].NumBytes - Skip;
+                    bool     Aligned  = AsynchronousIOStream_IsAligned(Stream, Array, NumBytes, 0);
+                    if (NumBatched > 0 && (Bounce || Aligned == No)) {
+                        break;
+                    }
+                    Bounce           |= Aligned == No;
+                    Batch[NumBatched].iov_base = Array;
+                    Batch[NumBatched].iov_len  = NumBytes;
+                    NumBatched       += 1;
+                }
+            }
+            if (NumBatched == 0) {
+                break; // Only empty vectors left
+            }
+            ssize_t Result            = 0;
+            if (Bounce) {
+                Result                = AsynchronousIOStream_TransferDirect(Stream, Batch[0].iov_base, Batch[0].iov_len, Stream->StreamPosition, IsWrite, No);
+            } else {
+                Result                = AsynchronousIOStream_TransferVector(Stream, Batch, NumBatched, Stream->StreamPosition, Flags, IsWrite);
+            }
+            if (Result <= 0) {
+                break;
+            }
+            Total                    += (size_t) Result;
+            Stream->StreamPosition   += (size_t) Result;
+            size_t Remaining          = (size_t) Result;
+            while (Vector < NumVectors && Remaining >= Vectors[Vector].NumBytes - VectorOffset) {
+                Remaining            -= Vectors[Vector].NumBytes - VectorOffset;
+                Vector               += 1;
+                VectorOffset          = 0;
+            }
+            VectorOffset             += Remaining;
+        }
+        return Total;
+    }
+
+    /* Works out the direct IO alignment of a freshly opened descriptor, from statx where the kernel reports it, else the block device's sector size */
+    static size_t AsynchronousIOStream_FindAlignment(AsynchronousIOStream *Stream) {
+        size_t Alignment              = AsynchronousIO_DefaultAlignment;
+#if defined(STATX_DIOALIGN)
+        struct statx Status;
+        if (statx(Stream->StreamID, "", AT_EMPTY_PATH, STATX_DIOALIGN, &Status) == 0 && (Status.stx_mask & STATX_DIOALIGN) != 0 && Status.stx_dio_offset_align > 0) {
+            Alignment                 = Status.stx_dio_offset_align > Status.stx_dio_mem_align ? Status.stx_dio_offset_align : Status.stx_dio_mem_align;
+            return Alignment;
+        }
+#endif /* STATX_DIOALIGN */
+#if defined(BLKSSZGET)
+        struct stat Information;
+        int         SectorSize        = 0;
+        if (fstat(Stream->StreamID, &Information) == 0 && S_ISBLK(Information.st_mode) && ioctl(Stream->StreamID, BLKSSZGET, &SectorSize) == 0 && SectorSize > 0) {
+            Alignment                 = (size_t) SectorSize;
+        }
+#endif /* BLKSSZGET */
+        return Alignment;
+    }
+
+    /* AsynchronousIO_FileModes describes what the caller wants, open and _wsopen want their own flags */
+    /* Write on its own, or with Create, replaces the file; Read | Write updates it in place */
+    static bool AsynchronousIO_FileModes_Truncates(AsynchronousIO_FileModes Mode) {
+        bool Writes                   = (Mode & FileMode_Write) == FileMode_Write;
+        bool Reads                    = (Mode & FileMode_Read) == FileMode_Read;
+        bool Creates                  = (Mode & FileMode_Create) == FileMode_Create;
+        return Writes && (Reads == No || Creates);
+    }
+
+    static int AsynchronousIO_FileModes_ToOpenFlags(AsynchronousIO_FileModes Mode) {
+        int Flags                     = 0;
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        bool Reads                    = (Mode & FileMode_Read) == FileMode_Read;
+        bool Writes                   = (Mode & (FileMode_Write | FileMode_Append)) != 0;
+        Flags                        |= Reads && Writes ? O_RDWR : Writes ? O_WRONLY : O_RDONLY;
+        Flags                        |= (Mode & FileMode_Create) == FileMode_Create ? O_CREAT : 0;
+        Flags                        |= (Mode & FileMode_Append) == FileMode_Append ? O_APPEND : AsynchronousIO_FileModes_Truncates(Mode) ? O_TRUNC : 0;
+#if defined(O_DIRECT)
+        Flags                        |= (Mode & FileMode_Direct) == FileMode_Direct ? O_DIRECT : 0;
+#endif /* O_DIRECT */
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        bool Reads                    = (Mode & FileMode_Read) == FileMode_Read;
+        bool Writes                   = (Mode & (FileMode_Write | FileMode_Append)) != 0;
+        Flags                        |= Reads && Writes ? _O_RDWR : Writes ? _O_WRONLY : _O_RDONLY;
+        Flags                        |= (Mode & FileMode_Create) == FileMode_Create ? _O_CREAT : 0;
+        Flags                        |= (Mode & FileMode_Append) == FileMode_Append ? _O_APPEND : AsynchronousIO_FileModes_Truncates(Mode) ? _O_TRUNC : 0;
+        Flags                        |= (Mode & FileMode_Text) == FileMode_Text ? _O_TEXT : _O_BINARY;
+#endif /* PlatformIO_TargetOS */
+        return Flags;
+    }
+
+    /* Asks the OS to start loading [Offset, Offset + NumBytes) into the page cache without waiting for it; NumBytes = 0 runs to the end of the file */
+    static bool AsynchronousIOStream_Prefetch(AsynchronousIOStream *Stream, size_t Offset, size_t NumBytes) {
+        bool Accepted                 = No;
+#ifdef AsynchronousIO_HasIOURing
+        if (Stream->Backend == Backend_IOURing && NumBytes <= UINT32_MAX) { // The entry's length is 32 bits, longer ranges take the system call
+            struct io_uring_sqe *Entry = AsynchronousIO_Ring_GetEntry(Stream->Ring);
+            if (Entry != NULL) { // No completion record, the reaper drops its result
+                Entry->opcode         = IORING_OP_FADVISE;
+                Entry->fd             = Stream->StreamID;
+                Entry->off            = Offset;
+                Entry->len            = (uint32_t) NumBytes;
+                Entry->fadvise_advice = POSIX_FADV_WILLNEED;
+                if (AsynchronousIO_Ring_Publish(Stream->Ring, Stream->Ring->LocalTail - 1, 0)) {
+                    return Yes;
+                }
+                AsynchronousIOStream_AbandonRing(Stream);
+            }
+        }
+#endif /* AsynchronousIO_HasIOURing */
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsLinux)
+        Accepted                      = NumBytes > 0 && readahead(Stream->StreamID, (off64_t) Offset, NumBytes) == 0; // Older kernels read nothing for 0
+#endif /* PlatformIO_TargetOS */
+#if   defined(POSIX_FADV_WILLNEED)
+        Accepted                      = Accepted || posix_fadvise(Stream->StreamID, (off_t) Offset, (off_t) NumBytes, POSIX_FADV_WILLNEED) == 0;
+#elif defined(F_RDADVISE)
+        AsynchronousIOStream_FindSize(Stream);
+        size_t End                    = NumBytes > 0 ? Offset + NumBytes : (Stream->StreamSize > 0 ? (size_t) Stream->StreamSize : Offset);
+        size_t Count                  = 0;
+        Accepted                      = End > Offset;
+        for (size_t Start = Offset; Start < End && Accepted; Start += Count) { // ra_count is an int
+            Count                     = End - Start < INT_MAX ? End - Start : INT_MAX;
+            struct radvisory Advisory = {.ra_offset = (off_t) Start, .ra_count = (int) Count};
+            Accepted                  = fcntl(Stream->StreamID, F_RDADVISE, &Advisory) != -1;
+        }
+#endif /* POSIX_FADV_WILLNEED */
+        return Accepted;
+    }
+
+    /*
+     Sequential detector.
+
+     A Read that starts where the last one ended is sequential; from the second one in a row the window ahead of the reader is kept prefetched,
+     topping it up when the reader gets within half a window of its end, and doubling it each time up to AsynchronousIO_ReadaheadMaximum.
+     A seek anywhere else shrinks the window back down. AccessPattern_Random turns it off, AccessPattern_Sequential starts at the largest window.
+     */
+    static void AsynchronousIOStream_DetectSequential(AsynchronousIOStream *Stream, size_t Offset, size_t NumBytes) {
+        if (Stream->AccessPattern == AccessPattern_Random || Stream->Alignment > 0 || Stream->DescriptorType != DescriptorType_File) {
+            return;
+        }
+        bool IsSequential             = Offset == Stream->ExpectedOffset && Offset > 0;
+        Stream->ExpectedOffset        = Offset + NumBytes;
+        if (IsSequential == No && Stream->AccessPattern != AccessPattern_Sequential) {
+            Stream->ReadaheadWindow   = 0;
+            Stream->ReadaheadEnd      = 0;
+            return;
+        }
+        if (Stream->ReadaheadWindow == 0) {
+            Stream->ReadaheadWindow   = Stream->AccessPattern == AccessPattern_Sequential ? AsynchronousIO_ReadaheadMaximum : AsynchronousIO_ReadaheadMinimum;
+        }
+        size_t ReadEnd                = Offset + NumBytes;
+        if (ReadEnd + (Stream->ReadaheadWindow / 2) >= Stream->ReadaheadEnd) {
+            size_t Start              = Stream->ReadaheadEnd > ReadEnd ? Stream->ReadaheadEnd : ReadEnd;
+            size_t End                = ReadEnd + Stream->ReadaheadWindow;
+            if (Stream->StreamSize > 0 && End > (size_t) Stream->StreamSize) {
+                End                   = (size_t) Stream->StreamSize;
+            }
+            if (End > Start) {
+                AsynchronousIOStream_Prefetch(Stream, Start, End - Start);
+                Stream->ReadaheadEnd  = End;
+            }
+            if (Stream->ReadaheadWindow < AsynchronousIO_ReadaheadMaximum) {
+                Stream->ReadaheadWindow *= 2;
+            }
+        }
+    }
+
+    /* fstat leaves the descriptor's offset alone, unlike seeking to the end and back */
+    static void AsynchronousIOStream_FindSize(AsynchronousIOStream *Stream) {
+        AssertIO(Stream != NULL);
+
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        struct stat Information;
+        if (fstat(Stream->StreamID, &Information) == 0) {
+            Stream->StreamSize        = S_ISREG(Information.st_mode) ? (ssize_t) Information.st_size : 0;
+            if (S_ISREG(Information.st_mode) || S_ISBLK(Information.st_mode)) {
+                Stream->DescriptorType = DescriptorType_File;
+            } else if (S_ISFIFO(Information.st_mode)) {
+                Stream->DescriptorType = DescriptorType_Pipe;
+            } else if (S_ISSOCK(Information.st_mode)) {
+                Stream->DescriptorType = DescriptorType_Socket;
+            }
+        }
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        struct _stati64 Information;
+        if (_fstati64(Stream->StreamID, &Information) == 0) {
+            Stream->StreamSize        = (ssize_t) Information.st_size;
+        }
+#endif /* PlatformIO_TargetOS */
+    }
+
+    static bool AsynchronousIOStream_FinishOpening(AsynchronousIOStream *Stream, AsynchronousIO_FileModes Mode) {
+        if (Stream->StreamID < 0) {
+            return No;
+        }
+        Stream->DescriptorType        = DescriptorType_File;
+        Stream->Alignment             = 0;
+        AsynchronousIOStream_FindSize(Stream);
+        if ((Mode & FileMode_Direct) == FileMode_Direct) {
+#if   defined(O_DIRECT)
+            Stream->Alignment         = AsynchronousIOStream_FindAlignment(Stream);
+#elif defined(F_NOCACHE)
+            fcntl(Stream->StreamID, F_NOCACHE, 1); // Apple has no alignment rules for uncached IO
+#endif /* O_DIRECT */
+        }
+        return Yes;
+    }
+
+    static uint64_t AsynchronousIO_GetMilliseconds(void) {
+        uint64_t Milliseconds         = 0;
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        struct timespec Now;
+        clock_gettime(CLOCK_MONOTONIC, &Now);
+        Milliseconds                  = ((uint64_t) Now.tv_sec * 1000ULL) + ((uint64_t) Now.tv_nsec / 1000000ULL);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        Milliseconds                  = GetTickCount64();
+#endif /* PlatformIO_TargetOS */
+        return Milliseconds;
+    }
+
+    /* Writes NumBytes at Offset, splitting it up as needed; doesn't touch the position or the write-behind buffer */
+    static size_t AsynchronousIOStream_WriteThrough(AsynchronousIOStream *Stream, uint8_t *Bytes, size_t NumBytes, size_t Offset) {
+        size_t BytesWritten           = 0;
+        while (BytesWritten < NumBytes) {
+            size_t  Chunk             = NumBytes - BytesWritten < AsynchronousIO_MaxTransferSize ? NumBytes - BytesWritten : AsynchronousIO_MaxTransferSize;
+            ssize_t Result            = Stream->Alignment > 0 ? AsynchronousIOStream_TransferDirect(Stream, &Bytes[BytesWritten], Chunk, Offset + BytesWritten, Yes, No) : AsynchronousIOStream_Transfer(Stream, &Bytes[BytesWritten], Chunk, Offset + BytesWritten, Yes);
+            if (Result <= 0) {
+                break;
+            }
+            BytesWritten             += (size_t) Result;
+        }
+        return BytesWritten;
+    }
+
+    /* Flush with WriteBehindLock held; whatever didn't make it out stays in the buffer, moved up to the front, for the next Flush to retry */
+    static bool AsynchronousIOStream_FlushHeld(AsynchronousIOStream *Stream) {
+        bool   Flushed                = Yes;
+        if (Stream->WriteBehindFill > 0) {
+            size_t Written            = AsynchronousIOStream_WriteThrough(Stream, Stream->WriteBehind, Stream->WriteBehindFill, Stream->WriteBehindOffset);
+            Flushed                   = Written == Stream->WriteBehindFill;
+            if (Flushed == No && Written > 0) {
+                memmove(Stream->WriteBehind, &Stream->WriteBehind[Written], Stream->WriteBehindFill - Written);
+            }
+            Stream->WriteBehindOffset += Written;
+            Stream->WriteBehindFill  -= Written;
+        }
+        return Flushed;
+    }
+
+    /*
+     Write-behind.
+
+     Writes that continue where the buffer ends are copied into it, and it goes out in one write when it fills up, when the first Write after
+     the interval finds it still holding data, or on Flush, Sync, Read, or Deinit. A buffer that starts partway into a block only takes up to
+     the next multiple of its size, so every flush after the first lands on block boundaries. A Write somewhere else flushes the buffer first;
+     one at least as big as the whole buffer skips it. When a flush fails the data stays in the buffer and the Write comes up short.
+     */
+    static size_t AsynchronousIOStream_WriteBehind(AsynchronousIOStream *Stream, uint8_t *Bytes, size_t NumBytes) {
+        AsynchronousIOStream_LockWriteBehind(Stream);
+        if (Stream->WriteBehindFill > 0 && Stream->StreamPosition != Stream->WriteBehindOffset + Stream->WriteBehindFill && AsynchronousIOStream_FlushHeld(Stream) == No) {
+            AsynchronousIOStream_UnlockWriteBehind(Stream);
+            return 0; // The buffer still holds data for somewhere else
+        }
+        size_t BytesWritten           = 0;
+        while (BytesWritten < NumBytes) {
+            size_t Remaining          = NumBytes - BytesWritten;
+            if (Stream->WriteBehindFill == 0 && Remaining >= Stream->WriteBehindSize) {
+                size_t Written        = AsynchronousIOStream_WriteThrough(Stream, &Bytes[BytesWritten], Remaining, Stream->StreamPosition);
+                BytesWritten         += Written;
+                Stream->StreamPosition += Written;
+                break;
+            }
+            if (Stream->WriteBehindFill == 0) {
+                Stream->WriteBehindOffset   = Stream->StreamPosition;
+                Stream->WriteBehindDeadline = AsynchronousIO_GetMilliseconds() + Stream->WriteBehindInterval;
+            }
+            size_t Limit              = Stream->WriteBehindSize - (Stream->WriteBehindOffset % Stream->WriteBehindSize);
+            size_t Bytes2Copy         = Remaining < Limit - Stream->WriteBehindFill ? Remaining : Limit - Stream->WriteBehindFill;
+            memcpy(&Stream->WriteBehind[Stream->WriteBehindFill], &Bytes[BytesWritten], Bytes2Copy);
+            Stream->WriteBehindFill  += Bytes2Copy;
+            Stream->StreamPosition   += Bytes2Copy;
+            BytesWritten             += Bytes2Copy;
+            if (Stream->WriteBehindFill == Limit && AsynchronousIOStream_FlushHeld(Stream) == No) {
+                break;
+            }
+        }
+        if (Stream->WriteBehindFill > 0 && Stream->WriteBehindInterval > 0 && AsynchronousIO_GetMilliseconds() >= Stream->WriteBehindDeadline) {
+            AsynchronousIOStream_FlushHeld(Stream);
+        }
+        AsynchronousIOStream_UnlockWriteBehind(Stream);
+        return BytesWritten;
+    }
+
     /* AsynchronousIOStream */
     AsynchronousIOStream *AsynchronousIOStream_Init(void) {
         AsynchronousIOStream *Stream = calloc(1, sizeof(AsynchronousIOStream));
+        AssertIO(Stream != NULL);
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        pthread_mutex_init(&Stream->SyncLock, NULL);
+        pthread_mutex_init(&Stream->WriteBehindLock, NULL);
+        pthread_cond_init(&Stream->SyncDone, NULL);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        InitializeSRWLock(&Stream->SyncLock);
+        InitializeSRWLock(&Stream->WriteBehindLock);
+        InitializeConditionVariable(&Stream->SyncDone);
+#endif /* PlatformIO_TargetOS */
         return Stream;
     }
 
-    AsynchronousIO_Descriptor AsynchronousIOStream_GetDescriptor(AsynchronousIOStream *Stream) {
-        return Stream->StreamID;
+    void AsynchronousIOStream_SetWriteBehind(AsynchronousIOStream *Stream, size_t BufferSize, uint32_t FlushInterval) {
+        AssertIO(Stream != NULL);
+
+        AsynchronousIOStream_Flush(Stream);
+        AsynchronousIOStream_FreeAligned(Stream->WriteBehind);
+        Stream->WriteBehind           = NULL;
+        Stream->WriteBehindFill       = 0;
+        Stream->WriteBehindSize       = 0;
+        Stream->WriteBehindInterval   = FlushInterval;
+        if (BufferSize > 0) {
+            size_t Block              = Stream->Alignment > AsynchronousIO_WriteBehindBlock ? Stream->Alignment : AsynchronousIO_WriteBehindBlock;
+            Stream->WriteBehindSize   = (BufferSize + (Block - 1)) & ~(Block - 1);
+            Stream->WriteBehind       = AsynchronousIO_AllocateAligned(Block, Stream->WriteBehindSize);
+            AssertIO(Stream->WriteBehind != NULL);
+        }
     }
 
-    static void AsynchronousIOStream_FindSize(AsynchronousIOStream *Stream) {
+    bool AsynchronousIOStream_Flush(AsynchronousIOStream *Stream) {
+        AssertIO(Stream != NULL);
+
+        AsynchronousIOStream_LockWriteBehind(Stream);
+        bool Flushed                  = AsynchronousIOStream_FlushHeld(Stream);
+        AsynchronousIOStream_UnlockWriteBehind(Stream);
+        return Flushed;
+    }
+
+    /*
+     Group commit: a Sync only has to wait for one fdatasync that started after it was called.
+     If one is already running the caller waits for it to finish then, unless another waiter beat it to it, starts the next one;
+     everyone who arrived during a sync shares the one after it.
+     */
+    bool AsynchronousIOStream_Sync(AsynchronousIOStream *Stream) {
+        AssertIO(Stream != NULL);
+
+        bool Synced                   = AsynchronousIOStream_Flush(Stream);
+        AsynchronousIOStream_LockSync(Stream);
+        uint64_t Needed               = Stream->SyncsStarted + 1;
+        while (Stream->SyncsFinished < Needed) {
+            if (Stream->IsSyncing == No) {
+                Stream->IsSyncing     = Yes;
+                Stream->SyncsStarted += 1;
+                AsynchronousIOStream_UnlockSync(Stream);
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsLinux)
+                bool Succeeded        = fdatasync(Stream->StreamID) == 0;
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+                bool Succeeded        = fsync(Stream->StreamID) == 0;
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+                bool Succeeded        = _commit(Stream->StreamID) == 0;
+#endif /* PlatformIO_TargetOS */
+                AsynchronousIOStream_LockSync(Stream);
+                Stream->SyncSucceeded = Succeeded;
+                Stream->SyncsFinished = Stream->SyncsStarted;
+                Stream->IsSyncing     = No;
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+                pthread_cond_broadcast(&Stream->SyncDone);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+                WakeAllConditionVariable(&Stream->SyncDone);
+#endif /* PlatformIO_TargetOS */
+            } else {
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+                pthread_cond_wait(&Stream->SyncDone, &Stream->SyncLock);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+                SleepConditionVariableSRW(&Stream->SyncDone, &Stream->SyncLock, INFINITE, 0);
+#endif /* PlatformIO_TargetOS */
+            }
+        }
+        Synced                       &= Stream->SyncSucceeded;
+        AsynchronousIOStream_UnlockSync(Stream);
+        return Synced;
+    }
+
+    AsynchronousIO_Backends AsynchronousIOStream_GetBackend(AsynchronousIOStream *Stream) {
+        AssertIO(Stream != NULL);
+
+        AsynchronousIOStream_SelectBackend(Stream);
+        return Stream->Backend;
+    }
+
+    void AsynchronousIOStream_SetQueueDepth(AsynchronousIOStream *Stream, uint32_t QueueDepth) {
+        AssertIO(Stream != NULL);
+        AssertIO(QueueDepth > 0);
+
+        AsynchronousIOStream_ReleaseBackend(Stream);
+        Stream->QueueDepth            = QueueDepth;
+    }
+
+    bool AsynchronousIOStream_RegisterBuffers(AsynchronousIOStream *Stream, void *const *Buffers, const size_t *BufferSizes, uint16_t NumBuffers) {
+        AssertIO(Stream != NULL);
+        AssertIO(Buffers != NULL || NumBuffers == 0);
+        AssertIO(BufferSizes != NULL || NumBuffers == 0);
+
+        bool Registered               = No;
+        AsynchronousIOStream_SelectBackend(Stream);
+#ifdef AsynchronousIO_HasIOURing
+        if (Stream->Backend == Backend_IOURing) {
+            AsynchronousIO_Ring *Ring = Stream->Ring;
+            if (Ring->NumBuffers > 0) {
+                syscall(__NR_io_uring_register, Ring->RingID, IORING_UNREGISTER_BUFFERS, NULL, 0);
+                free(Ring->Buffers);
+                Ring->Buffers         = NULL;
+                Ring->NumBuffers      = 0;
+            }
+            if (NumBuffers > 0) {
+                Ring->Buffers         = calloc(NumBuffers, sizeof(struct iovec));
+                AssertIO(Ring->Buffers != NULL);
+                for (uint16_t Buffer = 0; Buffer < NumBuffers; Buffer++) {
+                    Ring->Buffers[Buffer].iov_base = Buffers[Buffer];
+                    Ring->Buffers[Buffer].iov_len  = BufferSizes[Buffer];
+                }
+                if (syscall(__NR_io_uring_register, Ring->RingID, IORING_REGISTER_BUFFERS, Ring->Buffers, NumBuffers) == 0) {
+                    Ring->NumBuffers  = NumBuffers;
+                    Registered        = Yes;
+                } else {
+                    free(Ring->Buffers);
+                    Ring->Buffers     = NULL;
+                }
+            } else {
+                Registered            = Yes;
+            }
+        }
+#endif /* AsynchronousIO_HasIOURing */
+        return Registered;
+    }
+
+    size_t AsynchronousIOStream_GetAlignment(AsynchronousIOStream *Stream) {
+        AssertIO(Stream != NULL);
+
+        return Stream->Alignment;
+    }
+
+    void *AsynchronousIOStream_AllocateAligned(AsynchronousIOStream *Stream, size_t NumBytes) {
         AssertIO(Stream != NULL);
-        AssertIO(Stream->StreamSize > 0);
-        AssertIO(PlatformIO_Is(Stream->DescriptorType, DescriptorType_File));
+        AssertIO(NumBytes > 0);
+
+        size_t Alignment              = Stream->Alignment > AsynchronousIO_MinimumAlignment ? Stream->Alignment : AsynchronousIO_MinimumAlignment;
+        size_t Rounded                = (NumBytes + (Alignment - 1)) & ~(Alignment - 1);
+        return AsynchronousIO_AllocateAligned(Alignment, Rounded);
+    }
 
-        ssize_t OriginalPosition  = lseek(Stream->StreamID, 0, SEEK_CUR);
+    void AsynchronousIOStream_FreeAligned(void *Buffer) {
 #if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
-        Stream->StreamSize        = lseek(Stream->StreamID, 0, SEEK_END);
-        lseek(Stream->StreamID, OriginalPosition, SEEK_SET);
+        free(Buffer);
 #elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
-        Stream->StreamSize        = _lseeki64(Stream->StreamID, 0, SEEK_END);
-        _lseeki64(Stream->StreamID, OriginalPosition, SEEK_SET);
+        _aligned_free(Buffer);
 #endif /* PlatformIO_TargetOS */
     }
 
+    bool AsynchronousIOStream_Advise(AsynchronousIOStream *Stream, AsynchronousIO_AccessPatterns AccessPattern, size_t Offset, size_t NumBytes) {
+        AssertIO(Stream != NULL);
+        AssertIO(AccessPattern != AccessPattern_Unspecified);
+
+        bool Accepted                 = No;
+        if (AccessPattern == AccessPattern_Normal || AccessPattern == AccessPattern_Sequential || AccessPattern == AccessPattern_Random) {
+            Stream->AccessPattern     = AccessPattern;
+            Stream->ReadaheadWindow   = 0;
+            Stream->ReadaheadEnd      = 0;
+        }
+        if (AccessPattern == AccessPattern_WillNeed) {
+            AsynchronousIOStream_SelectBackend(Stream);
+            return AsynchronousIOStream_Prefetch(Stream, Offset, NumBytes);
+        }
+#if   defined(POSIX_FADV_NORMAL)
+        int Advice                    = POSIX_FADV_NORMAL;
+        if (AccessPattern == AccessPattern_Sequential) {
+            Advice                    = POSIX_FADV_SEQUENTIAL;
+        } else if (AccessPattern == AccessPattern_Random) {
+            Advice                    = POSIX_FADV_RANDOM;
+        } else if (AccessPattern == AccessPattern_DontNeed) {
+            Advice                    = POSIX_FADV_DONTNEED;
+        }
+        Accepted                      = posix_fadvise(Stream->StreamID, (off_t) Offset, (off_t) NumBytes, Advice) == 0; // NumBytes = 0 runs to the end of the file
+#elif defined(F_RDAHEAD)
+        if (AccessPattern != AccessPattern_DontNeed) {
+            Accepted                  = fcntl(Stream->StreamID, F_RDAHEAD, AccessPattern == AccessPattern_Random ? 0 : 1) != -1;
+        }
+#endif /* POSIX_FADV_NORMAL */
+        return Accepted;
+    }
+
+    AsynchronousIO_Descriptor AsynchronousIOStream_GetDescriptor(AsynchronousIOStream *Stream) {
+        return Stream->StreamID;
+    }
+
     size_t AsynchronousIOStream_GetSize(AsynchronousIOStream *Stream) {
         AssertIO(Stream != NULL);
 
@@ -97,7 +1266,17 @@ extern "C" {
     void AsynchronousIOStream_SetDescriptor(AsynchronousIOStream *Stream, AsynchronousIO_Descriptor Descriptor) {
         AssertIO(Stream != NULL);
 
-        Stream->StreamID = Descriptor;
+        AsynchronousIOStream_Flush(Stream);
+        AsynchronousIOStream_ReleaseBackend(Stream); // The ring registered the old descriptor
+        Stream->StreamID  = Descriptor;
+        Stream->Alignment = 0;
+        AsynchronousIOStream_FindSize(Stream);
+#if defined(O_DIRECT)
+        int Flags         = fcntl(Descriptor, F_GETFL);
+        if (Flags >= 0 && (Flags & O_DIRECT) == O_DIRECT) {
+            Stream->Alignment = AsynchronousIOStream_FindAlignment(Stream);
+        }
+#endif /* O_DIRECT */
     }
 
     void AsynchronousIOStream_SetPosition(AsynchronousIOStream *Stream, size_t Position) {
@@ -111,6 +1290,7 @@ extern "C" {
         AssertIO(Path8 != NULL);
         AssertIO(Mode != FileMode_Unspecified);
 
+        AsynchronousIOStream_ReleaseBackend(Stream);
         bool OpenedSucessfully   = No;
         size_t Path8Offset   = 0;
         bool Path8HasBOM     = UTF8_HasBOM(Path8);
@@ -119,15 +1299,22 @@ extern "C" {
         }
 #if    PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
 #ifdef PlatformIO_AnnexK
-        Stream->StreamID     = open_s((const char*) &Path8[Path8Offset], Mode);
+        Stream->StreamID     = open_s((const char*) &Path8[Path8Offset], AsynchronousIO_FileModes_ToOpenFlags(Mode), 0644);
 #else
-        Stream->StreamID     = open((const char*) &Path8[Path8Offset], Mode);
+        Stream->StreamID     = open((const char*) &Path8[Path8Offset], AsynchronousIO_FileModes_ToOpenFlags(Mode), 0644);
 #endif /* PlatformIO_AnnexK */
 #elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
-        UTF16 *Path16        = UTF8_Convert(&Path8[Path8Offset]);
-        Stream->StreamID     = _wsopen((const wchar_t*) Path16, Mode, _SH_DENYNO, _S_IREAD | _S_IWRITE);
-        UTF16_Deinit(Path16);
+        UTF16  Path16Buffer[AsynchronousIO_PathBufferSize];
+        UTF16 *Path16        = Path16Buffer;
+        if (UTF8_ConvertInto(&Path8[Path8Offset], Path16Buffer, AsynchronousIO_PathBufferSize) >= AsynchronousIO_PathBufferSize) {
+            Path16           = UTF8_Convert(&Path8[Path8Offset]);
+        }
+        Stream->StreamID     = _wsopen((const wchar_t*) Path16, AsynchronousIO_FileModes_ToOpenFlags(Mode), _SH_DENYNO, _S_IREAD | _S_IWRITE);
+        if (Path16 != Path16Buffer) {
+            UTF16_Deinit(Path16);
+        }
 #endif
+        OpenedSucessfully    = AsynchronousIOStream_FinishOpening(Stream, Mode);
         return OpenedSucessfully;
     }
 
@@ -136,6 +1323,7 @@ extern "C" {
         AssertIO(Path16 != NULL);
         AssertIO(Mode != FileMode_Unspecified);
 
+        AsynchronousIOStream_ReleaseBackend(Stream);
         bool OpenedSucessfully   = No;
         size_t Path16Offset   = 0;
         bool Path16HasBOM     = UTF16_HasBOM(Path16);
@@ -143,16 +1331,23 @@ extern "C" {
             Path16Offset      = UTF16BOMSizeInCodeUnits;
         }
 #if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
-        UTF8 *Path8          = UTF16_Convert(&Path16[Path16Offset]);
+        UTF8  Path8Buffer[AsynchronousIO_PathBufferSize];
+        UTF8 *Path8          = Path8Buffer;
+        if (UTF16_ConvertInto(&Path16[Path16Offset], Path8Buffer, AsynchronousIO_PathBufferSize) >= AsynchronousIO_PathBufferSize) {
+            Path8            = UTF16_Convert(&Path16[Path16Offset]);
+        }
 #ifdef PlatformIO_AnnexK
-        Stream->StreamID     = open_s((const char*) Path8, Mode);
+        Stream->StreamID     = open_s((const char*) Path8, AsynchronousIO_FileModes_ToOpenFlags(Mode), 0644);
 #else
-        Stream->StreamID     = open((const char*) Path8, Mode);
+        Stream->StreamID     = open((const char*) Path8, AsynchronousIO_FileModes_ToOpenFlags(Mode), 0644);
 #endif
-        UTF8_Deinit(Path8);
+        if (Path8 != Path8Buffer) {
+            UTF8_Deinit(Path8);
+        }
 #elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
-        Stream->StreamID     = _wsopen((const wchar_t*) Path16, Mode, _SH_DENYNO, _S_IREAD | _S_IWRITE);
+        Stream->StreamID     = _wsopen((const wchar_t*) Path16, AsynchronousIO_FileModes_ToOpenFlags(Mode), _SH_DENYNO, _S_IREAD | _S_IWRITE);
 #endif
+        OpenedSucessfully    = AsynchronousIOStream_FinishOpening(Stream, Mode);
         return OpenedSucessfully;
     }
 
@@ -162,28 +1357,22 @@ extern "C" {
         AssertIO(ElementSize > 0);
         AssertIO(NumElements > 0);
 
-        size_t NumElementsRead = 0ULL;
-#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
-        struct aiocb Async = {
-            .aio_fildes                  = Stream->StreamID,
-            .aio_offset                  = Stream->StreamPosition,
-            .aio_buf                     = Array,
-            .aio_nbytes                  = ElementSize * NumElements,
-            .aio_lio_opcode              = 0, // What operation are we doing?
-            /* aio_reqprio = Request Priority */
-            .aio_sigevent                = {
-                .sigev_notify            = 0,
-                .sigev_signo             = 0,
-                .sigev_value             = {0},
-                .sigev_notify_function   = 0,
-                .sigev_notify_attributes = 0,
-            },
-        };
-        aio_read(&Async);
-#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
-
-#endif
-        return NumElementsRead;
+        size_t   Bytes2Read           = ElementSize * NumElements;
+        size_t   BytesRead            = 0;
+        uint8_t *Bytes                = (uint8_t *) Array;
+        AsynchronousIOStream_Flush(Stream); // So the read sees what's been written
+        AsynchronousIOStream_SelectBackend(Stream);
+        AsynchronousIOStream_DetectSequential(Stream, Stream->StreamPosition, Bytes2Read);
+        while (BytesRead < Bytes2Read) {
+            size_t  Chunk             = Bytes2Read - BytesRead < AsynchronousIO_MaxTransferSize ? Bytes2Read - BytesRead : AsynchronousIO_MaxTransferSize;
+            ssize_t Result            = Stream->Alignment > 0 ? AsynchronousIOStream_TransferDirect(Stream, &Bytes[BytesRead], Chunk, Stream->StreamPosition, No, No) : AsynchronousIOStream_Transfer(Stream, &Bytes[BytesRead], Chunk, Stream->StreamPosition, No);
+            if (Result <= 0) {
+                break; // End of the stream, or an error
+            }
+            BytesRead                += (size_t) Result;
+            Stream->StreamPosition   += (size_t) Result;
+        }
+        return BytesRead / ElementSize;
     }
 
     size_t AsynchronousIOStream_Write(AsynchronousIOStream *Stream, void *Array, uint8_t ElementSize, size_t NumElements) {
@@ -192,41 +1381,375 @@ extern "C" {
         AssertIO(ElementSize > 0);
         AssertIO(NumElements > 0);
 
-        size_t NumElementsWritten = 0ULL;
-#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
-        struct aiocb Async = {
-            .aio_fildes                  = Stream->StreamID,
-            .aio_offset                  = Stream->StreamPosition,
-            .aio_buf                     = Array,
-            .aio_nbytes                  = ElementSize * NumElements,
-            .aio_lio_opcode              = 0, // What operation are we doing?
-            /* aio_reqprio = Request Priority */
-            .aio_sigevent                = {
-                .sigev_notify            = 0,
-                .sigev_signo             = 0,
-                .sigev_value             = {0},
-                .sigev_notify_function   = 0,
-                .sigev_notify_attributes = 0,
-            },
-        };
-        aio_write(&Async);
-#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        size_t   Bytes2Write          = ElementSize * NumElements;
+        size_t   BytesWritten         = 0;
+        if (Stream->WriteBehind != NULL) {
+            BytesWritten              = AsynchronousIOStream_WriteBehind(Stream, (uint8_t *) Array, Bytes2Write);
+        } else {
+            BytesWritten              = AsynchronousIOStream_WriteThrough(Stream, (uint8_t *) Array, Bytes2Write, Stream->StreamPosition);
+            Stream->StreamPosition   += BytesWritten;
+        }
+        if ((ssize_t) Stream->StreamPosition > Stream->StreamSize) {
+            Stream->StreamSize        = (ssize_t) Stream->StreamPosition;
+        }
+        return BytesWritten / ElementSize;
+    }
 
-#endif
-        return NumElementsWritten;
+    size_t AsynchronousIOStream_ReadAt(AsynchronousIOStream *Stream, void *Array, uint8_t ElementSize, size_t NumElements, size_t Offset) {
+        AssertIO(Stream != NULL);
+        AssertIO(Array != NULL);
+        AssertIO(ElementSize > 0);
+        AssertIO(NumElements > 0);
+
+        size_t   Bytes2Read           = ElementSize * NumElements;
+        size_t   BytesRead            = 0;
+        uint8_t *Bytes                = (uint8_t *) Array;
+        while (BytesRead < Bytes2Read) {
+            size_t  Chunk             = Bytes2Read - BytesRead < AsynchronousIO_MaxTransferSize ? Bytes2Read - BytesRead : AsynchronousIO_MaxTransferSize;
+            ssize_t Result            = Stream->Alignment > 0 ? AsynchronousIOStream_TransferDirect(Stream, &Bytes[BytesRead], Chunk, Offset + BytesRead, No, Yes) : AsynchronousIOStream_TransferAt(Stream, &Bytes[BytesRead], Chunk, Offset + BytesRead, No);
+            if (Result <= 0) {
+                break;
+            }
+            BytesRead                += (size_t) Result;
+        }
+        return BytesRead / ElementSize;
+    }
+
+    size_t AsynchronousIOStream_WriteAt(AsynchronousIOStream *Stream, void *Array, uint8_t ElementSize, size_t NumElements, size_t Offset) {
+        AssertIO(Stream != NULL);
+        AssertIO(Array != NULL);
+        AssertIO(ElementSize > 0);
+        AssertIO(NumElements > 0);
+
+        size_t   Bytes2Write          = ElementSize * NumElements;
+        size_t   BytesWritten         = 0;
+        uint8_t *Bytes                = (uint8_t *) Array;
+        while (BytesWritten < Bytes2Write) {
+            size_t  Chunk             = Bytes2Write - BytesWritten < AsynchronousIO_MaxTransferSize ? Bytes2Write - BytesWritten : AsynchronousIO_MaxTransferSize;
+            ssize_t Result            = Stream->Alignment > 0 ? AsynchronousIOStream_TransferDirect(Stream, &Bytes[BytesWritten], Chunk, Offset + BytesWritten, Yes, Yes) : AsynchronousIOStream_TransferAt(Stream, &Bytes[BytesWritten], Chunk, Offset + BytesWritten, Yes);
+            if (Result <= 0) {
+                break;
+            }
+            BytesWritten             += (size_t) Result;
+        }
+        return BytesWritten / ElementSize;
+    }
+
+    size_t AsynchronousIOStream_ReadVectors(AsynchronousIOStream *Stream, const AsynchronousIO_Vector *Vectors, size_t NumVectors, AsynchronousIO_VectorFlags Flags) {
+        AssertIO(Stream != NULL);
+        AssertIO(Vectors != NULL);
+        AssertIO(NumVectors > 0);
+
+        AsynchronousIOStream_Flush(Stream);
+        return AsynchronousIOStream_TransferVectors(Stream, Vectors, NumVectors, Flags, No);
+    }
+
+    size_t AsynchronousIOStream_WriteVectors(AsynchronousIOStream *Stream, const AsynchronousIO_Vector *Vectors, size_t NumVectors, AsynchronousIO_VectorFlags Flags) {
+        AssertIO(Stream != NULL);
+        AssertIO(Vectors != NULL);
+        AssertIO(NumVectors > 0);
+
+        AsynchronousIOStream_Flush(Stream);
+        return AsynchronousIOStream_TransferVectors(Stream, Vectors, NumVectors, Flags, Yes);
     }
 
     bool AsynchronousIOStream_Deinit(AsynchronousIOStream *Stream) {
         AssertIO(Stream != NULL);
 
-        bool ClosedSucessfully = No;
+        bool ClosedSucessfully = AsynchronousIOStream_Flush(Stream);
+        AsynchronousIOStream_SetWriteBehind(Stream, 0, 0);
         Stream->DescriptorType = DescriptorType_Unspecified;
         Stream->StreamSize     = 0ULL;
         Stream->StreamPosition = 0ULL;
-        close(Stream->StreamID);
+        AsynchronousIOStream_ReleaseBackend(Stream);
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        ClosedSucessfully     &= close(Stream->StreamID) == 0;
+        pthread_cond_destroy(&Stream->SyncDone);
+        pthread_mutex_destroy(&Stream->WriteBehindLock);
+        pthread_mutex_destroy(&Stream->SyncLock);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        ClosedSucessfully     &= _close(Stream->StreamID) == 0; // SRW locks and condition variables have nothing to destroy
+#endif /* PlatformIO_TargetOS */
+        free(Stream);
         return ClosedSucessfully;
     }
 
+    /* AsynchronousIO_Request */
+    AsynchronousIO_Request *AsynchronousIO_Request_Init(AsynchronousIOStream *Stream, AsynchronousIO_RequestTypes Type, void *Array, size_t NumBytes, size_t Offset) {
+        AssertIO(Stream != NULL);
+        AssertIO(Type != RequestType_Unspecified);
+        AssertIO(Array != NULL);
+        AssertIO(NumBytes > 0);
+        AssertIO(NumBytes <= AsynchronousIO_MaxTransferSize);
+
+        AsynchronousIO_Request *Request = calloc(1, sizeof(AsynchronousIO_Request));
+        AssertIO(Request != NULL);
+        Request->Completion.Request   = Request;
+        Request->Stream               = Stream;
+        Request->Type                 = Type;
+        Request->Array                = Array;
+        Request->NumBytes             = NumBytes;
+        Request->Offset               = Offset;
+        return Request;
+    }
+
+    void AsynchronousIO_Request_SetCallback(AsynchronousIO_Request *Request, AsynchronousIO_CompletionFunction Callback, void *Context) {
+        AssertIO(Request != NULL);
+
+        Request->Completion.Callback  = Callback;
+        Request->Completion.Context   = Context;
+    }
+
+    bool AsynchronousIO_Request_IsComplete(AsynchronousIO_Request *Request) {
+        AssertIO(Request != NULL);
+
+        return Request->Completion.IsComplete;
+    }
+
+    int64_t AsynchronousIO_Request_GetResult(AsynchronousIO_Request *Request) {
+        AssertIO(Request != NULL);
+        AssertIO(Request->Completion.IsComplete == Yes);
+
+        return (int64_t) Request->Completion.Result;
+    }
+
+    void *AsynchronousIO_Request_GetArray(AsynchronousIO_Request *Request) {
+        AssertIO(Request != NULL);
+
+        return Request->Array;
+    }
+
+    void AsynchronousIO_Request_Deinit(AsynchronousIO_Request *Request) {
+        AssertIO(Request != NULL);
+        AssertIO(Request->IsSubmitted == No || Request->Completion.IsComplete == Yes);
+
+        free(Request);
+    }
+
+    /*
+     Sleeps until something the incomplete requests among Requests are waiting on completes, which isn't necessarily one of them.
+     Every POSIX AIO request goes to one aio_suspend; io_uring requests on one ring wait in io_uring_enter, and on several rings in one poll over all of them.
+     With both backends in the list, aio_suspend times out after a millisecond so the rings' completions aren't left waiting.
+     */
+    static void AsynchronousIO_Block(AsynchronousIO_Request **Requests, size_t NumRequests) {
+#ifdef AsynchronousIO_HasIOURing
+        struct pollfd       *Rings    = NULL; // One for each distinct ring
+        size_t               NumRings = 0;
+        AsynchronousIO_Ring *Ring     = NULL; // The last one seen, the only one when NumRings is 1
+#endif /* AsynchronousIO_HasIOURing */
+#if PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        const struct aiocb **Pending  = NULL;
+        size_t               NumPending = 0;
+#endif /* PlatformIO_TargetOS */
+        for (size_t Index = 0; Index < NumRequests; Index++) {
+            AsynchronousIO_Request *Request = Requests[Index];
+            if (Request->IsSubmitted == No || Request->Completion.IsComplete) {
+                continue;
+            }
+#ifdef AsynchronousIO_HasIOURing
+            if (Request->Backend == Backend_IOURing && Request->Stream->Ring != Ring) {
+                Ring                  = Request->Stream->Ring;
+                bool IsListed         = No;
+                for (size_t Listed = 0; Listed < NumRings && IsListed == No; Listed++) {
+                    IsListed          = Rings[Listed].fd == Ring->RingID;
+                }
+                if (IsListed == No) {
+                    if (Rings == NULL) {
+                        Rings         = calloc(NumRequests - Index, sizeof(struct pollfd));
+                        AssertIO(Rings != NULL);
+                    }
+                    Rings[NumRings]   = (struct pollfd) {.fd = Ring->RingID, .events = POLLIN};
+                    NumRings         += 1;
+                }
+            }
+#endif /* AsynchronousIO_HasIOURing */
+#if PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+            if (Request->Backend == Backend_POSIXAIO) {
+                if (Pending == NULL) {
+                    Pending           = calloc(NumRequests - Index, sizeof(struct aiocb *));
+                    AssertIO(Pending != NULL);
+                }
+                Pending[NumPending]   = &Request->Async;
+                NumPending           += 1;
+            }
+#endif /* PlatformIO_TargetOS */
+        }
+#if PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        if (NumPending > 0) {
+            struct timespec  Timeout  = {.tv_sec = 0, .tv_nsec = 1000000};
+            struct timespec *Limit    = NULL;
+#ifdef AsynchronousIO_HasIOURing
+            Limit                     = NumRings > 0 ? &Timeout : NULL;
+            free(Rings);
+#endif /* AsynchronousIO_HasIOURing */
+            aio_suspend(Pending, (int) NumPending, Limit);
+            free(Pending);
+            return;
+        }
+#endif /* PlatformIO_TargetOS */
+#ifdef AsynchronousIO_HasIOURing
+        if (NumRings == 1) {
+            AsynchronousIO_Ring_Submit(Ring, 1);
+        } else if (NumRings > 1) { // Submit published every entry, and the caller's Poll reaped every ring, so a readable ring has something new
+            int Ready                 = 0;
+            do {
+                Ready                 = poll(Rings, (nfds_t) NumRings, -1);
+            } while (Ready < 0 && errno == EINTR);
+        }
+        free(Rings);
+#endif /* AsynchronousIO_HasIOURing */
+    }
+
+    bool AsynchronousIO_Submit(AsynchronousIO_Request **Requests, size_t NumRequests) {
+        AssertIO(Requests != NULL);
+
+        bool Submitted                = Yes;
+#ifdef AsynchronousIO_HasIOURing
+        AsynchronousIOStream *Queued  = NULL; // The stream whose ring has entries that haven't been handed to the kernel yet
+        uint32_t              QueuedFrom = 0; // Where this call's entries on Queued's ring start
+#endif /* AsynchronousIO_HasIOURing */
+        for (size_t Index = 0; Index < NumRequests; Index++) {
+            AsynchronousIO_Request *Request = Requests[Index];
+            AssertIO(Request != NULL);
+            AssertIO(Request->IsSubmitted == No || Request->Completion.IsComplete == Yes);
+
+            AsynchronousIOStream_SelectBackend(Request->Stream);
+            Request->Backend               = Request->Stream->Backend;
+            Request->Completion.Result     = 0;
+            Request->Completion.IsComplete = No;
+            Request->IsSubmitted           = Yes;
+            bool IsWrite                   = Request->Type == RequestType_Write;
+            if (AsynchronousIOStream_IsAligned(Request->Stream, Request->Array, Request->NumBytes, Request->Offset) == No) {
+                AsynchronousIO_Complete(&Request->Completion, AsynchronousIOStream_TransferDirectAll(Request->Stream, Request->Array, Request->NumBytes, Request->Offset, IsWrite));
+                continue;
+            }
+#ifdef AsynchronousIO_HasIOURing
+            if (Request->Backend == Backend_IOURing) {
+                AsynchronousIO_Ring *Ring  = Request->Stream->Ring;
+                if (Queued != Request->Stream) {
+                    if (Queued != NULL && AsynchronousIO_Ring_Publish(Queued->Ring, QueuedFrom, 0) == No) {
+                        AsynchronousIOStream_AbandonRing(Queued);
+                        Submitted          = No;
+                    }
+                    Queued                 = Request->Stream;
+                    QueuedFrom             = Ring->LocalTail;
+                }
+                struct io_uring_sqe *Entry = AsynchronousIO_Ring_GetEntry(Ring);
+                while (Entry == NULL && Request->Stream->Backend == Backend_IOURing) {
+                    if (AsynchronousIO_Ring_Publish(Ring, QueuedFrom, 1) == No) {
+                        AsynchronousIOStream_AbandonRing(Request->Stream);
+                        Queued             = NULL;
+                        Submitted          = No;
+                    } else {
+                        AsynchronousIO_Ring_Reap(Ring);
+                        Entry              = AsynchronousIO_Ring_GetEntry(Ring);
+                    }
+                }
+                if (Entry != NULL) {
+                    AsynchronousIO_Ring_PrepareTransfer(Ring, Entry, Request->Stream->StreamID, Request->Array, Request->NumBytes, Request->Offset, IsWrite);
+                    Entry->user_data       = (uint64_t) (uintptr_t) &Request->Completion;
+                    continue;
+                }
+                Request->Backend           = Request->Stream->Backend;
+            }
+#endif /* AsynchronousIO_HasIOURing */
+#if PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+            if (Request->Backend == Backend_POSIXAIO) {
+                memset(&Request->Async, 0, sizeof(Request->Async));
+                Request->Async.aio_fildes  = Request->Stream->StreamID;
+                Request->Async.aio_offset  = (off_t) Request->Offset;
+                Request->Async.aio_buf     = Request->Array;
+                Request->Async.aio_nbytes  = Request->NumBytes;
+                Request->Async.aio_sigevent.sigev_notify = SIGEV_NONE;
+                int Started                = IsWrite ? aio_write(&Request->Async) : aio_read(&Request->Async);
+                while (Started != 0 && errno == EAGAIN && AsynchronousIO_Poll(Requests, Index) < Index) {
+                    AsynchronousIO_Block(Requests, Index); // The system's AIO queue is full, wait for one of ours to finish and reap it
+                    AsynchronousIO_Poll(Requests, Index);
+                    Started                = IsWrite ? aio_write(&Request->Async) : aio_read(&Request->Async);
+                }
+                if (Started != 0) {
+                    AsynchronousIO_Complete(&Request->Completion, -errno);
+                    Submitted              = No;
+                }
+                continue;
+            }
+#endif /* PlatformIO_TargetOS */
+            AsynchronousIO_Complete(&Request->Completion, AsynchronousIOStream_Transfer(Request->Stream, Request->Array, Request->NumBytes, Request->Offset, IsWrite));
+        }
+#ifdef AsynchronousIO_HasIOURing
+        if (Queued != NULL && AsynchronousIO_Ring_Publish(Queued->Ring, QueuedFrom, 0) == No) {
+            AsynchronousIOStream_AbandonRing(Queued);
+            Submitted                      = No;
+        }
+#endif /* AsynchronousIO_HasIOURing */
+        return Submitted;
+    }
+
+    size_t AsynchronousIO_Poll(AsynchronousIO_Request **Requests, size_t NumRequests) {
+        AssertIO(Requests != NULL);
+
+        size_t NumComplete            = 0;
+#ifdef AsynchronousIO_HasIOURing
+        AsynchronousIO_Ring *Reaped   = NULL;
+#endif /* AsynchronousIO_HasIOURing */
+        for (size_t Index = 0; Index < NumRequests; Index++) {
+            AsynchronousIO_Request *Request = Requests[Index];
+            AssertIO(Request != NULL);
+
+            if (Request->IsSubmitted && Request->Completion.IsComplete == No) {
+#ifdef AsynchronousIO_HasIOURing
+                if (Request->Backend == Backend_IOURing && Request->Stream->Ring != Reaped) {
+                    Reaped                 = Request->Stream->Ring;
+                    AsynchronousIO_Ring_Reap(Reaped);
+                }
+#endif /* AsynchronousIO_HasIOURing */
+#if PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+                int Error                  = Request->Backend == Backend_POSIXAIO ? aio_error(&Request->Async) : EINPROGRESS;
+                if (Error != EINPROGRESS) {
+                    ssize_t Result         = aio_return(&Request->Async);
+                    AsynchronousIO_Complete(&Request->Completion, Result < 0 ? -Error : Result);
+                }
+#endif /* PlatformIO_TargetOS */
+            }
+            NumComplete                   += Request->Completion.IsComplete ? 1 : 0;
+        }
+        return NumComplete;
+    }
+
+    size_t AsynchronousIO_WaitAny(AsynchronousIO_Request **Requests, size_t NumRequests) {
+        AssertIO(Requests != NULL);
+        AssertIO(NumRequests > 0);
+
+        for (;;) {
+            AsynchronousIO_Poll(Requests, NumRequests);
+            for (size_t Index = 0; Index < NumRequests; Index++) {
+                AssertIO(Requests[Index]->IsSubmitted == Yes);
+                if (Requests[Index]->Completion.IsComplete) {
+                    return Index;
+                }
+            }
+            AsynchronousIO_Block(Requests, NumRequests);
+        }
+    }
+
+    bool AsynchronousIO_WaitAll(AsynchronousIO_Request **Requests, size_t NumRequests) {
+        AssertIO(Requests != NULL);
+
+        bool Transferred              = Yes;
+        for (size_t Index = 0; Index < NumRequests; Index++) {
+            AsynchronousIO_Request *Request = Requests[Index];
+            AssertIO(Request != NULL);
+            AssertIO(Request->IsSubmitted == Yes);
+
+            while (AsynchronousIO_Poll(&Request, 1) == 0) {
+                AsynchronousIO_Block(&Request, 1);
+            }
+            Transferred              &= Request->Completion.Result == (ssize_t) Request->NumBytes;
+        }
+        return Transferred;
+    }
+    /* AsynchronousIO_Request */
+
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
 }
 #endif /* Extern C */
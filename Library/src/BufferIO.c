@@ -3,22 +3,91 @@
 #include "../include/AssertIO.h"          /* Included for Assertions */
 #include "../include/AsynchronousIO.h"    /* Included for AsynchronousIOStream */
 #include "../include/CryptographyIO.h"    /* Included for InsecurePRNG_CreateInteger */
+#include "../include/FileIO.h"            /* Included for FileIO_MapView, which backs mapped BitBuffers */
 #include "../include/MathIO.h"            /* Included for Integer functions */
 #include "../include/TextIO/FormatIO.h"   /* Included for UTF32_Format */
 #include "../include/TextIO/StringIO.h"   /* Included for StringIO's declarations */
+#include "../include/Private/BufferIOTables.h" /* Included for the CRC32 tables */
+
+#include <string.h>                       /* Included for memcpy, for unaligned loads and stores */
+
+#if PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+#include <unistd.h>                       /* Included for sysconf */
+#include <sys/mman.h>                     /* Included for madvise */
+#include <pthread.h>                      /* Included for pthread_mutex_lock, for BitBufferPool, and pthread_once */
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+#include <windows.h>                      /* Included for PrefetchVirtualMemory and InitOnceExecuteOnce */
+#endif /* PlatformIO_TargetOS */
+
+#if (PlatformIO_Compiler == PlatformIO_CompilerIsMSVC)
+#include <intrin.h>                       /* Included for _BitScanForward64, _BitScanReverse64 */
+#endif /* PlatformIO_Compiler */
+
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+#include <immintrin.h>                    /* Included for the SIMD field unpackers, checksums, and memory kernels */
+#endif /* PlatformIO_Architecture */
 
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
 extern "C" {
 #endif
     
     /* Start BitBuffer section */
+    typedef uint64_t (*BitBuffer_Extractor)(BitBuffer *BitB, uint8_t NumBits);
+
+    typedef void     (*BitBuffer_Appender)(BitBuffer *BitB, uint8_t NumBits, uint64_t Data2Append);
+
+    typedef struct BitBuffer_StreamChunk {
+        AsynchronousIO_Request *Request; // NULL until the chunk's first transfer
+        uint8_t       *Data;
+        size_t         Offset;           // Where in the stream Data starts
+        size_t         Requested;        // Number of bytes submitted
+        size_t         Size;             // Number of bytes actually transferred, valid once the transfer is finished
+        size_t         Consumed;         // Number of bytes of Data already copied into the array
+        bool           InFlight;
+    } BitBuffer_StreamChunk;
+
+    typedef struct BitBuffer_StreamRing {
+        AsynchronousIOStream  *Stream;
+        BitBuffer_StreamChunk *Chunks;
+        size_t         ChunkSize;
+        size_t         NextOffset;       // Reads: where the next chunk will be read from; Writes: where the stream is expected to be next
+        uint8_t        NumChunks;
+        uint8_t        Head;             // The oldest chunk, the next one to be delivered or reused
+        bool           Failed;           // A write failed, WriteStream reports it and clears it
+    } BitBuffer_StreamRing;
+
     typedef struct BitBuffer {
         AsynchronousIOStream *Input;
         AsynchronousIOStream *Output;
         uint8_t       *Buffer;
         size_t         BitOffset;
         size_t         NumBits;
+        size_t         Capacity;         // Size of Buffer in bytes, NumBits is smaller after reading the end of a stream
+        BitBuffer_StreamRing InputRing;
+        BitBuffer_StreamRing OutputRing;
+        size_t         CacheOffset;      // The BitOffset the first bit of Cache corresponds to
+        uint64_t       Cache;            // MSBit aligned for BitOrder_Left2Right, LSBit aligned for BitOrder_Right2Left
+        BitBuffer_Extractor DefaultExtractor;
+        BitBuffer_Appender  DefaultAppender;
+        uint8_t        CacheSize;        // Number of valid bits in Cache, 0 means the Cache is invalid
+        uint8_t        PrefetchDepth;
+        bool           HoldsInput;       // Yes once ReadStream filled the array from Input, until then none of it is unread
+        FileIO_MapView *Mapping;         // Non-NULL when Buffer is a read only file mapping, it's unmapped instead of freed
+        BufferIO_BitOrders  CacheBitOrder;
+        struct BitBuffer   *NextFree;    // Next BitBuffer in a BitBufferPool's free list
     } BitBuffer;
+
+    static uint64_t BitBuffer_Extract_FarByte_FarBit(BitBuffer *BitB, uint8_t NumBits);
+
+    static void     BitBuffer_Append_FarByte_FarBit(BitBuffer *BitB, uint8_t NumBits, uint64_t Data2Append);
+
+    static size_t BitBuffer_GetArraySizeInBytes(BitBuffer *BitB) {
+        return (BitB->NumBits + 7) / 8;
+    }
+
+    static void BitBuffer_InvalidateCache(BitBuffer *BitB) {
+        BitB->CacheSize = 0;
+    }
     
     BitBuffer *BitBuffer_Init(size_t BitBufferSize) {
         AssertIO(BitBufferSize > 0);
@@ -28,14 +97,84 @@ extern "C" {
         BitB->Buffer                     = calloc(BitBufferSize, sizeof(uint8_t));
         AssertIO(BitB->Buffer != NULL);
         BitB->NumBits            = Bytes2Bits(BitBufferSize);
+        BitB->Capacity           = BitBufferSize;
+        BitB->DefaultExtractor   = BitBuffer_Extract_FarByte_FarBit;
+        BitB->DefaultAppender    = BitBuffer_Append_FarByte_FarBit;
+        return BitB;
+    }
+
+    /* Mapped arrays are read only (PROT_READ / FILE_MAP_READ), so anything that writes to, moves, or replaces the array refuses them */
+    static bool BitBuffer_IsReadOnly(BitBuffer *BitB) {
+        return BitB->Mapping != NULL;
+    }
+
+    /* The whole file, read only, through the same mapping code as FileIO_MapView */
+    static BitBuffer *BitBuffer_InitFromMapView(FileIO_MapView *View) {
+        BitBuffer *BitB                  = NULL;
+        if (View != NULL) {
+            BitB                         = calloc(1, sizeof(BitBuffer));
+            AssertIO(BitB != NULL);
+            BitB->Mapping                = View;
+            BitB->Buffer                 = (uint8_t*) FileIO_MapView_GetPointer(View);
+            BitB->Capacity               = FileIO_MapView_GetSize(View);
+            BitB->NumBits                = Bytes2Bits(BitB->Capacity);
+            BitB->DefaultExtractor       = BitBuffer_Extract_FarByte_FarBit;
+            BitB->DefaultAppender        = BitBuffer_Append_FarByte_FarBit;
+        }
         return BitB;
     }
 
+    BitBuffer *BitBuffer_InitFromMappedFileUTF8(PlatformIO_Immutable(UTF8 *) Path8) {
+        AssertIO(Path8 != NULL);
+
+        return BitBuffer_InitFromMapView(FileIO_MapView_InitFromPathUTF8(Path8, 0, 0, MapMode_Read));
+    }
+
+    BitBuffer *BitBuffer_InitFromMappedFile(AsynchronousIOStream *Stream) {
+        AssertIO(Stream != NULL);
+
+        return BitBuffer_InitFromMapView(FileIO_MapView_InitFromStream(Stream, 0, 0, MapMode_Read));
+    }
+
+    bool BitBuffer_AdviseMapping(BitBuffer *BitB, AsynchronousIO_AccessPatterns AccessPattern, size_t StartInBits, size_t NumBits) {
+        AssertIO(BitB != NULL);
+        AssertIO(AccessPattern != AccessPattern_Unspecified);
+        AssertIO(StartInBits <= BitB->NumBits);
+
+        bool   Accepted                  = No;
+        if (BitB->Mapping != NULL) {
+            size_t Start                 = StartInBits / 8;
+            size_t End                   = (NumBits == 0 || StartInBits + NumBits > BitB->NumBits) ? BitB->Capacity : Bits2Bytes(RoundingType_Up, StartInBits + NumBits);
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+            size_t PageSize              = (size_t) sysconf(_SC_PAGESIZE);
+            size_t PageStart             = Start - (Start % PageSize); // The mapping itself is page aligned
+            int    Advice                = MADV_NORMAL;
+            if (AccessPattern == AccessPattern_Sequential) {
+                Advice                   = MADV_SEQUENTIAL;
+            } else if (AccessPattern == AccessPattern_Random) {
+                Advice                   = MADV_RANDOM;
+            } else if (AccessPattern == AccessPattern_WillNeed) {
+                Advice                   = MADV_WILLNEED;
+            } else if (AccessPattern == AccessPattern_DontNeed) {
+                Advice                   = MADV_DONTNEED; // The mapping is private and read only, so the pages are just reloaded from the file
+            }
+            Accepted                     = madvise(&BitB->Buffer[PageStart], End - PageStart, Advice) == 0;
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+            if (AccessPattern == AccessPattern_WillNeed) {
+                WIN32_MEMORY_RANGE_ENTRY Range = {.VirtualAddress = &BitB->Buffer[Start], .NumberOfBytes = End - Start};
+                Accepted                 = PrefetchVirtualMemory(GetCurrentProcess(), 1, &Range, 0) != 0;
+            }
+#endif /* PlatformIO_TargetOS */
+        }
+        return Accepted;
+    }
+
     void BitBuffer_SetInputStream(BitBuffer *BitB, AsynchronousIOStream *Input) {
         AssertIO(BitB != NULL);
         AssertIO(Input != NULL);
 
-        BitB->Input = Input;
+        BitB->Input      = Input;
+        BitB->HoldsInput = No;
     }
 
     void BitBuffer_SetOutputStream(BitBuffer *BitB, AsynchronousIOStream *Output) {
@@ -66,7 +205,7 @@ extern "C" {
     
     void BitBuffer_SetPosition(BitBuffer *BitB, size_t OffsetInBits) {
         AssertIO(BitB != NULL);
-        AssertIO(OffsetInBits > 0);
+        AssertIO(OffsetInBits <= BitB->NumBits);
 
         BitB->BitOffset = OffsetInBits;
     }
@@ -88,8 +227,13 @@ extern "C" {
         AssertIO(Buffer != NULL);
         AssertIO(BufferSizeInBytes > 0);
 
-        BitB->Buffer  = Buffer;
-        BitB->NumBits = Bytes2Bits(BufferSizeInBytes);
+        if (BitBuffer_IsReadOnly(BitB)) {
+            return;
+        }
+        BitB->Buffer   = Buffer;
+        BitB->NumBits  = Bytes2Bits(BufferSizeInBytes);
+        BitB->Capacity = BufferSizeInBytes;
+        BitBuffer_InvalidateCache(BitB);
     }
     
     bool BitBuffer_IsAligned(BitBuffer *BitB, size_t AlignmentSizeInBytes) {
@@ -106,8 +250,13 @@ extern "C" {
         size_t AlignmentSizeInBits   = Bytes2Bits(AlignmentSizeInBytes);
         size_t Bits2Align            = AlignmentSizeInBits - (BitB->BitOffset % AlignmentSizeInBits);
         if (BitB->BitOffset + Bits2Align > BitB->NumBits) {
+            if (BitBuffer_IsReadOnly(BitB)) {
+                return;
+            }
             BitB->Buffer             = (uint8_t*) realloc(BitB->Buffer, Bits2Bytes(RoundingType_Up, BitB->NumBits + Bits2Align));
             BitB->NumBits           += Bits2Align;
+            BitB->Capacity           = Bits2Bytes(RoundingType_Up, BitB->NumBits);
+            BitBuffer_InvalidateCache(BitB);
         }
         BitB->BitOffset             += Bits2Align;
     }
@@ -117,83 +266,49 @@ extern "C" {
         AssertIO(Bits2Seek != 0);
 
         if (Bits2Seek > 0) {
+            if (BitB->CacheOffset == BitB->BitOffset && (size_t) Bits2Seek < BitB->CacheSize) { // Skip within the Cache instead of reloading it
+                if (BitB->CacheBitOrder == BitOrder_Left2Right) {
+                    BitB->Cache <<= Bits2Seek;
+                } else {
+                    BitB->Cache >>= Bits2Seek;
+                }
+                BitB->CacheSize   -= (uint8_t) Bits2Seek;
+                BitB->CacheOffset += Bits2Seek;
+            }
             BitB->BitOffset += Bits2Seek;
         } else {
             BitB->BitOffset -= AbsoluteI(Bits2Seek);
         }
     }
 
-    void BitBuffer_Read(BitBuffer *BitB) {
+    size_t BitBuffer_Compact(BitBuffer *BitB) {
         AssertIO(BitB != NULL);
 
-        // save up to 1 byte
-        if (BitB->BitOffset != 0) {
-            size_t BitOffset  = BitB->BitOffset; // Saved for restoration
-            size_t NumBits    = BitB->NumBits;
-            size_t Bytes2Save = Bits2Bytes(RoundingType_Up, BitOffset);
-            size_t BufferSize = Bits2Bytes(RoundingType_Up, NumBits);
-
-            for (size_t Byte2Keep = BufferSize - Bytes2Save; Byte2Keep < BufferSize; Byte2Keep++) {
-                BitB->Buffer[BufferSize - (Bytes2Save + Byte2Keep)] = BitB->Buffer[Byte2Keep];
-            }
-
-            // Now we need to read in BufferSize - Bytes2Save, starting the array at Bytes2Save
-#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
-            struct sigevent SignalEvent = {
-                .sigev_notify            = 0,
-                .sigev_signo             = 0,
-                .sigev_value             = 0,
-                .sigev_notify_function   = 0,
-                .sigev_notify_attributes = 0,
-            };
-            /*
-             struct aiocb Async = {
-             .aio_fildes     = AsynchronousIOStream_GetDescriptor(BitB->Input),
-             .aio_offset     = AsynchronousIOStream_GetPosition(BitB->Input),
-             .aio_buf        = &BitB->Buffer[Bytes2Save],
-             .aio_nbytes     = BufferSize - Bytes2Save,
-             // aio_reqprio  = Request Priority
-             .aio_sigevent   = SignalEvent,
-             .aio_lio_opcode = 0, // What operation are we doing?
-             };
-             aio_read(&Async);
-             */
-            AsynchronousIOStream_Read(BitB->Input, BitB->Buffer, 1, Bits2Bytes(RoundingType_Down, BitB->NumBits));
-#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
-            // IO completion ports
-#endif
-
-            /*
-             Async is Preferred, I've got an idea to optimize this while keeping the data correct.
-
-             Just return after the read or write has been cue'd.
-
-             we only need to worry about the buffer being correct if a call is made to Read or Write to the BitBuffer, so handle that check or loop or whatever it may be in that function.
-
-             We may need to have our own signal handler here to support different platforms...
-
-             Well, those are for the future
-             */
-
-
-
-
-            /*
-             Ok, so, round up the bits to full bytes, copy that many bytes from the end of the buffer to the beginning.
-             then read in the new data, but what if there were some bits left over?
-             We have to shift everything?
-             Well, don't worry about that too much because the Write function only allows us to write at a byte resolution.
+        if (BitBuffer_IsReadOnly(BitB)) {
+            return 0;
+        }
+        BitBuffer_InvalidateCache(BitB);
+        size_t ArraySize              = BitBuffer_GetArraySizeInBytes(BitB);
+        size_t Bytes2Drop             = Minimum(BitB->BitOffset / 8, BitB->NumBits / 8);
+        BufferIO_MemoryMove8(BitB->Buffer, &BitB->Buffer[Bytes2Drop], ArraySize - Bytes2Drop);
+        BitB->BitOffset              -= Bytes2Bits(Bytes2Drop);
+        BitB->NumBits                -= Bytes2Bits(Bytes2Drop);
+        return Bytes2Drop;
+    }
 
-             Also, we should consider having a function specifically for moving data in an aray because this is really common
+    void BitBuffer_Read(BitBuffer *BitB) {
+        AssertIO(BitB != NULL);
 
-             Just, where should it go?
-             */
-        }
+        BitBuffer_ReadStream(BitB);
     }
     
     bool BitBuffer_Erase(BitBuffer *BitB, uint8_t NewValue) {
         AssertIO(BitB != NULL);
 
+        if (BitBuffer_IsReadOnly(BitB)) {
+            return No;
+        }
+        BitBuffer_InvalidateCache(BitB);
         bool ErasedBitBufferCompletely = false;
         size_t NumBytesToErase  = Bits2Bytes(RoundingType_Up, BitB->NumBits);
         size_t NumBytesErased   = BufferIO_MemorySet8(BitB->Buffer, 0, NumBytesToErase);
@@ -201,12 +316,25 @@ extern "C" {
         return ErasedBitBufferCompletely;
     }
     
-    void BitBuffer_Resize(BitBuffer *BitB, size_t NewSizeInBits) {
+    void BitBuffer_Resize(BitBuffer *BitB, size_t NewSizeInBytes) {
         AssertIO(BitB != NULL);
-        AssertIO(Bytes2Bits(NewSizeInBits) >= BitB->BitOffset);
+        AssertIO(Bytes2Bits(NewSizeInBytes) >= BitB->BitOffset);
 
-        BitB->Buffer  = (uint8_t*) realloc(BitB->Buffer, Bits2Bytes(RoundingType_Up, NewSizeInBits));
-        BitB->NumBits = Bytes2Bits(NewSizeInBits);
+        if (BitBuffer_IsReadOnly(BitB)) {
+            return;
+        }
+        if (NewSizeInBytes > BitB->Capacity) {
+            size_t NewCapacity = 8; // A power of two, so BitBufferPool_Release files it under the class it fills
+            while (NewCapacity < NewSizeInBytes) {
+                NewCapacity  *= 2;
+            }
+            uint8_t *Resized   = (uint8_t*) realloc(BitB->Buffer, NewCapacity);
+            AssertIO(Resized != NULL);
+            BitB->Buffer       = Resized;
+            BitB->Capacity     = NewCapacity;
+        }
+        BitB->NumBits          = Bytes2Bits(NewSizeInBytes);
+        BitBuffer_InvalidateCache(BitB);
     }
     
     void BitBuffer_Copy(BitBuffer *Source, BitBuffer *Destination, size_t StartInBits, size_t EndInBits) {
@@ -216,6 +344,10 @@ extern "C" {
         AssertIO(EndInBits < Source->NumBits);
         AssertIO((EndInBits - StartInBits) < Destination->NumBits);
 
+        if (BitBuffer_IsReadOnly(Destination)) {
+            return;
+        }
+        BitBuffer_InvalidateCache(Destination);
         size_t NumBits2Copy = EndInBits - StartInBits;
         if (StartInBits % 8 == 0 && EndInBits % 8 == 0 && NumBits2Copy % 8 == 0) {
             Destination->NumBits = NumBits2Copy;
@@ -229,222 +361,586 @@ extern "C" {
         }
     }
 
+    /*
+     Stream prefetching.
+
+     With a PrefetchDepth of 0 ReadStream and WriteStream block on every call.
+     Otherwise each direction gets a ring of PrefetchDepth chunks the size of the array, each one an AsynchronousIO_Request:
+       Reads are submitted ahead of the decoder, ReadStream copies whatever's already arrived behind the unread bits and resubmits each chunk as soon as it's drained.
+       Writes are copied into the next free chunk and submitted, WriteStream only waits when the ring is full.
+     The AsynchronousIOStream's position always tracks the bytes delivered to (or taken from) the array, not the reads in flight,
+     so changing the depth or tearing the ring down never loses data, and moving the stream just starts a new ring at the new position.
+     A short transfer is resubmitted for the rest of the chunk; only an error, or 0 bytes read at the end of the stream, finishes a chunk early.
+     */
+
+    static void BitBuffer_Chunk_Submit(BitBuffer_StreamRing *Ring, BitBuffer_StreamChunk *Chunk, size_t Offset, size_t NumBytes, bool IsWrite) {
+        Chunk->Size                   = 0;
+        Chunk->Consumed               = 0;
+        Chunk->Offset                 = Offset;
+        Chunk->Requested              = NumBytes;
+        Chunk->InFlight               = Yes;
+        if (Chunk->Request != NULL) {
+            AsynchronousIO_Request_Deinit(Chunk->Request);
+        }
+        Chunk->Request                = AsynchronousIO_Request_Init(Ring->Stream, IsWrite ? RequestType_Write : RequestType_Read, Chunk->Data, NumBytes, Offset);
+        AsynchronousIO_Submit(&Chunk->Request, 1); // A refused submission completes with -errno, Wait sees it
+    }
+
+    /* Returns the number of bytes transferred, resubmitting the rest of the chunk after a short transfer */
+    static size_t BitBuffer_Chunk_Wait(BitBuffer_StreamRing *Ring, BitBuffer_StreamChunk *Chunk, bool IsWrite) {
+        while (Chunk->InFlight) {
+            AsynchronousIO_WaitAll(&Chunk->Request, 1);
+            int64_t Transferred       = AsynchronousIO_Request_GetResult(Chunk->Request);
+            if (Transferred > 0) {
+                Chunk->Size          += (size_t) Transferred;
+            }
+            if (Transferred > 0 && Chunk->Size < Chunk->Requested) {
+                AsynchronousIO_Request_Deinit(Chunk->Request);
+                Chunk->Request        = AsynchronousIO_Request_Init(Ring->Stream, IsWrite ? RequestType_Write : RequestType_Read, &Chunk->Data[Chunk->Size], Chunk->Requested - Chunk->Size, Chunk->Offset + Chunk->Size);
+                AsynchronousIO_Submit(&Chunk->Request, 1);
+            } else {
+                Chunk->InFlight       = No;
+                if (IsWrite && Chunk->Size < Chunk->Requested) {
+                    Ring->Failed      = Yes;
+                }
+            }
+        }
+        return Chunk->Size;
+    }
+
+    /* Blocks until every transfer is finished; reads that haven't been delivered are thrown away, a failed write sets Failed */
+    static void BitBuffer_Ring_Deinit(BitBuffer_StreamRing *Ring, bool IsWrite) {
+        for (uint8_t Chunk = 0; Chunk < Ring->NumChunks; Chunk++) {
+            BitBuffer_Chunk_Wait(Ring, &Ring->Chunks[Chunk], IsWrite);
+            if (Ring->Chunks[Chunk].Request != NULL) {
+                AsynchronousIO_Request_Deinit(Ring->Chunks[Chunk].Request);
+            }
+            free(Ring->Chunks[Chunk].Data);
+        }
+        free(Ring->Chunks);
+        Ring->Chunks                  = NULL;
+        Ring->NumChunks               = 0;
+        Ring->Head                    = 0;
+    }
+
+    static void BitBuffer_Ring_Init(BitBuffer_StreamRing *Ring, AsynchronousIOStream *Stream, uint8_t NumChunks, size_t ChunkSize, size_t Offset) {
+        Ring->Chunks                  = calloc(NumChunks, sizeof(BitBuffer_StreamChunk));
+        AssertIO(Ring->Chunks != NULL);
+        for (uint8_t Chunk = 0; Chunk < NumChunks; Chunk++) {
+            Ring->Chunks[Chunk].Data  = malloc(ChunkSize);
+            AssertIO(Ring->Chunks[Chunk].Data != NULL);
+        }
+        Ring->Stream                  = Stream;
+        Ring->NumChunks               = NumChunks;
+        Ring->ChunkSize               = ChunkSize;
+        Ring->NextOffset              = Offset;
+        Ring->Head                    = 0;
+    }
+
+    /* Where the input ring will deliver from next, ReadStream starts a new ring when the stream was moved somewhere else */
+    static size_t BitBuffer_Ring_GetDeliveryOffset(BitBuffer_StreamRing *Ring) {
+        BitBuffer_StreamChunk *Chunk  = &Ring->Chunks[Ring->Head];
+        return Chunk->Offset + Chunk->Consumed;
+    }
+
+    /* Goes through AsynchronousIOStream_Read so the stream's sequential detector sees the reader and keeps the readahead window ahead of it */
+    static size_t BitBuffer_ReadSynchronously(AsynchronousIOStream *Stream, uint8_t *Array, size_t Offset, size_t NumBytes) {
+        AsynchronousIOStream_SetPosition(Stream, Offset);
+        return AsynchronousIOStream_Read(Stream, Array, 1, NumBytes);
+    }
+
+    /* Goes through AsynchronousIOStream_Write so many small WriteStreams coalesce in the stream's write-behind buffer, if it has one */
+    static size_t BitBuffer_WriteSynchronously(AsynchronousIOStream *Stream, uint8_t *Array, size_t Offset, size_t NumBytes) {
+        AsynchronousIOStream_SetPosition(Stream, Offset);
+        return AsynchronousIOStream_Write(Stream, Array, 1, NumBytes);
+    }
+
+    void BitBuffer_SetPrefetchDepth(BitBuffer *BitB, uint8_t PrefetchDepth) {
+        AssertIO(BitB != NULL);
+
+        BitBuffer_Ring_Deinit(&BitB->InputRing, No);
+        BitBuffer_Ring_Deinit(&BitB->OutputRing, Yes);
+        BitB->PrefetchDepth           = PrefetchDepth;
+    }
+
     void BitBuffer_ReadStream(BitBuffer *BitB) {
         AssertIO(BitB != NULL);
+        AssertIO(BitB->Input != NULL);
 
-        size_t ArraySizeInBits   = BitBuffer_GetSize(BitB);
-        size_t ArrayOffset       = BitBuffer_GetPosition(BitB);
-        uint8_t *Array           = BitBuffer_GetArray(BitB);
-        size_t Bytes2Read        = Bits2Bytes(RoundingType_Down, ArraySizeInBits - ArrayOffset);
-        size_t  Bits2Save        = ArrayOffset % 8;
-        if (Bits2Save > 0) {
-            Array[0]             = 0;
-            uint8_t Saved        = Array[Bytes2Read + 1] & (Exponentiate(2, Bits2Save) - 1); // Todo: Add shift
-            Array[0]             = Saved;
-            BitBuffer_SetPosition(BitB, Bits2Save);
-            for (size_t Byte = Bits2Bytes(RoundingType_Down, ArrayOffset); Byte < Bits2Bytes(RoundingType_Down, ArraySizeInBits - ArrayOffset); Byte++) {
-                Array[Byte]      = 0;
+        if (BitBuffer_IsReadOnly(BitB)) {
+            return;
+        }
+        if (BitB->HoldsInput) {
+            BitBuffer_Compact(BitB); // Keep the unread bits, including the partial byte, at the start of the array
+        } else {
+            BitBuffer_InvalidateCache(BitB); // Nothing in the array came from Input, so all of it is replaced
+            BitB->BitOffset           = 0;
+            BitB->NumBits             = 0;
+        }
+        size_t Filled                 = BitBuffer_GetArraySizeInBytes(BitB);
+        size_t Position               = AsynchronousIOStream_GetPosition(BitB->Input);
+        if (BitB->PrefetchDepth == 0) {
+            while (Filled < BitB->Capacity) {
+                size_t BytesRead      = BitBuffer_ReadSynchronously(BitB->Input, &BitB->Buffer[Filled], Position, BitB->Capacity - Filled);
+                if (BytesRead == 0) {
+                    break;
+                }
+                Filled               += BytesRead;
+                Position             += BytesRead;
+            }
+        } else {
+            BitBuffer_StreamRing *Ring = &BitB->InputRing;
+            if (Ring->NumChunks > 0 && (Ring->Stream != BitB->Input || BitBuffer_Ring_GetDeliveryOffset(Ring) != Position)) {
+                BitBuffer_Ring_Deinit(Ring, No); // The stream was moved, or swapped, since the last call; what's prefetched is for somewhere else
+            }
+            if (Ring->NumChunks == 0) {
+                BitBuffer_Ring_Init(Ring, BitB->Input, BitB->PrefetchDepth, BitB->Capacity, Position);
+                for (uint8_t Chunk = 0; Chunk < Ring->NumChunks; Chunk++) {
+                    BitBuffer_Chunk_Submit(Ring, &Ring->Chunks[Chunk], Ring->NextOffset, Ring->ChunkSize, No);
+                    Ring->NextOffset += Ring->ChunkSize;
+                }
+            }
+            while (Filled < BitB->Capacity) {
+                BitBuffer_StreamChunk *Chunk = &Ring->Chunks[Ring->Head];
+                size_t ChunkSize      = BitBuffer_Chunk_Wait(Ring, Chunk, No);
+                size_t Available      = ChunkSize - Chunk->Consumed;
+                size_t Bytes2Copy     = Minimum(Available, BitB->Capacity - Filled);
+                memcpy(&BitB->Buffer[Filled], &Chunk->Data[Chunk->Consumed], Bytes2Copy);
+                Chunk->Consumed      += Bytes2Copy;
+                Filled               += Bytes2Copy;
+                Position             += Bytes2Copy;
+                if (Chunk->Consumed < ChunkSize) {
+                    break; // The array is full, the rest of this chunk is for the next call
+                } else if (ChunkSize < Ring->ChunkSize) {
+                    break; // End of the stream, leave the short chunk in place so the next call sees it too
+                }
+                BitBuffer_Chunk_Submit(Ring, Chunk, Ring->NextOffset, Ring->ChunkSize, No);
+                Ring->NextOffset     += Ring->ChunkSize;
+                Ring->Head            = (Ring->Head + 1) % Ring->NumChunks;
             }
         }
-        size_t BytesRead         = AsynchronousIOStream_Read(BitB->Input, Array, sizeof(Array[0]), Bytes2Read);
-        AssertIO(BytesRead == Bytes2Read);
-        BitBuffer_SetSize(BitB, BytesRead + ArrayOffset);
+        AsynchronousIOStream_SetPosition(BitB->Input, Position);
+        BitB->NumBits                 = Bytes2Bits(Filled);
+        BitB->HoldsInput              = Yes;
     }
 
-    void BitBuffer_WriteStream(BitBuffer *BitB) {
+    bool BitBuffer_WriteStream(BitBuffer *BitB) {
         AssertIO(BitB != NULL);
+        AssertIO(BitB->Output != NULL);
 
-        size_t ArraySizeInBits   = BitBuffer_GetSize(BitB);
-        size_t ArrayOffset       = BitBuffer_GetPosition(BitB);
-        uint8_t *Array           = BitBuffer_GetArray(BitB);
-        size_t Bytes2Write       = Bits2Bytes(RoundingType_Down, BitBuffer_GetPosition(BitB));
-        size_t Bits2Keep         = ArrayOffset % 8;
-        size_t BytesWritten      = AsynchronousIOStream_Write(BitB->Output, Array, sizeof(Array[0]), Bytes2Write);
-        AssertIO(BytesWritten == Bytes2Write);
-        Array[0]             = 0;
-        Array[0]             = Array[Bytes2Write + 1] & (Exponentiate(2, Bits2Keep) << (8 - Bits2Keep));
-        BitBuffer_SetPosition(BitB, Bits2Keep + 1);
-        for (size_t Byte = Bits2Bytes(RoundingType_Up, ArrayOffset); Byte < Bits2Bytes(RoundingType_Down, ArraySizeInBits); Byte++) {
-            Array[Byte]      = 0;
+        if (BitBuffer_IsReadOnly(BitB)) {
+            return No;
+        }
+        BitBuffer_InvalidateCache(BitB);
+        bool   Succeeded              = Yes;
+        size_t Bytes2Write            = BitB->BitOffset / 8;
+        size_t Position               = AsynchronousIOStream_GetPosition(BitB->Output);
+        if (Bytes2Write > 0) {
+            if (BitB->PrefetchDepth == 0) {
+                size_t BytesWritten   = BitBuffer_WriteSynchronously(BitB->Output, BitB->Buffer, Position, Bytes2Write);
+                Succeeded             = BytesWritten == Bytes2Write;
+            } else {
+                BitBuffer_StreamRing *Ring = &BitB->OutputRing;
+                if (Ring->NumChunks > 0 && (Ring->ChunkSize < Bytes2Write || Ring->Stream != BitB->Output || Ring->NextOffset != Position)) {
+                    BitBuffer_Ring_Deinit(Ring, Yes); // The array grew, or the stream moved, so what's in flight has to land before anything newer
+                }
+                if (Ring->NumChunks == 0) {
+                    BitBuffer_Ring_Init(Ring, BitB->Output, BitB->PrefetchDepth, BitB->Capacity, Position);
+                }
+                BitBuffer_StreamChunk *Chunk = &Ring->Chunks[Ring->Head];
+                BitBuffer_Chunk_Wait(Ring, Chunk, Yes);
+                memcpy(Chunk->Data, BitB->Buffer, Bytes2Write);
+                BitBuffer_Chunk_Submit(Ring, Chunk, Position, Bytes2Write, Yes);
+                Ring->NextOffset      = Position + Bytes2Write;
+                Ring->Head            = (Ring->Head + 1) % Ring->NumChunks;
+            }
+            AsynchronousIOStream_SetPosition(BitB->Output, Position + Bytes2Write);
+            if (BitB->BitOffset % 8 != 0) { // Keep the partial byte for the next fields
+                BitB->Buffer[0]       = BitB->Buffer[Bytes2Write];
+            }
+            BitB->BitOffset          %= 8;
         }
+        if (BitB->OutputRing.Failed) { // An earlier write, waited on just now or by SetPrefetchDepth
+            BitB->OutputRing.Failed   = No;
+            Succeeded                 = No;
+        }
+        return Succeeded;
     }
-    
-    static uint64_t BitBuffer_Extract_FarByte_FarBit(BitBuffer *BitB, uint8_t NumBits) {
-        AssertIO(BitB != NULL);
-        AssertIO(NumBits > 0);
 
-        uint64_t Extracted = 0ULL;
-        while (NumBits > 0) {
-            uint8_t  BitsByteCanContain = BitsAvailableInByte(BitB->BitOffset + NumBits);
-            uint8_t  Bits2Get           = (uint8_t) Minimum(BitsByteCanContain, NumBits);
-            uint8_t  Shift              = 8 - Bits2Get;
-            uint8_t  BitMask            = (uint8_t) (Exponentiate(2, Bits2Get) - 1) << Shift;
-            uint64_t Byte               = Bits2Bytes(RoundingType_Down, BitB->BitOffset + NumBits);
-            uint8_t  ExtractedBits      = BitB->Buffer[Byte] & BitMask;
-            uint8_t  ApplyBits          = ExtractedBits >> Shift;
+    /*
+     Bit extraction engine.
+
+     Two bit orders exist in the stream itself:
+       BitOrder_Left2Right: bit 7 of each byte is read first, a 64-bit big endian load MSBit aligned in Cache.
+       BitOrder_Right2Left: bit 0 of each byte is read first, a 64-bit little endian load LSBit aligned in Cache.
+
+     The byte order then decides how the 8 bit groups of the field are assembled:
+       Left2Right bytes with Left2Right bits and Right2Left bytes with Right2Left bits are the natural layouts, no regrouping.
+       The mixed combinations reverse the order of the 8 bit groups, the partial group (NumBits % 8) keeps it's bits.
+
+     Cache always holds the bits starting at CacheOffset, so a read is a compare, a shift, and a mask;
+     the Cache is refilled with a single unaligned 8 byte load whenever it's stale or too small.
+     */
+
+    static uint64_t BitBuffer_Mask(uint8_t NumBits) {
+        return NumBits == 0 ? 0ULL : (~0ULL >> (64 - NumBits));
+    }
+
+    static bool BitBuffer_IsNaturalOrder(BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder) {
+        return (ByteOrder == ByteOrder_Left2Right && BitOrder == BitOrder_Left2Right) || (ByteOrder == ByteOrder_Right2Left && BitOrder == BitOrder_Right2Left);
+    }
+
+    static uint64_t BitBuffer_SwapBytes64(uint64_t Value) {
+#if   (PlatformIO_Compiler == PlatformIO_CompilerIsClang) || (PlatformIO_Compiler == PlatformIO_CompilerIsGCC)
+        return __builtin_bswap64(Value);
+#elif (PlatformIO_Compiler == PlatformIO_CompilerIsMSVC)
+        return _byteswap_uint64(Value);
+#else
+        return SwapEndian64(Value);
+#endif /* PlatformIO_Compiler */
+    }
+
+    static uint64_t BitBuffer_LoadBE64(const uint8_t *Bytes) {
+        uint64_t Value = 0ULL;
+        memcpy(&Value, Bytes, sizeof(Value));
+#if PlatformIO_ByteOrder == PlatformIO_ByteOrderIsLE
+        Value          = BitBuffer_SwapBytes64(Value);
+#endif /* PlatformIO_ByteOrder */
+        return Value;
+    }
+
+    static uint64_t BitBuffer_LoadLE64(const uint8_t *Bytes) {
+        uint64_t Value = 0ULL;
+        memcpy(&Value, Bytes, sizeof(Value));
+#if PlatformIO_ByteOrder == PlatformIO_ByteOrderIsBE
+        Value          = BitBuffer_SwapBytes64(Value);
+#endif /* PlatformIO_ByteOrder */
+        return Value;
+    }
+
+    static void BitBuffer_StoreBE64(uint8_t *Bytes, uint64_t Value) {
+#if PlatformIO_ByteOrder == PlatformIO_ByteOrderIsLE
+        Value          = BitBuffer_SwapBytes64(Value);
+#endif /* PlatformIO_ByteOrder */
+        memcpy(Bytes, &Value, sizeof(Value));
+    }
 
-            Extracted                 <<= Bits2Get;
-            Extracted                  |= ApplyBits;
+    static void BitBuffer_StoreLE64(uint8_t *Bytes, uint64_t Value) {
+#if PlatformIO_ByteOrder == PlatformIO_ByteOrderIsBE
+        Value          = BitBuffer_SwapBytes64(Value);
+#endif /* PlatformIO_ByteOrder */
+        memcpy(Bytes, &Value, sizeof(Value));
+    }
 
-            NumBits                    -= Bits2Get;
-            BitB->BitOffset            += Bits2Get;
+    /* Reads the 8 bytes starting at Byte, bytes past the end of the array are read as zero */
+    static uint64_t BitBuffer_LoadWindow(BitBuffer *BitB, size_t Byte, BufferIO_BitOrders BitOrder) {
+        size_t   ArraySize = BitBuffer_GetArraySizeInBytes(BitB);
+        uint64_t Window    = 0ULL;
+        if (Byte + 8 <= ArraySize) {
+            Window         = BitOrder == BitOrder_Left2Right ? BitBuffer_LoadBE64(&BitB->Buffer[Byte]) : BitBuffer_LoadLE64(&BitB->Buffer[Byte]);
+        } else {
+            for (uint8_t Index = 0; Index < 8; Index++) {
+                uint64_t Value = (Byte + Index) < ArraySize ? BitB->Buffer[Byte + Index] : 0;
+                if (BitOrder == BitOrder_Left2Right) {
+                    Window    |= Value << (56 - (Index * 8));
+                } else {
+                    Window    |= Value << (Index * 8);
+                }
+            }
         }
-        return Extracted;
+        return Window;
     }
-    
-    static uint64_t BitBuffer_Extract_FarByte_NearBit(BitBuffer *BitB, uint8_t NumBits) {
-        AssertIO(BitB != NULL);
-        AssertIO(NumBits > 0);
 
-        uint64_t Extracted = 0ULL;
-        while (NumBits > 0) {
-            uint8_t  BitsByteCanContain = BitsAvailableInByte(BitB->BitOffset + NumBits);
-            uint8_t  Bits2Get           = (uint8_t) Minimum(BitsByteCanContain, NumBits);
-            uint8_t  Shift              = 8 - Bits2Get;
-            uint8_t  BitMask            = (uint8_t) (Exponentiate(2, Bits2Get) - 1) << Shift;
-            uint64_t Byte               = Bits2Bytes(RoundingType_Down, BitB->BitOffset + NumBits);
-            uint8_t  ExtractedBits      = BitB->Buffer[Byte] & BitMask;
-            uint8_t  ApplyBits          = (uint8_t) (ExtractedBits << Shift);
+    static void BitBuffer_Refill(BitBuffer *BitB, BufferIO_BitOrders BitOrder) {
+        uint8_t  Shift        = BitB->BitOffset % 8;
+        uint64_t Window       = BitBuffer_LoadWindow(BitB, BitB->BitOffset / 8, BitOrder);
+        BitB->Cache           = BitOrder == BitOrder_Left2Right ? Window << Shift : Window >> Shift;
+        BitB->CacheSize       = 64 - Shift;
+        BitB->CacheOffset     = BitB->BitOffset;
+        BitB->CacheBitOrder   = BitOrder;
+    }
+
+    static bool BitBuffer_CacheIsStale(BitBuffer *BitB, BufferIO_BitOrders BitOrder, uint8_t NumBits) {
+        return (BitB->CacheOffset != BitB->BitOffset) | (BitB->CacheBitOrder != BitOrder) | (BitB->CacheSize < NumBits);
+    }
+
+    /* Converts a value whose first 8 bit group is the most significant into one whose first group is the least significant */
+    static uint64_t BitBuffer_Regroup_TopFirst2BottomFirst(uint64_t Value, uint8_t NumBits) {
+        uint8_t  Remainder = NumBits % 8;
+        uint8_t  FullBits  = NumBits - Remainder;
+        uint64_t Swapped   = FullBits > 0 ? BitBuffer_SwapBytes64(Value >> Remainder) >> (64 - FullBits) : 0ULL;
+        uint64_t Partial   = Remainder > 0 ? (Value & BitBuffer_Mask(Remainder)) << FullBits : 0ULL;
+        return FullBits > 0 ? Swapped | Partial : Value;
+    }
 
-            Extracted                 <<= Bits2Get;
-            Extracted                  |= ApplyBits;
+    /* The inverse of BitBuffer_Regroup_TopFirst2BottomFirst */
+    static uint64_t BitBuffer_Regroup_BottomFirst2TopFirst(uint64_t Value, uint8_t NumBits) {
+        uint8_t  Remainder = NumBits % 8;
+        uint8_t  FullBits  = NumBits - Remainder;
+        uint64_t Swapped   = FullBits > 0 ? BitBuffer_SwapBytes64(Value & BitBuffer_Mask(FullBits)) >> (64 - FullBits) : 0ULL;
+        uint64_t Partial   = (Remainder > 0 && FullBits > 0) ? Value >> FullBits : 0ULL;
+        return FullBits > 0 ? (Swapped << Remainder) | Partial : Value;
+    }
 
-            NumBits                    -= Bits2Get;
-            BitB->BitOffset            += Bits2Get;
+    static uint64_t BitBuffer_Extract_MSBit(BitBuffer *BitB, uint8_t NumBits) {
+        if (NumBits > 56) { // A refill is only guaranteed to contain 57 bits
+            uint64_t High      = BitBuffer_Extract_MSBit(BitB, NumBits - 32);
+            return (High << 32) | BitBuffer_Extract_MSBit(BitB, 32);
         }
+        if (BitBuffer_CacheIsStale(BitB, BitOrder_Left2Right, NumBits)) {
+            BitBuffer_Refill(BitB, BitOrder_Left2Right);
+        }
+        uint64_t Extracted     = BitB->Cache >> (64 - NumBits);
+        BitB->Cache          <<= NumBits;
+        BitB->CacheSize       -= NumBits;
+        BitB->BitOffset       += NumBits;
+        BitB->CacheOffset      = BitB->BitOffset;
         return Extracted;
     }
-    
-    static uint64_t BitBuffer_Extract_NearByte_FarBit(BitBuffer *BitB, uint8_t NumBits) {
+
+    static uint64_t BitBuffer_Extract_LSBit(BitBuffer *BitB, uint8_t NumBits) {
+        if (NumBits > 56) { // A refill is only guaranteed to contain 57 bits
+            uint64_t Low       = BitBuffer_Extract_LSBit(BitB, 32);
+            return Low | (BitBuffer_Extract_LSBit(BitB, NumBits - 32) << 32);
+        }
+        if (BitBuffer_CacheIsStale(BitB, BitOrder_Right2Left, NumBits)) {
+            BitBuffer_Refill(BitB, BitOrder_Right2Left);
+        }
+        uint64_t Extracted     = BitB->Cache & BitBuffer_Mask(NumBits);
+        BitB->Cache          >>= NumBits;
+        BitB->CacheSize       -= NumBits;
+        BitB->BitOffset       += NumBits;
+        BitB->CacheOffset      = BitB->BitOffset;
+        return Extracted;
+    }
+
+    static uint64_t BitBuffer_Extract_FarByte_FarBit(BitBuffer *BitB, uint8_t NumBits) {
         AssertIO(BitB != NULL);
-        AssertIO(NumBits > 0);
+        AssertIO(NumBits > 0 && NumBits <= 64);
 
-        uint64_t Extracted = 0ULL;
-        while (NumBits > 0) {
-            uint8_t  BitsByteCanContain = BitsAvailableInByte(BitB->BitOffset);
-            uint8_t  Bits2Get           = (uint8_t) Minimum(BitsByteCanContain, NumBits);
-            uint8_t  BufferShift        = 8 - Bits2Get;
-            uint8_t  BufferMask         = (Exponentiate(2, Bits2Get) - 1) << BufferShift;
-            uint8_t  ApplyBits          = BitB->Buffer[Bits2Bytes(RoundingType_Down, BitB->BitOffset)] & BufferMask;
+        return BitBuffer_Extract_MSBit(BitB, NumBits);
+    }
+    
+    static uint64_t BitBuffer_Extract_FarByte_NearBit(BitBuffer *BitB, uint8_t NumBits) {
+        AssertIO(BitB != NULL);
+        AssertIO(NumBits > 0 && NumBits <= 64);
 
-            Extracted                 <<= Bits2Get;
-            Extracted                  |= ApplyBits;
+        return BitBuffer_Regroup_BottomFirst2TopFirst(BitBuffer_Extract_LSBit(BitB, NumBits), NumBits);
+    }
+    
+    static uint64_t BitBuffer_Extract_NearByte_FarBit(BitBuffer *BitB, uint8_t NumBits) {
+        AssertIO(BitB != NULL);
+        AssertIO(NumBits > 0 && NumBits <= 64);
 
-            NumBits                    -= Bits2Get;
-            BitB->BitOffset            += Bits2Get;
-        }
-        return Extracted;
+        return BitBuffer_Regroup_TopFirst2BottomFirst(BitBuffer_Extract_MSBit(BitB, NumBits), NumBits);
     }
     
     static uint64_t BitBuffer_Extract_NearByte_NearBit(BitBuffer *BitB, uint8_t NumBits) {
         AssertIO(BitB != NULL);
-        AssertIO(NumBits > 0);
+        AssertIO(NumBits > 0 && NumBits <= 64);
+
+        return BitBuffer_Extract_LSBit(BitB, NumBits);
+    }
+
+    /* Value must not be 0 */
+    static uint8_t BitBuffer_CountLeadingZeros64(uint64_t Value) {
+#if   (PlatformIO_Compiler == PlatformIO_CompilerIsClang) || (PlatformIO_Compiler == PlatformIO_CompilerIsGCC)
+        return (uint8_t) __builtin_clzll(Value);
+#elif (PlatformIO_Compiler == PlatformIO_CompilerIsMSVC)
+        unsigned long Index = 0;
+        _BitScanReverse64(&Index, Value);
+        return (uint8_t) (63 - Index);
+#else
+        uint8_t Count       = 0;
+        while ((Value & 0x8000000000000000ULL) == 0) {
+            Value         <<= 1;
+            Count          += 1;
+        }
+        return Count;
+#endif /* PlatformIO_Compiler */
+    }
 
-        uint64_t Extracted = 0ULL;
+    /* Value must not be 0 */
+    static uint8_t BitBuffer_CountTrailingZeros64(uint64_t Value) {
+#if   (PlatformIO_Compiler == PlatformIO_CompilerIsClang) || (PlatformIO_Compiler == PlatformIO_CompilerIsGCC)
+        return (uint8_t) __builtin_ctzll(Value);
+#elif (PlatformIO_Compiler == PlatformIO_CompilerIsMSVC)
+        unsigned long Index = 0;
+        _BitScanForward64(&Index, Value);
+        return (uint8_t) Index;
+#else
+        uint8_t Count       = 0;
+        while ((Value & 1) == 0) {
+            Value         >>= 1;
+            Count          += 1;
+        }
+        return Count;
+#endif /* PlatformIO_Compiler */
+    }
+
+    /* Drops NumBits from the front of the Cache, NumBits can be all of it */
+    static void BitBuffer_Consume(BitBuffer *BitB, BufferIO_BitOrders BitOrder, uint8_t NumBits) {
+        if (NumBits >= 64) {
+            BitB->Cache        = 0ULL;
+        } else if (BitOrder == BitOrder_Left2Right) {
+            BitB->Cache      <<= NumBits;
+        } else {
+            BitB->Cache      >>= NumBits;
+        }
+        BitB->CacheSize       -= NumBits;
+        BitB->BitOffset       += NumBits;
+        BitB->CacheOffset      = BitB->BitOffset;
+    }
+
+    /*
+     Counts the bits before the next StopBit and consumes them along with the StopBit.
+     A single bit has no byte order, so only the BitOrder matters; the run is found a whole Cache at a time with CLZ/CTZ.
+     Only the bits before NumBits are looked at: the Cache can hold bits past it, and past the array they're zeros, which would end a run of ones.
+     Without a StopBit before NumBits the whole rest of the array is counted and consumed.
+     */
+    static uint64_t BitBuffer_ScanUnary(BitBuffer *BitB, BufferIO_BitOrders BitOrder, BufferIO_UnaryTerminators StopBit) {
+        uint64_t Count         = 0ULL;
+        while (BitB->BitOffset < BitB->NumBits) {
+            if (BitBuffer_CacheIsStale(BitB, BitOrder, 1)) {
+                BitBuffer_Refill(BitB, BitOrder);
+            }
+            uint8_t  Available = (uint8_t) Minimum(BitB->CacheSize, BitB->NumBits - BitB->BitOffset);
+            uint64_t Window    = StopBit == UnaryTerminator_One ? BitB->Cache : ~BitB->Cache;
+            uint8_t  Run       = 64;
+            if (Window != 0) {
+                Run            = BitOrder == BitOrder_Left2Right ? BitBuffer_CountLeadingZeros64(Window) : BitBuffer_CountTrailingZeros64(Window);
+            }
+            if (Run < Available) {
+                BitBuffer_Consume(BitB, BitOrder, Run + 1);
+                Count         += Run;
+                break;
+            }
+            Count             += Available;
+            BitBuffer_Consume(BitB, BitOrder, Available);
+        }
+        return Count;
+    }
+
+    /* Writes NumBits copies of Bit, in runs of up to 64 */
+    static void BitBuffer_AppendRun(BitBuffer *BitB, BitBuffer_Appender Appender, uint64_t NumBits, uint8_t Bit) {
+        uint64_t Run           = Bit == 1 ? ~0ULL : 0ULL;
         while (NumBits > 0) {
-            uint8_t  BitsByteCanContain = BitsAvailableInByte(BitB->BitOffset);
-            uint8_t  Bits2Get           = (uint8_t) Minimum(BitsByteCanContain, NumBits);
-            uint8_t  Shift              = 8 - Bits2Get;
-            uint8_t  BitMask            = (uint8_t) (Exponentiate(2, Bits2Get) - 1) << Shift;
-            uint64_t Byte               = Bits2Bytes(RoundingType_Down, BitB->BitOffset);
-            uint8_t  ApplyBits          = BitB->Buffer[Byte] & BitMask;
-            ApplyBits                 >>= Shift;
+            uint8_t Bits2Write = (uint8_t) Minimum(NumBits, 64);
+            Appender(BitB, Bits2Write, Run);
+            NumBits           -= Bits2Write;
+        }
+    }
 
-            Extracted                 <<= Bits2Get;
-            Extracted                  |= ApplyBits;
+    static void BitBuffer_Deposit_MSBit(BitBuffer *BitB, uint8_t NumBits, uint64_t Data2Append) {
+        size_t   Byte            = BitB->BitOffset / 8;
+        uint8_t  Shift           = BitB->BitOffset % 8;
+        if (Shift + NumBits <= 64 && Byte + 8 <= BitBuffer_GetArraySizeInBytes(BitB)) {
+            uint8_t  Position    = 64 - (Shift + NumBits);
+            uint64_t Mask        = BitBuffer_Mask(NumBits) << Position;
+            uint64_t Window      = BitBuffer_LoadBE64(&BitB->Buffer[Byte]);
+            Window               = (Window & ~Mask) | ((Data2Append << Position) & Mask);
+            BitBuffer_StoreBE64(&BitB->Buffer[Byte], Window);
+        } else {
+            uint8_t  Bits2Append = NumBits;
+            while (Bits2Append > 0) {
+                uint8_t  Available   = 8 - Shift;
+                uint8_t  Bits2Put    = (uint8_t) Minimum(Available, Bits2Append);
+                uint8_t  Position    = Available - Bits2Put;
+                uint8_t  Mask        = (uint8_t) (BitBuffer_Mask(Bits2Put) << Position);
+                uint8_t  Bits        = (uint8_t) ((Data2Append >> (Bits2Append - Bits2Put)) << Position);
+                BitB->Buffer[Byte]   = (BitB->Buffer[Byte] & ~Mask) | (Bits & Mask);
+                Bits2Append         -= Bits2Put;
+                Byte                += 1;
+                Shift                = 0;
+            }
+        }
+        BitB->BitOffset         += NumBits;
+        BitBuffer_InvalidateCache(BitB);
+    }
 
-            NumBits                    -= Bits2Get;
-            BitB->BitOffset            += Bits2Get;
+    static void BitBuffer_Deposit_LSBit(BitBuffer *BitB, uint8_t NumBits, uint64_t Data2Append) {
+        size_t   Byte            = BitB->BitOffset / 8;
+        uint8_t  Shift           = BitB->BitOffset % 8;
+        if (Shift + NumBits <= 64 && Byte + 8 <= BitBuffer_GetArraySizeInBytes(BitB)) {
+            uint64_t Mask        = BitBuffer_Mask(NumBits) << Shift;
+            uint64_t Window      = BitBuffer_LoadLE64(&BitB->Buffer[Byte]);
+            Window               = (Window & ~Mask) | ((Data2Append << Shift) & Mask);
+            BitBuffer_StoreLE64(&BitB->Buffer[Byte], Window);
+        } else {
+            uint8_t  Bits2Append = NumBits;
+            while (Bits2Append > 0) {
+                uint8_t  Bits2Put    = (uint8_t) Minimum(8 - Shift, Bits2Append);
+                uint8_t  Mask        = (uint8_t) (BitBuffer_Mask(Bits2Put) << Shift);
+                uint8_t  Bits        = (uint8_t) (Data2Append << Shift);
+                BitB->Buffer[Byte]   = (BitB->Buffer[Byte] & ~Mask) | (Bits & Mask);
+                Data2Append        >>= Bits2Put;
+                Bits2Append         -= Bits2Put;
+                Byte                += 1;
+                Shift                = 0;
+            }
         }
-        return Extracted;
+        BitB->BitOffset         += NumBits;
+        BitBuffer_InvalidateCache(BitB);
     }
     
     static void BitBuffer_Append_FarByte_FarBit(BitBuffer *BitB, uint8_t NumBits, uint64_t Data2Append) {
         AssertIO(BitB != NULL);
-        AssertIO(NumBits > 0);
+        AssertIO(NumBits > 0 && NumBits <= 64);
 
-        while (NumBits > 0) {
-            uint8_t  BitsByteCanContain = BitsAvailableInByte(BitB->BitOffset);
-            uint8_t  NumBits2Append     = (uint8_t) Minimum(BitsByteCanContain, NumBits);
-            uint8_t  ExtractBitMask     = (uint8_t) (Exponentiate(2, NumBits2Append) - 1);
-            uint8_t  ExtractedBits      = (Data2Append & ExtractBitMask);
-            uint64_t Byte               = Bits2Bytes(RoundingType_Down, BitB->BitOffset + NumBits);
-            BitB->Buffer[Byte]         |= ExtractedBits;
-            NumBits                    -= NumBits2Append;
-            BitB->BitOffset            += NumBits2Append;
-        }
+        BitBuffer_Deposit_MSBit(BitB, NumBits, Data2Append);
     }
     
     static void BitBuffer_Append_FarByte_NearBit(BitBuffer *BitB, uint8_t NumBits, uint64_t Data2Append) {
         AssertIO(BitB != NULL);
-        AssertIO(NumBits > 0);
+        AssertIO(NumBits > 0 && NumBits <= 64);
 
-        while (NumBits > 0) {
-            uint8_t  BitsByteCanContain = BitsAvailableInByte(BitB->BitOffset);
-            uint8_t  NumBits2Append     = (uint8_t) Minimum(BitsByteCanContain, NumBits);
-            uint8_t  Shift              = BitsByteCanContain - NumBits2Append;
-            uint8_t  ExtractBitMask     = (uint8_t) (Exponentiate(2, NumBits2Append) - 1) << Shift;
-            uint8_t  ExtractedBits      = (Data2Append & ExtractBitMask) >> (NumBits - NumBits2Append);
-            uint64_t Byte               = Bits2Bytes(RoundingType_Down, BitB->BitOffset + NumBits);
-            BitB->Buffer[Byte]         |= ExtractedBits;
-            NumBits                    -= NumBits2Append;
-            BitB->BitOffset            += NumBits2Append;
-        }
+        BitBuffer_Deposit_LSBit(BitB, NumBits, BitBuffer_Regroup_TopFirst2BottomFirst(Data2Append, NumBits));
     }
     
     static void BitBuffer_Append_NearByte_FarBit(BitBuffer *BitB, uint8_t NumBits, uint64_t Data2Append) {
         AssertIO(BitB != NULL);
-        AssertIO(NumBits > 0);
-
-        /*
-         BitOrder =  01234567
-         Buffer   = [AAAAAAAA] [BBBBBBBB] [CCCCCCCC] [DDDDDDDD] [EEEEEEEE] [FFFFFFFF] [GGGGGGGG] [HHHHHHHH]
-         Append   = [SSSSSSSS] [TTTTTTTT] [UUUUUUUU] [VVVVVVVV] [WWWWWWWW] [XXXXXXXX] [YYYYYYYY] [ZZZZZZZZ]
-         
-         NearByte_FarBit = start at byte S, and Bit 7
-         
-         So, if we need to write 6 bits and there's 6 bits available
+        AssertIO(NumBits > 0 && NumBits <= 64);
 
-         The goal here is to extract data from Append in such a way that it can be written in the direction the function name specifies
-
-         for example 0xFFFE for FLAC is in NearByte_FarBit order
-
-         therefore the top byte should be extracted first and the remaining bits last, start at the top.
-
-         So, we need to generate the mask, shift, extract the bits, then apply them.
-
-         Another thing to realize it's a LOT more efficent to just jump the buffer to the end and write backwards than to do all of this shifting.
-
-         So yeah.
-         */
-        while (NumBits > 0) {
-            uint8_t  BitsByteCanContain  = BitsAvailableInByte(BitB->BitOffset);
-            uint8_t  NumBits2Append      = (uint8_t) Minimum(BitsByteCanContain, NumBits);
-            uint8_t  Mask                = Exponentiate(2, NumBits2Append) - 1;
-            uint8_t  Shift               = BitsByteCanContain - NumBits2Append;
-            uint8_t  ExtractedBits       = (Data2Append & Mask) >> Shift;
-            uint64_t Byte                = Bits2Bytes(RoundingType_Down, BitB->BitOffset);
-            BitB->Buffer[Byte]          |= ExtractedBits;
-            NumBits                     -= NumBits2Append;
-            BitB->BitOffset             += NumBits2Append;
-        }
+        BitBuffer_Deposit_MSBit(BitB, NumBits, BitBuffer_Regroup_BottomFirst2TopFirst(Data2Append, NumBits));
     }
     
-    static void BitBuffer_Append_NearByte_NearBit(BitBuffer *BitB, uint8_t NumBits, uint64_t Data2Append) { // Less Specific to More Specific
+    static void BitBuffer_Append_NearByte_NearBit(BitBuffer *BitB, uint8_t NumBits, uint64_t Data2Append) {
         AssertIO(BitB != NULL);
-        AssertIO(NumBits > 0);
+        AssertIO(NumBits > 0 && NumBits <= 64);
 
-        while (NumBits > 0) {
-            uint8_t  BitsByteCanContain  = BitsAvailableInByte(BitB->BitOffset);
-            uint8_t  NumBits2Append      = (uint8_t) Minimum(BitsByteCanContain, NumBits);
-            uint8_t  MaskShift           = NumBits2Append - NumBits2Append;
-            uint64_t Mask                = Exponentiate(2, NumBits2Append) - 1; // Mask is 1 bit short for 0x33 aka 6 bits
-            uint8_t  ExtractedBits       = (Data2Append & Mask) >> MaskShift;
-            uint64_t Byte                = Bits2Bytes(RoundingType_Down, BitB->BitOffset);
-            BitB->Buffer[Byte]          |= ExtractedBits;
-            NumBits                     -= NumBits2Append;
-            BitB->BitOffset             += NumBits2Append;
-        }
+        BitBuffer_Deposit_LSBit(BitB, NumBits, Data2Append);
+    }
+
+    /* Indexed by [ByteOrder][BitOrder], the Unspecified rows and columns are asserted against */
+    static const BitBuffer_Extractor BitBuffer_Extractors[3][3] = {
+        [ByteOrder_Right2Left] = {
+            [BitOrder_Right2Left] = BitBuffer_Extract_NearByte_NearBit,
+            [BitOrder_Left2Right] = BitBuffer_Extract_NearByte_FarBit,
+        },
+        [ByteOrder_Left2Right] = {
+            [BitOrder_Right2Left] = BitBuffer_Extract_FarByte_NearBit,
+            [BitOrder_Left2Right] = BitBuffer_Extract_FarByte_FarBit,
+        },
+    };
+
+    static const BitBuffer_Appender BitBuffer_Appenders[3][3] = {
+        [ByteOrder_Right2Left] = {
+            [BitOrder_Right2Left] = BitBuffer_Append_NearByte_NearBit,
+            [BitOrder_Left2Right] = BitBuffer_Append_NearByte_FarBit,
+        },
+        [ByteOrder_Left2Right] = {
+            [BitOrder_Right2Left] = BitBuffer_Append_FarByte_NearBit,
+            [BitOrder_Left2Right] = BitBuffer_Append_FarByte_FarBit,
+        },
+    };
+
+    void BitBuffer_SetDefaultOrder(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder) {
+        AssertIO(BitB != NULL);
+        AssertIO(ByteOrder != ByteOrder_Unspecified);
+        AssertIO(BitOrder != BitOrder_Unspecified);
+
+        BitB->DefaultExtractor = BitBuffer_Extractors[ByteOrder][BitOrder];
+        BitB->DefaultAppender  = BitBuffer_Appenders[ByteOrder][BitOrder];
     }
     
     static UTF32 *Format_BitBuffer(BitBuffer *BitB, uint8_t Length) {
@@ -465,28 +961,30 @@ extern "C" {
 #pragma gcc diagnostic ignored "-Wshorten-64-to-32"
 #endif /* PlatformIO_Compiler */
     
+    static uint64_t BitBuffer_Peek(BitBuffer *BitB, BitBuffer_Extractor Extractor, uint8_t NumBits) {
+        size_t   BitOffset   = BitB->BitOffset;
+        size_t   CacheOffset = BitB->CacheOffset;
+        uint64_t Cache       = BitB->Cache;
+        uint8_t  CacheSize   = BitB->CacheSize;
+        BufferIO_BitOrders CacheBitOrder = BitB->CacheBitOrder;
+        uint64_t Extracted   = Extractor(BitB, NumBits);
+        if (CacheOffset == BitOffset) { // The Cache was valid before the peek, so it's valid after too
+            BitB->CacheOffset   = CacheOffset;
+            BitB->Cache         = Cache;
+            BitB->CacheSize     = CacheSize;
+            BitB->CacheBitOrder = CacheBitOrder;
+        }
+        BitB->BitOffset      = BitOffset;
+        return Extracted;
+    }
+    
     uint64_t BitBuffer_PeekBits(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t NumBits) {
         AssertIO(BitB != NULL);
         AssertIO(ByteOrder != ByteOrder_Unspecified);
         AssertIO(BitOrder != BitOrder_Unspecified);
         AssertIO(NumBits <= 64);
 
-        uint64_t Extracted = 0;
-        if (ByteOrder == ByteOrder_Right2Left) {
-            if (BitOrder == BitOrder_Right2Left) {
-                Extracted           = BitBuffer_Extract_NearByte_NearBit(BitB, NumBits);
-            } else if (BitOrder == BitOrder_Left2Right) {
-                Extracted           = BitBuffer_Extract_NearByte_FarBit(BitB, NumBits);
-            }
-        } else if (ByteOrder == ByteOrder_Left2Right) {
-            if (BitOrder == BitOrder_Right2Left) {
-                Extracted           = BitBuffer_Extract_FarByte_NearBit(BitB, NumBits);
-            } else if (BitOrder == BitOrder_Left2Right) {
-                Extracted           = BitBuffer_Extract_FarByte_FarBit(BitB, NumBits);
-            }
-        }
-        BitB->BitOffset   -= NumBits;
-        return Extracted;
+        return NumBits > 0 ? BitBuffer_Peek(BitB, BitBuffer_Extractors[ByteOrder][BitOrder], NumBits) : 0ULL;
     }
     
     uint64_t BitBuffer_ReadBits(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t NumBits) {
@@ -495,68 +993,120 @@ extern "C" {
         AssertIO(BitOrder != BitOrder_Unspecified);
         AssertIO(NumBits <= 64);
 
-        uint64_t Extracted = 0ULL;
-        if (ByteOrder == ByteOrder_Right2Left) {
-            if (BitOrder == BitOrder_Right2Left) {
-                Extracted = BitBuffer_Extract_NearByte_NearBit(BitB, NumBits);
-            } else if (BitOrder == BitOrder_Left2Right) {
-                Extracted = BitBuffer_Extract_NearByte_FarBit(BitB, NumBits);
-            }
-        } else if (ByteOrder == ByteOrder_Left2Right) {
-            if (BitOrder == BitOrder_Right2Left) {
-                Extracted = BitBuffer_Extract_FarByte_NearBit(BitB, NumBits);
-            } else if (BitOrder == BitOrder_Left2Right) {
-                Extracted = BitBuffer_Extract_FarByte_FarBit(BitB, NumBits);
-            }
-        }
-        return Extracted;
+        return NumBits > 0 ? BitBuffer_Extractors[ByteOrder][BitOrder](BitB, NumBits) : 0ULL;
     }
 
-    uint64_t BitBuffer_ReadRICE(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, BufferIO_UnaryTerminators Terminator) {
+    uint64_t BitBuffer_PeekBitsDefault(BitBuffer *BitB, uint8_t NumBits) {
         AssertIO(BitB != NULL);
-        AssertIO(ByteOrder != ByteOrder_Unspecified);
-        AssertIO(BitOrder != BitOrder_Unspecified);
-        AssertIO(Terminator == UnaryTerminator_Zero || Terminator == UnaryTerminator_One);
+        AssertIO(NumBits <= 64);
 
-        uint64_t DecodedValue = 0;
+        return NumBits > 0 ? BitBuffer_Peek(BitB, BitB->DefaultExtractor, NumBits) : 0ULL;
+    }
+
+    uint64_t BitBuffer_ReadBitsDefault(BitBuffer *BitB, uint8_t NumBits) {
         AssertIO(BitB != NULL);
-        // Now we just read until we hit the stop bit...
-        
-        return DecodedValue;
+        AssertIO(NumBits <= 64);
+
+        return NumBits > 0 ? BitB->DefaultExtractor(BitB, NumBits) : 0ULL;
     }
-    
-    uint64_t BitBuffer_ReadUnary(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, BufferIO_UnaryTypes UnaryType, BufferIO_UnaryTerminators StopBit) {
+
+    uint64_t BitBuffer_ReadRICE(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, BufferIO_UnaryTerminators Terminator, uint8_t RiceParameter) {
         AssertIO(BitB != NULL);
         AssertIO(ByteOrder != ByteOrder_Unspecified);
         AssertIO(BitOrder != BitOrder_Unspecified);
-        AssertIO(StopBit == UnaryTerminator_Zero || StopBit == UnaryTerminator_One);
+        AssertIO(Terminator == UnaryTerminator_Zero || Terminator == UnaryTerminator_One);
+        AssertIO(RiceParameter < 64);
 
-        uint64_t Extracted = 0ULL;
-        if (UnaryType == UnaryType_Natural) {
-            Extracted   += 1;
-        }
-        uint8_t CurrentBit = StopBit ^ 1;
-        while (CurrentBit != StopBit) {
-            if (ByteOrder == ByteOrder_Right2Left) {
-                if (BitOrder == BitOrder_Right2Left) {
-                    Extracted = BitBuffer_Extract_NearByte_NearBit(BitB, 1);
-                } else if (BitOrder == BitOrder_Left2Right) {
-                    Extracted = BitBuffer_Extract_NearByte_FarBit(BitB, 1);
-                }
-            } else if (ByteOrder == ByteOrder_Left2Right) {
-                if (BitOrder == BitOrder_Right2Left) {
-                    Extracted = BitBuffer_Extract_FarByte_NearBit(BitB, 1);
-                } else if (BitOrder == BitOrder_Left2Right) {
-                    Extracted = BitBuffer_Extract_FarByte_FarBit(BitB, 1);
-                }
-            }
-            Extracted += 1;
-        };
-        BitBuffer_Seek(BitB, 1);
-        return Extracted;
+        uint64_t Quotient     = BitBuffer_ScanUnary(BitB, BitOrder, Terminator);
+        uint64_t Remainder    = RiceParameter > 0 ? BitBuffer_Extractors[ByteOrder][BitOrder](BitB, RiceParameter) : 0ULL;
+        return (Quotient << RiceParameter) | Remainder;
     }
 
-#if   (PlatformIO_Compiler == PlatformIO_CompilerIsClang) || (PlatformIO_Compiler == PlatformIO_CompilerIsGCC)
+    /*
+     Decodes from the array directly instead of through the Cache: one load per value,
+     then CLZ/CTZ for the quotient, and a shift and mask for the remainder.
+     Values that don't fit in the 57+ bits of a single load, or are too close to the end of the array or NumBits, go through BitBuffer_ReadRICE.
+     */
+    void BitBuffer_ReadRICEArray(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, BufferIO_UnaryTerminators Terminator, uint8_t RiceParameter, uint32_t *Array, size_t NumValues) {
+        AssertIO(BitB != NULL);
+        AssertIO(ByteOrder != ByteOrder_Unspecified);
+        AssertIO(BitOrder != BitOrder_Unspecified);
+        AssertIO(Terminator == UnaryTerminator_Zero || Terminator == UnaryTerminator_One);
+        AssertIO(RiceParameter < 32);
+        AssertIO(Array != NULL);
+
+        size_t   ArraySize           = BitBuffer_GetArraySizeInBytes(BitB);
+        bool     Natural             = BitBuffer_IsNaturalOrder(ByteOrder, BitOrder) || RiceParameter <= 1; // 1 bit remainders have no byte order
+        uint64_t Flip                = Terminator == UnaryTerminator_One ? 0ULL : ~0ULL;
+        size_t   Bit                 = BitB->BitOffset;
+        for (size_t Value = 0; Value < NumValues; Value++) {
+            bool     Decoded         = No;
+            if (Natural && (Bit / 8) + 8 <= ArraySize) {
+                uint8_t  Shift       = Bit % 8;
+                uint8_t  Valid       = 64 - Shift;
+                uint64_t Window      = 0ULL;
+                uint8_t  Quotient    = 64;
+                if (BitOrder == BitOrder_Left2Right) {
+                    Window           = BitBuffer_LoadBE64(&BitB->Buffer[Bit / 8]) << Shift;
+                    if ((Window ^ Flip) != 0) {
+                        Quotient     = BitBuffer_CountLeadingZeros64(Window ^ Flip);
+                    }
+                } else {
+                    Window           = BitBuffer_LoadLE64(&BitB->Buffer[Bit / 8]) >> Shift;
+                    if ((Window ^ Flip) != 0) {
+                        Quotient     = BitBuffer_CountTrailingZeros64(Window ^ Flip);
+                    }
+                }
+                if (Quotient + 1 + RiceParameter <= Valid && Bit + Quotient + 1 + RiceParameter <= BitB->NumBits) {
+                    uint64_t Remainder   = 0ULL;
+                    if (RiceParameter > 0 && BitOrder == BitOrder_Left2Right) {
+                        Remainder    = (Window << (Quotient + 1)) >> (64 - RiceParameter);
+                    } else if (RiceParameter > 0) {
+                        Remainder    = (Window >> (Quotient + 1)) & BitBuffer_Mask(RiceParameter);
+                    }
+                    Array[Value]     = (uint32_t) (((uint64_t) Quotient << RiceParameter) | Remainder);
+                    Bit             += Quotient + 1 + RiceParameter;
+                    Decoded          = Yes;
+                }
+            }
+            if (Decoded == No) {
+                BitB->BitOffset      = Bit;
+                Array[Value]         = (uint32_t) BitBuffer_ReadRICE(BitB, ByteOrder, BitOrder, Terminator, RiceParameter);
+                Bit                  = BitB->BitOffset;
+            }
+        }
+        BitB->BitOffset              = Bit;
+        BitBuffer_InvalidateCache(BitB);
+    }
+
+    uint64_t BitBuffer_ReadExpGolomb(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t Order) {
+        AssertIO(BitB != NULL);
+        AssertIO(ByteOrder != ByteOrder_Unspecified);
+        AssertIO(BitOrder != BitOrder_Unspecified);
+        AssertIO(Order < 64);
+
+        uint64_t LeadingZeros = BitBuffer_ScanUnary(BitB, BitOrder, UnaryTerminator_One);
+        uint8_t  Suffix       = (uint8_t) (LeadingZeros + Order);
+        AssertIO(LeadingZeros + Order < 64);
+        uint64_t Bits         = Suffix > 0 ? BitBuffer_Extractors[ByteOrder][BitOrder](BitB, Suffix) : 0ULL;
+        return ((1ULL << Suffix) | Bits) - (1ULL << Order); // The stop bit is the top bit of the value
+    }
+    
+    uint64_t BitBuffer_ReadUnary(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, BufferIO_UnaryTypes UnaryType, BufferIO_UnaryTerminators StopBit) {
+        AssertIO(BitB != NULL);
+        AssertIO(ByteOrder != ByteOrder_Unspecified);
+        AssertIO(BitOrder != BitOrder_Unspecified);
+        AssertIO(UnaryType != UnaryType_Unspecified);
+        AssertIO(StopBit == UnaryTerminator_Zero || StopBit == UnaryTerminator_One);
+
+        uint64_t Extracted = BitBuffer_ScanUnary(BitB, BitOrder, StopBit);
+        if (UnaryType == UnaryType_Natural) {
+            Extracted     += 1;
+        }
+        return Extracted;
+    }
+
+#if   (PlatformIO_Compiler == PlatformIO_CompilerIsClang) || (PlatformIO_Compiler == PlatformIO_CompilerIsGCC)
 #pragma gcc diagnostic pop
 #endif /* PlatformIO_Compiler */
     
@@ -658,102 +1208,510 @@ extern "C" {
         return GUUID;
     }
 
-    uint32_t BitBuffer_CalculateCRC(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, size_t OffsetInBits, size_t NumBytes, uint64_t InitValue, BufferIO_CRCPolynomials Polynomial) {
+    uint32_t BitBuffer_CalculateCRC(BitBuffer *BitB, size_t OffsetInBits, size_t NumBytes, uint32_t InitValue, BufferIO_CRCPolynomials Polynomial) {
         AssertIO(BitB != NULL);
-        AssertIO(OffsetInBits < BitBuffer_GetSize(BitB));
+        AssertIO(Polynomial != CRCPolynomial_Unspecified);
 
-        uint32_t Output = -1;
+        BufferIO_CRC32 CRC;
+        BufferIO_CRC32_Init(&CRC, Polynomial, InitValue);
+        BitBuffer_UpdateCRC(BitB, &CRC, OffsetInBits, NumBytes);
+        return BufferIO_CRC32_Final(&CRC);
+    }
 
-        for (size_t Byte = OffsetInBits; Byte < NumBytes - 1; Byte++) {
-            uint8_t  Data       = BitBuffer_ReadBits(BitB, ByteOrder_Left2Right, BitOrder_Right2Left, 8);
-            Output             ^= Data;
-            for (uint8_t Bit = 0; Bit < 8; Bit++) {
-                if (Output & 1) {
-                    Output = (Output >> 1) ^ Polynomial;
-                } else {
-                    Output >>= 1;
-                }
-            }
-        }
-        return ~Output;
+    void BitBuffer_UpdateCRC(BitBuffer *BitB, BufferIO_CRC32 *CRC, size_t OffsetInBits, size_t NumBytes) {
+        AssertIO(BitB != NULL);
+        AssertIO(CRC != NULL);
+        AssertIO(OffsetInBits % 8 == 0);
+        AssertIO(OffsetInBits + Bytes2Bits(NumBytes) <= BitB->NumBits);
+
+        BufferIO_CRC32_Update(CRC, &BitB->Buffer[Bits2Bytes(RoundingType_Down, OffsetInBits)], NumBytes);
     }
 
     uint32_t BitBuffer_CalculateAdler32(BitBuffer *BitB, size_t OffsetInBits, size_t NumBytes) {
         AssertIO(BitB != NULL);
-        AssertIO(OffsetInBits < BitBuffer_GetSize(BitB));
 
-        uint32_t Output = 0;
-        uint16_t A = 1;
-        uint16_t B = 0;
+        BufferIO_Adler32 Adler;
+        BufferIO_Adler32_Init(&Adler);
+        BitBuffer_UpdateAdler32(BitB, &Adler, OffsetInBits, NumBytes);
+        return BufferIO_Adler32_Final(&Adler);
+    }
 
-        for (size_t Byte = OffsetInBits; Byte < NumBytes - 1; Byte++) {
-            uint8_t Value = BitBuffer_ReadBits(BitB, ByteOrder_Left2Right, BitOrder_Right2Left, 8);
-            A = (A + Value) % 65521;
-            B = (B + A)     % 65521;
-        }
+    void BitBuffer_UpdateAdler32(BitBuffer *BitB, BufferIO_Adler32 *Adler, size_t OffsetInBits, size_t NumBytes) {
+        AssertIO(BitB != NULL);
+        AssertIO(Adler != NULL);
+        AssertIO(OffsetInBits % 8 == 0);
+        AssertIO(OffsetInBits + Bytes2Bits(NumBytes) <= BitB->NumBits);
 
-        Output = (B << 16) | A;
-        return Output;
+        BufferIO_Adler32_Update(Adler, &BitB->Buffer[Bits2Bytes(RoundingType_Down, OffsetInBits)], NumBytes);
     }
     
     void BitBuffer_WriteBits(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t NumBits2Write, uint64_t Bits2Write) {
         AssertIO(BitB != NULL);
         AssertIO(ByteOrder != ByteOrder_Unspecified);
         AssertIO(BitOrder != BitOrder_Unspecified);
-        AssertIO(NumBits2Write > 0);
+        AssertIO(NumBits2Write > 0 && NumBits2Write <= 64);
 
-        if (ByteOrder == ByteOrder_Right2Left) {
-            if (BitOrder == BitOrder_Right2Left) {
-                BitBuffer_Append_NearByte_NearBit(BitB, NumBits2Write, Bits2Write);
-            } else if (BitOrder == BitOrder_Left2Right) {
-                BitBuffer_Append_NearByte_FarBit(BitB, NumBits2Write, Bits2Write);
+        if (BitBuffer_IsReadOnly(BitB)) {
+            return;
+        }
+        BitBuffer_Appenders[ByteOrder][BitOrder](BitB, NumBits2Write, Bits2Write);
+    }
+
+    void BitBuffer_WriteBitsDefault(BitBuffer *BitB, uint8_t NumBits2Write, uint64_t Bits2Write) {
+        AssertIO(BitB != NULL);
+        AssertIO(NumBits2Write > 0 && NumBits2Write <= 64);
+
+        if (BitBuffer_IsReadOnly(BitB)) {
+            return;
+        }
+        BitB->DefaultAppender(BitB, NumBits2Write, Bits2Write);
+    }
+
+    /*
+     Bulk fixed size fields.
+
+     The order is resolved once per call instead of once per field.
+     The natural orders (Left2Right bytes with Left2Right bits, Right2Left bytes with Right2Left bits) are read with one unaligned load per field,
+     and written through a 64 bit accumulator that's flushed a byte at a time.
+     Byte aligned fields of 8, 12, 16, 20, 24, and 32 bits are unpacked 4 or 8 at a time with PSHUFB when the CPU has SSSE3.
+     Fields of a whole number of bytes only depend on the ByteOrder, so those kernels serve the mixed orders too.
+     Everything else, and whatever's left near the end of the array, goes through the Extractors and Appenders.
+     */
+
+    /* Reads the field starting at Bit from a natural order stream, Bit / 8 + 8 must be within the array */
+    static uint64_t BitBuffer_GetField(const uint8_t *Buffer, BufferIO_BitOrders BitOrder, size_t Bit, uint8_t FieldSize) {
+        uint64_t Field = 0ULL;
+        if (BitOrder == BitOrder_Left2Right) {
+            Field      = (BitBuffer_LoadBE64(&Buffer[Bit / 8]) << (Bit % 8)) >> (64 - FieldSize);
+        } else {
+            Field      = (BitBuffer_LoadLE64(&Buffer[Bit / 8]) >> (Bit % 8)) & BitBuffer_Mask(FieldSize);
+        }
+        return Field;
+    }
+
+    /* Number of fields starting at BitOffset that GetField can read without loading past the end of the array */
+    static size_t BitBuffer_GetNumFieldsInWindow(BitBuffer *BitB, uint8_t FieldSize, size_t NumFields) {
+        size_t ArraySize = BitBuffer_GetArraySizeInBytes(BitB);
+        size_t Fields    = 0;
+        if (ArraySize >= 8) {
+            size_t LastBit = Bytes2Bits(ArraySize - 8) + 7; // The last Bit whose 8 byte window is in bounds
+            if (LastBit >= BitB->BitOffset) {
+                Fields     = Minimum(NumFields, ((LastBit - BitB->BitOffset) / FieldSize) + 1);
+            }
+        }
+        return Fields;
+    }
+
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+    static __m128i BitBuffer_SelectLanes(__m128i Even, __m128i Odd, __m128i EvenLanes) {
+        return _mm_or_si128(_mm_and_si128(EvenLanes, Even), _mm_andnot_si128(EvenLanes, Odd));
+    }
+
+    /* Returns the number of fields unpacked, Bytes must be the first byte of the first field */
+    PlatformIO_TargetFeatures("ssse3")
+    static size_t BitBuffer_Unpack16_SSSE3(const uint8_t *Bytes, size_t NumBytes, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t FieldSize, uint16_t *Array, size_t NumFields) {
+        size_t  Field        = 0;
+        size_t  Byte         = 0;
+        __m128i Zero         = _mm_setzero_si128();
+        __m128i EvenLanes    = _mm_set_epi16(0, -1, 0, -1, 0, -1, 0, -1);
+        if (FieldSize == 8) {
+            while (Field + 16 <= NumFields && Byte + 16 <= NumBytes) {
+                __m128i Vector   = _mm_loadu_si128((const __m128i*) &Bytes[Byte]);
+                _mm_storeu_si128((__m128i*) &Array[Field],     _mm_unpacklo_epi8(Vector, Zero));
+                _mm_storeu_si128((__m128i*) &Array[Field + 8], _mm_unpackhi_epi8(Vector, Zero));
+                Field           += 16;
+                Byte            += 16;
+            }
+        } else if (FieldSize == 16) {
+            __m128i Shuffle  = ByteOrder == ByteOrder_Left2Right ? _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14) : _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            while (Field + 8 <= NumFields && Byte + 16 <= NumBytes) {
+                __m128i Vector   = _mm_loadu_si128((const __m128i*) &Bytes[Byte]);
+                _mm_storeu_si128((__m128i*) &Array[Field], _mm_shuffle_epi8(Vector, Shuffle));
+                Field           += 8;
+                Byte            += 16;
             }
-        } else if (ByteOrder == ByteOrder_Left2Right) {
-            if (BitOrder == BitOrder_Right2Left) {
-                BitBuffer_Append_FarByte_NearBit(BitB, NumBits2Write, Bits2Write);
-            } else if (BitOrder == BitOrder_Left2Right) {
-                BitBuffer_Append_FarByte_FarBit(BitB, NumBits2Write, Bits2Write);
+        } else if (FieldSize == 12 && BitBuffer_IsNaturalOrder(ByteOrder, BitOrder)) {
+            bool    MSBit    = BitOrder == BitOrder_Left2Right;
+            __m128i Shuffle  = MSBit ? _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10) : _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+            __m128i Mask     = _mm_set1_epi16(0x0FFF);
+            while (Field + 8 <= NumFields && Byte + 16 <= NumBytes) {
+                __m128i Vector   = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) &Bytes[Byte]), Shuffle);
+                __m128i Shifted  = _mm_srli_epi16(Vector, 4);
+                __m128i Masked   = _mm_and_si128(Vector, Mask);
+                _mm_storeu_si128((__m128i*) &Array[Field], MSBit ? BitBuffer_SelectLanes(Shifted, Masked, EvenLanes) : BitBuffer_SelectLanes(Masked, Shifted, EvenLanes));
+                Field           += 8;
+                Byte            += 12;
             }
         }
+        return Field;
+    }
 
+    /* Returns the number of fields unpacked, Bytes must be the first byte of the first field */
+    PlatformIO_TargetFeatures("ssse3")
+    static size_t BitBuffer_Unpack32_SSSE3(const uint8_t *Bytes, size_t NumBytes, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t FieldSize, uint32_t *Array, size_t NumFields) {
+        size_t  Field        = 0;
+        size_t  Byte         = 0;
+        bool    BigEndian    = ByteOrder == ByteOrder_Left2Right;
+        __m128i EvenLanes    = _mm_set_epi32(0, -1, 0, -1);
+        if (FieldSize == 32) {
+            __m128i Shuffle  = BigEndian ? _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12) : _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            while (Field + 4 <= NumFields && Byte + 16 <= NumBytes) {
+                __m128i Vector   = _mm_loadu_si128((const __m128i*) &Bytes[Byte]);
+                _mm_storeu_si128((__m128i*) &Array[Field], _mm_shuffle_epi8(Vector, Shuffle));
+                Field           += 4;
+                Byte            += 16;
+            }
+        } else if (FieldSize == 24) {
+            __m128i Shuffle  = BigEndian ? _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1) : _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+            while (Field + 4 <= NumFields && Byte + 16 <= NumBytes) {
+                __m128i Vector   = _mm_loadu_si128((const __m128i*) &Bytes[Byte]);
+                _mm_storeu_si128((__m128i*) &Array[Field], _mm_shuffle_epi8(Vector, Shuffle));
+                Field           += 4;
+                Byte            += 12;
+            }
+        } else if (FieldSize == 20 && BitBuffer_IsNaturalOrder(ByteOrder, BitOrder)) {
+            bool    MSBit    = BitOrder == BitOrder_Left2Right;
+            __m128i Shuffle  = MSBit ? _mm_setr_epi8(2, 1, 0, -1, 4, 3, 2, -1, 7, 6, 5, -1, 9, 8, 7, -1) : _mm_setr_epi8(0, 1, 2, -1, 2, 3, 4, -1, 5, 6, 7, -1, 7, 8, 9, -1);
+            __m128i Mask     = _mm_set1_epi32(0x000FFFFF);
+            while (Field + 4 <= NumFields && Byte + 16 <= NumBytes) {
+                __m128i Vector   = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) &Bytes[Byte]), Shuffle);
+                __m128i Shifted  = _mm_srli_epi32(Vector, 4);
+                __m128i Masked   = _mm_and_si128(Vector, Mask);
+                _mm_storeu_si128((__m128i*) &Array[Field], MSBit ? BitBuffer_SelectLanes(Shifted, Masked, EvenLanes) : BitBuffer_SelectLanes(Masked, Shifted, EvenLanes));
+                Field           += 4;
+                Byte            += 10;
+            }
+        }
+        return Field;
     }
-    
-    void BitBuffer_WriteUnary(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, BufferIO_UnaryTypes UnaryType, BufferIO_UnaryTerminators StopBit, uint8_t UnaryBits2Write) {
+#endif /* PlatformIO_Architecture */
+
+    static bool BitBuffer_CanUnpackWithSIMD(BitBuffer *BitB) {
+        bool CanUnpack = false;
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+        CanUnpack      = (BitB->BitOffset % 8 == 0) && (PlatformIO_GetSIMDExtensions() & SIMDExtension_SSSE3) == SIMDExtension_SSSE3;
+#endif /* PlatformIO_Architecture */
+        return CanUnpack;
+    }
+
+    static void BitBuffer_AssertFieldsFit(BitBuffer *BitB, uint8_t FieldSize, size_t NumFields) {
+        AssertIO(NumFields <= (BitB->NumBits - BitB->BitOffset) / FieldSize);
+    }
+
+    void BitBuffer_ReadBitsArray16(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t FieldSize, uint16_t *Array, size_t NumFields) {
         AssertIO(BitB != NULL);
         AssertIO(ByteOrder != ByteOrder_Unspecified);
         AssertIO(BitOrder != BitOrder_Unspecified);
-        AssertIO(UnaryType != UnaryType_Unspecified);
+        AssertIO(FieldSize > 0 && FieldSize <= 16);
+        AssertIO(Array != NULL);
+        BitBuffer_AssertFieldsFit(BitB, FieldSize, NumFields);
+
+        size_t Field             = 0;
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+        if (BitBuffer_CanUnpackWithSIMD(BitB)) {
+            size_t Byte          = BitB->BitOffset / 8;
+            Field                = BitBuffer_Unpack16_SSSE3(&BitB->Buffer[Byte], BitBuffer_GetArraySizeInBytes(BitB) - Byte, ByteOrder, BitOrder, FieldSize, Array, NumFields);
+            BitB->BitOffset     += Field * FieldSize;
+        }
+#endif /* PlatformIO_Architecture */
+        if (BitBuffer_IsNaturalOrder(ByteOrder, BitOrder)) {
+            size_t Fields2Read   = Field + BitBuffer_GetNumFieldsInWindow(BitB, FieldSize, NumFields - Field);
+            size_t Bit           = BitB->BitOffset;
+            while (Field < Fields2Read) {
+                Array[Field]     = (uint16_t) BitBuffer_GetField(BitB->Buffer, BitOrder, Bit, FieldSize);
+                Bit             += FieldSize;
+                Field           += 1;
+            }
+            BitB->BitOffset      = Bit;
+        }
+        BitBuffer_Extractor Extractor = BitBuffer_Extractors[ByteOrder][BitOrder];
+        while (Field < NumFields) {
+            Array[Field]         = (uint16_t) Extractor(BitB, FieldSize);
+            Field               += 1;
+        }
+        BitBuffer_InvalidateCache(BitB);
+    }
 
-        uint8_t EndBit      = StopBit == UnaryTerminator_Zero ? 0 : 1;
-        uint8_t Field2Write = UnaryBits2Write;
-        if (UnaryType == UnaryType_Natural) {
-            Field2Write -= 1;
+    void BitBuffer_ReadBitsArray32(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t FieldSize, uint32_t *Array, size_t NumFields) {
+        AssertIO(BitB != NULL);
+        AssertIO(ByteOrder != ByteOrder_Unspecified);
+        AssertIO(BitOrder != BitOrder_Unspecified);
+        AssertIO(FieldSize > 0 && FieldSize <= 32);
+        AssertIO(Array != NULL);
+        BitBuffer_AssertFieldsFit(BitB, FieldSize, NumFields);
+
+        size_t Field             = 0;
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+        if (BitBuffer_CanUnpackWithSIMD(BitB)) {
+            size_t Byte          = BitB->BitOffset / 8;
+            Field                = BitBuffer_Unpack32_SSSE3(&BitB->Buffer[Byte], BitBuffer_GetArraySizeInBytes(BitB) - Byte, ByteOrder, BitOrder, FieldSize, Array, NumFields);
+            BitB->BitOffset     += Field * FieldSize;
+        }
+#endif /* PlatformIO_Architecture */
+        if (BitBuffer_IsNaturalOrder(ByteOrder, BitOrder)) {
+            size_t Fields2Read   = Field + BitBuffer_GetNumFieldsInWindow(BitB, FieldSize, NumFields - Field);
+            size_t Bit           = BitB->BitOffset;
+            while (Field < Fields2Read) {
+                Array[Field]     = (uint32_t) BitBuffer_GetField(BitB->Buffer, BitOrder, Bit, FieldSize);
+                Bit             += FieldSize;
+                Field           += 1;
+            }
+            BitB->BitOffset      = Bit;
+        }
+        BitBuffer_Extractor Extractor = BitBuffer_Extractors[ByteOrder][BitOrder];
+        while (Field < NumFields) {
+            Array[Field]         = (uint32_t) Extractor(BitB, FieldSize);
+            Field               += 1;
+        }
+        BitBuffer_InvalidateCache(BitB);
+    }
+
+    void BitBuffer_ReadBitsArray64(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t FieldSize, uint64_t *Array, size_t NumFields) {
+        AssertIO(BitB != NULL);
+        AssertIO(ByteOrder != ByteOrder_Unspecified);
+        AssertIO(BitOrder != BitOrder_Unspecified);
+        AssertIO(FieldSize > 0 && FieldSize <= 64);
+        AssertIO(Array != NULL);
+        BitBuffer_AssertFieldsFit(BitB, FieldSize, NumFields);
+
+        size_t Field             = 0;
+        if (BitBuffer_IsNaturalOrder(ByteOrder, BitOrder) && FieldSize <= 56) { // Bit % 8 + FieldSize must fit in one load
+            size_t Fields2Read   = BitBuffer_GetNumFieldsInWindow(BitB, FieldSize, NumFields);
+            size_t Bit           = BitB->BitOffset;
+            while (Field < Fields2Read) {
+                Array[Field]     = BitBuffer_GetField(BitB->Buffer, BitOrder, Bit, FieldSize);
+                Bit             += FieldSize;
+                Field           += 1;
+            }
+            BitB->BitOffset      = Bit;
+        }
+        BitBuffer_Extractor Extractor = BitBuffer_Extractors[ByteOrder][BitOrder];
+        while (Field < NumFields) {
+            Array[Field]         = Extractor(BitB, FieldSize);
+            Field               += 1;
+        }
+        BitBuffer_InvalidateCache(BitB);
+    }
+
+    /*
+     The Packer accumulates fields in Accumulator until the next one wouldn't fit, then flushes the whole bytes.
+     Pending is always less than 8 after a flush, so fields up to 57 bits can be packed.
+     */
+    typedef struct BitBuffer_Packer {
+        uint64_t Accumulator;
+        size_t   Byte;
+        uint8_t  Pending;
+    } BitBuffer_Packer;
+
+    static BitBuffer_Packer BitBuffer_Packer_Init(BitBuffer *BitB, BufferIO_BitOrders BitOrder) {
+        BitBuffer_Packer Packer = {
+            .Accumulator = 0ULL,
+            .Byte        = BitB->BitOffset / 8,
+            .Pending     = BitB->BitOffset % 8,
+        };
+        if (Packer.Pending > 0) { // Keep the bits already in the first byte
+            uint8_t Existing   = BitB->Buffer[Packer.Byte];
+            Packer.Accumulator = BitOrder == BitOrder_Left2Right ? Existing >> (8 - Packer.Pending) : Existing & BitBuffer_Mask(Packer.Pending);
+        }
+        return Packer;
+    }
+
+    static void BitBuffer_Packer_Append(BitBuffer_Packer *Packer, uint8_t *Buffer, BufferIO_BitOrders BitOrder, uint8_t FieldSize, uint64_t Field) {
+        Field                            &= BitBuffer_Mask(FieldSize);
+        if (BitOrder == BitOrder_Left2Right) {
+            if (Packer->Pending + FieldSize > 64) {
+                while (Packer->Pending >= 8) {
+                    Packer->Pending      -= 8;
+                    Buffer[Packer->Byte]  = (uint8_t) (Packer->Accumulator >> Packer->Pending);
+                    Packer->Byte         += 1;
+                }
+                Packer->Accumulator      &= BitBuffer_Mask(Packer->Pending);
+            }
+            Packer->Accumulator           = (Packer->Accumulator << FieldSize) | Field;
+        } else {
+            if (Packer->Pending + FieldSize > 64) {
+                while (Packer->Pending >= 8) {
+                    Buffer[Packer->Byte]  = (uint8_t) Packer->Accumulator;
+                    Packer->Accumulator >>= 8;
+                    Packer->Pending      -= 8;
+                    Packer->Byte         += 1;
+                }
+            }
+            Packer->Accumulator          |= Field << Packer->Pending;
+        }
+        Packer->Pending                  += FieldSize;
+    }
+
+    static void BitBuffer_Packer_Flush(BitBuffer_Packer *Packer, uint8_t *Buffer, BufferIO_BitOrders BitOrder) {
+        if (BitOrder == BitOrder_Left2Right) {
+            while (Packer->Pending >= 8) {
+                Packer->Pending          -= 8;
+                Buffer[Packer->Byte]      = (uint8_t) (Packer->Accumulator >> Packer->Pending);
+                Packer->Byte             += 1;
+            }
+            if (Packer->Pending > 0) { // Keep the bits after the last field
+                uint8_t Unused            = 8 - Packer->Pending;
+                Buffer[Packer->Byte]      = (uint8_t) ((Packer->Accumulator << Unused) | (Buffer[Packer->Byte] & BitBuffer_Mask(Unused)));
+            }
+        } else {
+            while (Packer->Pending >= 8) {
+                Buffer[Packer->Byte]      = (uint8_t) Packer->Accumulator;
+                Packer->Accumulator     >>= 8;
+                Packer->Pending          -= 8;
+                Packer->Byte             += 1;
+            }
+            if (Packer->Pending > 0) {
+                uint8_t Mask              = (uint8_t) BitBuffer_Mask(Packer->Pending);
+                Buffer[Packer->Byte]      = (uint8_t) ((Packer->Accumulator & Mask) | (Buffer[Packer->Byte] & ~Mask));
+            }
         }
+        Packer->Pending                   = 0;
+    }
+
+    void BitBuffer_WriteBitsArray16(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t FieldSize, const uint16_t *Array, size_t NumFields) {
+        AssertIO(BitB != NULL);
+        AssertIO(ByteOrder != ByteOrder_Unspecified);
+        AssertIO(BitOrder != BitOrder_Unspecified);
+        AssertIO(FieldSize > 0 && FieldSize <= 16);
+        AssertIO(Array != NULL);
+        BitBuffer_AssertFieldsFit(BitB, FieldSize, NumFields);
+
+        if (BitBuffer_IsReadOnly(BitB)) {
+            return;
+        }
+        if (BitBuffer_IsNaturalOrder(ByteOrder, BitOrder)) {
+            BitBuffer_Packer Packer = BitBuffer_Packer_Init(BitB, BitOrder);
+            for (size_t Field = 0; Field < NumFields; Field++) {
+                BitBuffer_Packer_Append(&Packer, BitB->Buffer, BitOrder, FieldSize, Array[Field]);
+            }
+            BitBuffer_Packer_Flush(&Packer, BitB->Buffer, BitOrder);
+            BitB->BitOffset        += NumFields * FieldSize;
+            BitBuffer_InvalidateCache(BitB);
+        } else {
+            BitBuffer_Appender Appender = BitBuffer_Appenders[ByteOrder][BitOrder];
+            for (size_t Field = 0; Field < NumFields; Field++) {
+                Appender(BitB, FieldSize, Array[Field]);
+            }
+        }
+    }
+
+    void BitBuffer_WriteBitsArray32(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t FieldSize, const uint32_t *Array, size_t NumFields) {
+        AssertIO(BitB != NULL);
+        AssertIO(ByteOrder != ByteOrder_Unspecified);
+        AssertIO(BitOrder != BitOrder_Unspecified);
+        AssertIO(FieldSize > 0 && FieldSize <= 32);
+        AssertIO(Array != NULL);
+        BitBuffer_AssertFieldsFit(BitB, FieldSize, NumFields);
 
-        if (ByteOrder == ByteOrder_Right2Left) {
-            if (BitOrder == BitOrder_Right2Left) {
-                BitBuffer_Append_FarByte_FarBit(BitB, (uint8_t) Logarithm(2, Field2Write), StopBit ^ 1);
-                BitBuffer_Append_FarByte_FarBit(BitB, 1, EndBit);
-            } else if (BitOrder == BitOrder_Left2Right) {
-                BitBuffer_Append_FarByte_NearBit(BitB, (uint8_t) Logarithm(2, Field2Write), StopBit ^ 1);
-                BitBuffer_Append_FarByte_NearBit(BitB, 1, EndBit);
+        if (BitBuffer_IsReadOnly(BitB)) {
+            return;
+        }
+        if (BitBuffer_IsNaturalOrder(ByteOrder, BitOrder)) {
+            BitBuffer_Packer Packer = BitBuffer_Packer_Init(BitB, BitOrder);
+            for (size_t Field = 0; Field < NumFields; Field++) {
+                BitBuffer_Packer_Append(&Packer, BitB->Buffer, BitOrder, FieldSize, Array[Field]);
             }
-        } else if (ByteOrder == ByteOrder_Left2Right) {
-            if (BitOrder == BitOrder_Right2Left) {
-                BitBuffer_Append_NearByte_FarBit(BitB, (uint8_t) Logarithm(2, Field2Write), StopBit ^ 1);
-                BitBuffer_Append_NearByte_FarBit(BitB, 1, EndBit);
-            } else if (BitOrder == BitOrder_Left2Right) {
-                BitBuffer_Append_NearByte_NearBit(BitB, (uint8_t) Logarithm(2, Field2Write), StopBit ^ 1);
-                BitBuffer_Append_NearByte_NearBit(BitB, 1, EndBit);
+            BitBuffer_Packer_Flush(&Packer, BitB->Buffer, BitOrder);
+            BitB->BitOffset        += NumFields * FieldSize;
+            BitBuffer_InvalidateCache(BitB);
+        } else {
+            BitBuffer_Appender Appender = BitBuffer_Appenders[ByteOrder][BitOrder];
+            for (size_t Field = 0; Field < NumFields; Field++) {
+                Appender(BitB, FieldSize, Array[Field]);
+            }
+        }
+    }
+
+    void BitBuffer_WriteBitsArray64(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t FieldSize, const uint64_t *Array, size_t NumFields) {
+        AssertIO(BitB != NULL);
+        AssertIO(ByteOrder != ByteOrder_Unspecified);
+        AssertIO(BitOrder != BitOrder_Unspecified);
+        AssertIO(FieldSize > 0 && FieldSize <= 64);
+        AssertIO(Array != NULL);
+        BitBuffer_AssertFieldsFit(BitB, FieldSize, NumFields);
+
+        if (BitBuffer_IsReadOnly(BitB)) {
+            return;
+        }
+        if (BitBuffer_IsNaturalOrder(ByteOrder, BitOrder) && FieldSize <= 57) {
+            BitBuffer_Packer Packer = BitBuffer_Packer_Init(BitB, BitOrder);
+            for (size_t Field = 0; Field < NumFields; Field++) {
+                BitBuffer_Packer_Append(&Packer, BitB->Buffer, BitOrder, FieldSize, Array[Field]);
+            }
+            BitBuffer_Packer_Flush(&Packer, BitB->Buffer, BitOrder);
+            BitB->BitOffset        += NumFields * FieldSize;
+            BitBuffer_InvalidateCache(BitB);
+        } else {
+            BitBuffer_Appender Appender = BitBuffer_Appenders[ByteOrder][BitOrder];
+            for (size_t Field = 0; Field < NumFields; Field++) {
+                Appender(BitB, FieldSize, Array[Field]);
             }
         }
     }
     
+    void BitBuffer_WriteUnary(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, BufferIO_UnaryTypes UnaryType, BufferIO_UnaryTerminators StopBit, uint64_t Field2Write) {
+        AssertIO(BitB != NULL);
+        AssertIO(ByteOrder != ByteOrder_Unspecified);
+        AssertIO(BitOrder != BitOrder_Unspecified);
+        AssertIO(UnaryType != UnaryType_Unspecified);
+        AssertIO(StopBit == UnaryTerminator_Zero || StopBit == UnaryTerminator_One);
+        AssertIO(UnaryType != UnaryType_Natural || Field2Write > 0);
+
+        if (BitBuffer_IsReadOnly(BitB)) {
+            return;
+        }
+        BitBuffer_Appender Appender = BitBuffer_Appenders[ByteOrder][BitOrder];
+        uint64_t Run                = UnaryType == UnaryType_Natural ? Field2Write - 1 : Field2Write;
+        BitBuffer_AppendRun(BitB, Appender, Run, StopBit ^ 1);
+        Appender(BitB, 1, StopBit);
+    }
+
+    void BitBuffer_WriteRICE(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, BufferIO_UnaryTerminators Terminator, uint8_t RiceParameter, uint64_t Value2Write) {
+        AssertIO(BitB != NULL);
+        AssertIO(ByteOrder != ByteOrder_Unspecified);
+        AssertIO(BitOrder != BitOrder_Unspecified);
+        AssertIO(Terminator == UnaryTerminator_Zero || Terminator == UnaryTerminator_One);
+        AssertIO(RiceParameter < 64);
+
+        if (BitBuffer_IsReadOnly(BitB)) {
+            return;
+        }
+        BitBuffer_Appender Appender = BitBuffer_Appenders[ByteOrder][BitOrder];
+        BitBuffer_AppendRun(BitB, Appender, Value2Write >> RiceParameter, Terminator ^ 1);
+        Appender(BitB, 1, Terminator);
+        if (RiceParameter > 0) {
+            Appender(BitB, RiceParameter, Value2Write & BitBuffer_Mask(RiceParameter));
+        }
+    }
+
+    void BitBuffer_WriteExpGolomb(BitBuffer *BitB, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t Order, uint64_t Value2Write) {
+        AssertIO(BitB != NULL);
+        AssertIO(ByteOrder != ByteOrder_Unspecified);
+        AssertIO(BitOrder != BitOrder_Unspecified);
+        AssertIO(Order < 64);
+        AssertIO(Value2Write <= ~0ULL - (1ULL << Order));
+
+        if (BitBuffer_IsReadOnly(BitB)) {
+            return;
+        }
+        BitBuffer_Appender Appender = BitBuffer_Appenders[ByteOrder][BitOrder];
+        uint64_t Offset             = Value2Write + (1ULL << Order);
+        uint8_t  Suffix             = 63 - BitBuffer_CountLeadingZeros64(Offset); // Bits after the stop bit
+        BitBuffer_AppendRun(BitB, Appender, Suffix - Order, 0);
+        Appender(BitB, 1, 1);
+        if (Suffix > 0) {
+            Appender(BitB, Suffix, Offset & BitBuffer_Mask(Suffix));
+        }
+    }
+    
     void BitBuffer_WriteUTF8(BitBuffer *BitB, PlatformIO_Immutable(UTF8 *)  String2Write, BufferIO_StringTerminators WriteType) {
         AssertIO(BitB != NULL);
         AssertIO(String2Write != NULL);
         AssertIO(WriteType == StringTerminator_NULL || WriteType == StringTerminator_Sized);
 
+        if (BitBuffer_IsReadOnly(BitB)) {
+            return;
+        }
         size_t CodeUnit        = 0ULL;
         while (String2Write[CodeUnit] != TextIO_NULLTerminator) {
             BitBuffer_Append_NearByte_FarBit(BitB, UTF8CodeUnitSizeInBits, String2Write[CodeUnit]);
@@ -769,6 +1727,9 @@ extern "C" {
         AssertIO(String2Write != NULL);
         AssertIO(WriteType == StringTerminator_NULL || WriteType == StringTerminator_Sized);
 
+        if (BitBuffer_IsReadOnly(BitB)) {
+            return;
+        }
         size_t CodeUnit        = 0ULL;
         while (String2Write[CodeUnit] != TextIO_NULLTerminator) {
             BitBuffer_Append_NearByte_FarBit(BitB, UTF16CodeUnitSizeInBits, String2Write[CodeUnit]);
@@ -783,6 +1744,9 @@ extern "C" {
         AssertIO(BitB != NULL);
         AssertIO(GUUID2Write != NULL);
 
+        if (BitBuffer_IsReadOnly(BitB)) {
+            return;
+        }
         static const uint8_t GUUIDSizeInBits[4] = {168, 168, 128, 128};
         if (BitB->BitOffset + GUUIDSizeInBits[GUUIDType] <= BitB->NumBits) {
             uint8_t GUUIDSize = ((GUUIDType == GUUIDType_GUIDString || GUUIDType == GUUIDType_UUIDString) ? GUUIDString_Size : BinaryGUUID_Size);
@@ -795,53 +1759,571 @@ extern "C" {
     void BitBuffer_Deinit(BitBuffer *BitB) {
         AssertIO(BitB != NULL);
 
-        free(BitB->Buffer);
+        BitBuffer_Ring_Deinit(&BitB->InputRing, No);
+        BitBuffer_Ring_Deinit(&BitB->OutputRing, Yes);
+        if (BitB->Mapping != NULL) {
+            FileIO_MapView_Deinit(BitB->Mapping);
+        } else {
+            free(BitB->Buffer);
+        }
         free(BitB);
     }
     /* BitBuffer Resource Management */
     /* End BitBuffer section */
 
+    /* BitBufferPool */
+    typedef enum BitBufferPoolConstants {
+        BitBufferPool_NumClasses      = 64,
+        BitBufferPool_SmallestClass   = 6, // 64 bytes
+        BitBufferPool_ThreadCacheSize = 8, // BitBuffers per class each thread holds on to
+        BitBufferPool_ThreadCachePools = 4, // Pools each thread caches for at once
+    } BitBufferPoolConstants;
+
+    /* Size class N holds BitBuffers whose Capacity is at least 2^N bytes */
+    typedef struct BitBufferPool {
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        pthread_mutex_t               Lock;
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        SRWLOCK                       Lock;
+#endif /* PlatformIO_TargetOS */
+        BitBuffer                    *FreeLists[BitBufferPool_NumClasses];
+        BufferIO_BitBufferPoolOptions Options;
+    } BitBufferPool;
+
+    /* One pool's BitBuffers cached by one thread, Pool is NULL while the slot is free */
+    typedef struct BitBufferPool_ThreadCache {
+        BitBufferPool                *Pool;
+        BitBuffer                    *FreeLists[BitBufferPool_NumClasses];
+        uint8_t                       NumCached[BitBufferPool_NumClasses];
+    } BitBufferPool_ThreadCache;
+
+    static PlatformIO_ThreadLocal BitBufferPool_ThreadCache BitBufferPool_Caches[BitBufferPool_ThreadCachePools];
+
+    /* The calling thread's cache for Pool; with Claim a free slot is taken for it, NULL when there is none */
+    static BitBufferPool_ThreadCache *BitBufferPool_GetThreadCache(BitBufferPool *Pool, bool Claim) {
+        BitBufferPool_ThreadCache *Free = NULL;
+        for (uint8_t Slot = 0; Slot < BitBufferPool_ThreadCachePools; Slot++) {
+            if (BitBufferPool_Caches[Slot].Pool == Pool) {
+                return &BitBufferPool_Caches[Slot];
+            } else if (Free == NULL && BitBufferPool_Caches[Slot].Pool == NULL) {
+                Free                  = &BitBufferPool_Caches[Slot];
+            }
+        }
+        if (Claim && Free != NULL) {
+            Free->Pool                = Pool;
+            return Free;
+        }
+        return NULL;
+    }
+
+    static void BitBufferPool_Lock(BitBufferPool *Pool) {
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        pthread_mutex_lock(&Pool->Lock);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        AcquireSRWLockExclusive(&Pool->Lock);
+#endif /* PlatformIO_TargetOS */
+    }
+
+    static void BitBufferPool_Unlock(BitBufferPool *Pool) {
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        pthread_mutex_unlock(&Pool->Lock);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        ReleaseSRWLockExclusive(&Pool->Lock);
+#endif /* PlatformIO_TargetOS */
+    }
+
+    /* The smallest class that fits NumBytes */
+    static uint8_t BitBufferPool_GetClass(size_t NumBytes) {
+        if (NumBytes <= ((size_t) 1 << BitBufferPool_SmallestClass)) {
+            return BitBufferPool_SmallestClass;
+        }
+        return 64 - BitBuffer_CountLeadingZeros64(NumBytes - 1);
+    }
+
+    BitBufferPool *BitBufferPool_Init(BufferIO_BitBufferPoolOptions Options) {
+        BitBufferPool *Pool           = calloc(1, sizeof(BitBufferPool));
+        AssertIO(Pool != NULL);
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        pthread_mutex_init(&Pool->Lock, NULL);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        InitializeSRWLock(&Pool->Lock);
+#endif /* PlatformIO_TargetOS */
+        Pool->Options                 = Options;
+        return Pool;
+    }
+
+    BitBuffer *BitBufferPool_Acquire(BitBufferPool *Pool, size_t BitBufferSize) {
+        AssertIO(Pool != NULL);
+        AssertIO((BitBufferSize % 8) == 0);
+
+        uint8_t    Class              = BitBufferPool_GetClass(BitBufferSize);
+        bool       ZeroArray          = (Pool->Options & BitBufferPoolOption_ZeroOnAcquire) == BitBufferPoolOption_ZeroOnAcquire;
+        BitBuffer *BitB               = NULL;
+        BitBufferPool_ThreadCache *Cache = BitBufferPool_GetThreadCache(Pool, No);
+        if (Cache != NULL && Cache->NumCached[Class] > 0) {
+            BitB                      = Cache->FreeLists[Class];
+            Cache->FreeLists[Class]   = BitB->NextFree;
+            Cache->NumCached[Class]  -= 1;
+        } else {
+            BitBufferPool_Lock(Pool);
+            BitB                      = Pool->FreeLists[Class];
+            if (BitB != NULL) {
+                Pool->FreeLists[Class] = BitB->NextFree;
+            }
+            BitBufferPool_Unlock(Pool);
+        }
+
+        if (BitB == NULL) {
+            BitB                      = calloc(1, sizeof(BitBuffer));
+            AssertIO(BitB != NULL);
+            BitB->Capacity            = (size_t) 1 << Class;
+            BitB->Buffer              = ZeroArray ? calloc(BitB->Capacity, sizeof(uint8_t)) : malloc(BitB->Capacity);
+            AssertIO(BitB->Buffer != NULL);
+        } else if (ZeroArray && BitBufferSize > 0) {
+            BufferIO_MemorySet8(BitB->Buffer, 0, BitBufferSize);
+        }
+        BitB->NextFree                = NULL;
+        BitB->NumBits                 = Bytes2Bits(BitBufferSize);
+        BitB->BitOffset               = 0;
+        BitB->HoldsInput              = No;
+        BitB->DefaultExtractor        = BitBuffer_Extract_FarByte_FarBit;
+        BitB->DefaultAppender         = BitBuffer_Append_FarByte_FarBit;
+        BitBuffer_InvalidateCache(BitB);
+        return BitB;
+    }
+
+    void BitBufferPool_Release(BitBufferPool *Pool, BitBuffer *BitB) {
+        AssertIO(Pool != NULL);
+        AssertIO(BitB != NULL);
+
+        if (BitB->Mapping != NULL || BitB->Capacity < ((size_t) 1 << BitBufferPool_SmallestClass)) {
+            BitBuffer_Deinit(BitB);
+            return;
+        }
+        BitBuffer_Ring_Deinit(&BitB->InputRing, No);
+        BitBuffer_Ring_Deinit(&BitB->OutputRing, Yes);
+        BitB->OutputRing.Failed       = No;
+        BitB->Input                   = NULL;
+        BitB->Output                  = NULL;
+        BitB->PrefetchDepth           = 0;
+
+        uint8_t Class                 = 63 - BitBuffer_CountLeadingZeros64(BitB->Capacity); // The largest class it still satisfies
+        BitBufferPool_ThreadCache *Cache = BitBufferPool_GetThreadCache(Pool, (Pool->Options & BitBufferPoolOption_ThreadCaches) == BitBufferPoolOption_ThreadCaches);
+        if (Cache != NULL && Cache->NumCached[Class] < BitBufferPool_ThreadCacheSize) {
+            BitB->NextFree            = Cache->FreeLists[Class];
+            Cache->FreeLists[Class]   = BitB;
+            Cache->NumCached[Class]  += 1;
+        } else {
+            BitBufferPool_Lock(Pool);
+            BitB->NextFree            = Pool->FreeLists[Class];
+            Pool->FreeLists[Class]    = BitB;
+            BitBufferPool_Unlock(Pool);
+        }
+    }
+
+    void BitBufferPool_FlushThreadCache(BitBufferPool *Pool) {
+        AssertIO(Pool != NULL);
+
+        BitBufferPool_ThreadCache *Cache = BitBufferPool_GetThreadCache(Pool, No);
+        if (Cache != NULL) {
+            BitBufferPool_Lock(Pool);
+            for (uint8_t Class = 0; Class < BitBufferPool_NumClasses; Class++) {
+                while (Cache->FreeLists[Class] != NULL) {
+                    BitBuffer *BitB   = Cache->FreeLists[Class];
+                    Cache->FreeLists[Class] = BitB->NextFree;
+                    BitB->NextFree    = Pool->FreeLists[Class];
+                    Pool->FreeLists[Class] = BitB;
+                }
+                Cache->NumCached[Class] = 0;
+            }
+            BitBufferPool_Unlock(Pool);
+            Cache->Pool               = NULL;
+        }
+    }
+
+    void BitBufferPool_Deinit(BitBufferPool *Pool) {
+        AssertIO(Pool != NULL);
+
+        BitBufferPool_FlushThreadCache(Pool);
+        for (uint8_t Class = 0; Class < BitBufferPool_NumClasses; Class++) {
+            while (Pool->FreeLists[Class] != NULL) {
+                BitBuffer *BitB       = Pool->FreeLists[Class];
+                Pool->FreeLists[Class] = BitB->NextFree;
+                BitBuffer_Deinit(BitB);
+            }
+        }
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        pthread_mutex_destroy(&Pool->Lock);
+#endif /* PlatformIO_TargetOS */
+        free(Pool);
+    }
+    /* BitBufferPool */
+
     /* Standard Functions */
+    typedef void (*BufferIO_CopyKernel)(uint8_t *restrict Destination, const uint8_t *restrict Source, size_t NumBytes);
+
+    typedef void (*BufferIO_SetKernel)(uint8_t *Destination, uint64_t Pattern, size_t NumBytes);
+
+    typedef void (*BufferIO_MoveKernel)(uint8_t *Destination, const uint8_t *Source, size_t NumBytes);
+
+    typedef struct BufferIO_Kernels {
+        BufferIO_CopyKernel Copy;
+        BufferIO_SetKernel  Set;
+        BufferIO_MoveKernel Move;
+    } BufferIO_Kernels;
+
+    /* Chosen once from the CPU's SIMD extensions, see BufferIO_GetKernels */
+    static BufferIO_Kernels    BufferIO_SelectedKernels;
+    static size_t              BufferIO_NonTemporalThreshold = 4 * 1024 * 1024;
+
+    static void BufferIO_CopyBytes_Portable(uint8_t *restrict Destination, const uint8_t *restrict Source, size_t NumBytes) {
+        size_t Offset        = 0;
+        while (Offset + 8 <= NumBytes) {
+            uint64_t Word;
+            memcpy(&Word, &Source[Offset], sizeof(Word));
+            memcpy(&Destination[Offset], &Word, sizeof(Word));
+            Offset          += 8;
+        }
+        while (Offset < NumBytes) {
+            Destination[Offset] = Source[Offset];
+            Offset          += 1;
+        }
+    }
+
+    /* Pattern is the element repeated to fill 8 bytes, every multiple of 8 bytes from Destination starts a new pattern */
+    static void BufferIO_SetBytes_Portable(uint8_t *Destination, uint64_t Pattern, size_t NumBytes) {
+        uint8_t PatternBytes[8];
+        memcpy(PatternBytes, &Pattern, sizeof(Pattern));
+        size_t Offset        = 0;
+        while (Offset + 8 <= NumBytes) {
+            memcpy(&Destination[Offset], &Pattern, sizeof(Pattern));
+            Offset          += 8;
+        }
+        while (Offset < NumBytes) {
+            Destination[Offset] = PatternBytes[Offset % 8];
+            Offset          += 1;
+        }
+    }
+
+    /*
+     Moving forward is safe when Destination is before Source: each store only lands on source bytes that were already loaded.
+     Moving backward from the end is safe the other way around.
+     */
+    static void BufferIO_MoveBytes_Portable(uint8_t *Destination, const uint8_t *Source, size_t NumBytes) {
+        uint64_t Word;
+        if (Destination < Source) {
+            size_t Offset    = 0;
+            while (Offset + 8 <= NumBytes) {
+                memcpy(&Word, &Source[Offset], sizeof(Word));
+                memcpy(&Destination[Offset], &Word, sizeof(Word));
+                Offset      += 8;
+            }
+            while (Offset < NumBytes) {
+                Destination[Offset] = Source[Offset];
+                Offset      += 1;
+            }
+        } else {
+            size_t Offset    = NumBytes;
+            while (Offset >= 8) {
+                Offset      -= 8;
+                memcpy(&Word, &Source[Offset], sizeof(Word));
+                memcpy(&Destination[Offset], &Word, sizeof(Word));
+            }
+            while (Offset > 0) {
+                Offset      -= 1;
+                Destination[Offset] = Source[Offset];
+            }
+        }
+    }
+
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+    /*
+     The SIMD kernels load the first and last vector up front and store them unaligned, which covers the head and tail.
+     The body is stored aligned to the vector size, with streaming stores once NumBytes reaches BufferIO_NonTemporalThreshold.
+     */
+
+    /* The Pattern as seen from Offset bytes into the array; the body and tail of a set don't start on a multiple of 8 bytes when the array isn't aligned to its element */
+    static uint64_t BufferIO_RotatePattern(uint64_t Pattern, size_t Offset) {
+        uint8_t Shift        = (uint8_t) ((Offset % 8) * 8);
+        return Shift == 0 ? Pattern : (Pattern >> Shift) | (Pattern << (64 - Shift));
+    }
+
+    PlatformIO_TargetFeatures("sse2")
+    static void BufferIO_CopyBytes_SSE2(uint8_t *restrict Destination, const uint8_t *restrict Source, size_t NumBytes) {
+        if (NumBytes < 16) {
+            BufferIO_CopyBytes_Portable(Destination, Source, NumBytes);
+            return;
+        }
+        __m128i Head         = _mm_loadu_si128((const __m128i *) Source);
+        __m128i Tail         = _mm_loadu_si128((const __m128i *) &Source[NumBytes - 16]);
+        size_t  Offset       = 16 - ((uintptr_t) Destination & 15);
+        if (NumBytes >= BufferIO_NonTemporalThreshold) {
+            for (; Offset + 16 <= NumBytes; Offset += 16) {
+                _mm_stream_si128((__m128i *) &Destination[Offset], _mm_loadu_si128((const __m128i *) &Source[Offset]));
+            }
+            _mm_sfence();
+        } else {
+            for (; Offset + 64 <= NumBytes; Offset += 64) {
+                __m128i Vector0 = _mm_loadu_si128((const __m128i *) &Source[Offset]);
+                __m128i Vector1 = _mm_loadu_si128((const __m128i *) &Source[Offset + 16]);
+                __m128i Vector2 = _mm_loadu_si128((const __m128i *) &Source[Offset + 32]);
+                __m128i Vector3 = _mm_loadu_si128((const __m128i *) &Source[Offset + 48]);
+                _mm_store_si128((__m128i *) &Destination[Offset],      Vector0);
+                _mm_store_si128((__m128i *) &Destination[Offset + 16], Vector1);
+                _mm_store_si128((__m128i *) &Destination[Offset + 32], Vector2);
+                _mm_store_si128((__m128i *) &Destination[Offset + 48], Vector3);
+            }
+            for (; Offset + 16 <= NumBytes; Offset += 16) {
+                _mm_store_si128((__m128i *) &Destination[Offset], _mm_loadu_si128((const __m128i *) &Source[Offset]));
+            }
+        }
+        _mm_storeu_si128((__m128i *) Destination, Head);
+        _mm_storeu_si128((__m128i *) &Destination[NumBytes - 16], Tail);
+    }
+
+    PlatformIO_TargetFeatures("avx2")
+    static void BufferIO_CopyBytes_AVX2(uint8_t *restrict Destination, const uint8_t *restrict Source, size_t NumBytes) {
+        if (NumBytes < 32) {
+            BufferIO_CopyBytes_SSE2(Destination, Source, NumBytes);
+            return;
+        }
+        __m256i Head         = _mm256_loadu_si256((const __m256i *) Source);
+        __m256i Tail         = _mm256_loadu_si256((const __m256i *) &Source[NumBytes - 32]);
+        size_t  Offset       = 32 - ((uintptr_t) Destination & 31);
+        if (NumBytes >= BufferIO_NonTemporalThreshold) {
+            for (; Offset + 32 <= NumBytes; Offset += 32) {
+                _mm256_stream_si256((__m256i *) &Destination[Offset], _mm256_loadu_si256((const __m256i *) &Source[Offset]));
+            }
+            _mm_sfence();
+        } else {
+            for (; Offset + 128 <= NumBytes; Offset += 128) {
+                __m256i Vector0 = _mm256_loadu_si256((const __m256i *) &Source[Offset]);
+                __m256i Vector1 = _mm256_loadu_si256((const __m256i *) &Source[Offset + 32]);
+                __m256i Vector2 = _mm256_loadu_si256((const __m256i *) &Source[Offset + 64]);
+                __m256i Vector3 = _mm256_loadu_si256((const __m256i *) &Source[Offset + 96]);
+                _mm256_store_si256((__m256i *) &Destination[Offset],      Vector0);
+                _mm256_store_si256((__m256i *) &Destination[Offset + 32], Vector1);
+                _mm256_store_si256((__m256i *) &Destination[Offset + 64], Vector2);
+                _mm256_store_si256((__m256i *) &Destination[Offset + 96], Vector3);
+            }
+            for (; Offset + 32 <= NumBytes; Offset += 32) {
+                _mm256_store_si256((__m256i *) &Destination[Offset], _mm256_loadu_si256((const __m256i *) &Source[Offset]));
+            }
+        }
+        _mm256_storeu_si256((__m256i *) Destination, Head);
+        _mm256_storeu_si256((__m256i *) &Destination[NumBytes - 32], Tail);
+    }
+
+    PlatformIO_TargetFeatures("avx512f")
+    static void BufferIO_CopyBytes_AVX512(uint8_t *restrict Destination, const uint8_t *restrict Source, size_t NumBytes) {
+        if (NumBytes < 64) {
+            BufferIO_CopyBytes_AVX2(Destination, Source, NumBytes);
+            return;
+        }
+        __m512i Head         = _mm512_loadu_si512((const void *) Source);
+        __m512i Tail         = _mm512_loadu_si512((const void *) &Source[NumBytes - 64]);
+        size_t  Offset       = 64 - ((uintptr_t) Destination & 63);
+        if (NumBytes >= BufferIO_NonTemporalThreshold) {
+            for (; Offset + 64 <= NumBytes; Offset += 64) {
+                _mm512_stream_si512((void *) &Destination[Offset], _mm512_loadu_si512((const void *) &Source[Offset]));
+            }
+            _mm_sfence();
+        } else {
+            for (; Offset + 64 <= NumBytes; Offset += 64) {
+                _mm512_store_si512((void *) &Destination[Offset], _mm512_loadu_si512((const void *) &Source[Offset]));
+            }
+        }
+        _mm512_storeu_si512((void *) Destination, Head);
+        _mm512_storeu_si512((void *) &Destination[NumBytes - 64], Tail);
+    }
+
+    /* The head and tail are loaded before anything is stored, so they're correct however the arrays overlap */
+    PlatformIO_TargetFeatures("sse2")
+    static void BufferIO_MoveBytes_SSE2(uint8_t *Destination, const uint8_t *Source, size_t NumBytes) {
+        if (NumBytes < 16) {
+            BufferIO_MoveBytes_Portable(Destination, Source, NumBytes);
+            return;
+        }
+        __m128i Head         = _mm_loadu_si128((const __m128i *) Source);
+        __m128i Tail         = _mm_loadu_si128((const __m128i *) &Source[NumBytes - 16]);
+        if (Destination < Source) {
+            for (size_t Offset = 16 - ((uintptr_t) Destination & 15); Offset + 16 <= NumBytes; Offset += 16) {
+                _mm_store_si128((__m128i *) &Destination[Offset], _mm_loadu_si128((const __m128i *) &Source[Offset]));
+            }
+        } else {
+            for (size_t Offset = NumBytes - ((uintptr_t) &Destination[NumBytes] & 15); Offset >= 16;) {
+                Offset      -= 16;
+                _mm_store_si128((__m128i *) &Destination[Offset], _mm_loadu_si128((const __m128i *) &Source[Offset]));
+            }
+        }
+        _mm_storeu_si128((__m128i *) Destination, Head);
+        _mm_storeu_si128((__m128i *) &Destination[NumBytes - 16], Tail);
+    }
+
+    PlatformIO_TargetFeatures("avx2")
+    static void BufferIO_MoveBytes_AVX2(uint8_t *Destination, const uint8_t *Source, size_t NumBytes) {
+        if (NumBytes < 32) {
+            BufferIO_MoveBytes_SSE2(Destination, Source, NumBytes);
+            return;
+        }
+        __m256i Head         = _mm256_loadu_si256((const __m256i *) Source);
+        __m256i Tail         = _mm256_loadu_si256((const __m256i *) &Source[NumBytes - 32]);
+        if (Destination < Source) {
+            for (size_t Offset = 32 - ((uintptr_t) Destination & 31); Offset + 32 <= NumBytes; Offset += 32) {
+                _mm256_store_si256((__m256i *) &Destination[Offset], _mm256_loadu_si256((const __m256i *) &Source[Offset]));
+            }
+        } else {
+            for (size_t Offset = NumBytes - ((uintptr_t) &Destination[NumBytes] & 31); Offset >= 32;) {
+                Offset      -= 32;
+                _mm256_store_si256((__m256i *) &Destination[Offset], _mm256_loadu_si256((const __m256i *) &Source[Offset]));
+            }
+        }
+        _mm256_storeu_si256((__m256i *) Destination, Head);
+        _mm256_storeu_si256((__m256i *) &Destination[NumBytes - 32], Tail);
+    }
+
+    PlatformIO_TargetFeatures("sse2")
+    static void BufferIO_SetBytes_SSE2(uint8_t *Destination, uint64_t Pattern, size_t NumBytes) {
+        if (NumBytes < 16) {
+            BufferIO_SetBytes_Portable(Destination, Pattern, NumBytes);
+            return;
+        }
+        __m128i Vector       = _mm_set1_epi64x((long long) Pattern);
+        size_t  Offset       = 16 - ((uintptr_t) Destination & 15);
+        __m128i Body         = _mm_set1_epi64x((long long) BufferIO_RotatePattern(Pattern, Offset));
+        _mm_storeu_si128((__m128i *) Destination, Vector);
+        if (NumBytes >= BufferIO_NonTemporalThreshold) {
+            for (; Offset + 16 <= NumBytes; Offset += 16) {
+                _mm_stream_si128((__m128i *) &Destination[Offset], Body);
+            }
+            _mm_sfence();
+        } else {
+            for (; Offset + 16 <= NumBytes; Offset += 16) {
+                _mm_store_si128((__m128i *) &Destination[Offset], Body);
+            }
+        }
+        _mm_storeu_si128((__m128i *) &Destination[NumBytes - 16], _mm_set1_epi64x((long long) BufferIO_RotatePattern(Pattern, NumBytes - 16)));
+    }
+
+    PlatformIO_TargetFeatures("avx2")
+    static void BufferIO_SetBytes_AVX2(uint8_t *Destination, uint64_t Pattern, size_t NumBytes) {
+        if (NumBytes < 32) {
+            BufferIO_SetBytes_SSE2(Destination, Pattern, NumBytes);
+            return;
+        }
+        __m256i Vector       = _mm256_set1_epi64x((long long) Pattern);
+        size_t  Offset       = 32 - ((uintptr_t) Destination & 31);
+        __m256i Body         = _mm256_set1_epi64x((long long) BufferIO_RotatePattern(Pattern, Offset));
+        _mm256_storeu_si256((__m256i *) Destination, Vector);
+        if (NumBytes >= BufferIO_NonTemporalThreshold) {
+            for (; Offset + 32 <= NumBytes; Offset += 32) {
+                _mm256_stream_si256((__m256i *) &Destination[Offset], Body);
+            }
+            _mm_sfence();
+        } else {
+            for (; Offset + 32 <= NumBytes; Offset += 32) {
+                _mm256_store_si256((__m256i *) &Destination[Offset], Body);
+            }
+        }
+        _mm256_storeu_si256((__m256i *) &Destination[NumBytes - 32], _mm256_set1_epi64x((long long) BufferIO_RotatePattern(Pattern, NumBytes - 32)));
+    }
+
+    PlatformIO_TargetFeatures("avx512f")
+    static void BufferIO_SetBytes_AVX512(uint8_t *Destination, uint64_t Pattern, size_t NumBytes) {
+        if (NumBytes < 64) {
+            BufferIO_SetBytes_AVX2(Destination, Pattern, NumBytes);
+            return;
+        }
+        __m512i Vector       = _mm512_set1_epi64((long long) Pattern);
+        size_t  Offset       = 64 - ((uintptr_t) Destination & 63);
+        __m512i Body         = _mm512_set1_epi64((long long) BufferIO_RotatePattern(Pattern, Offset));
+        _mm512_storeu_si512((void *) Destination, Vector);
+        if (NumBytes >= BufferIO_NonTemporalThreshold) {
+            for (; Offset + 64 <= NumBytes; Offset += 64) {
+                _mm512_stream_si512((void *) &Destination[Offset], Body);
+            }
+            _mm_sfence();
+        } else {
+            for (; Offset + 64 <= NumBytes; Offset += 64) {
+                _mm512_store_si512((void *) &Destination[Offset], Body);
+            }
+        }
+        _mm512_storeu_si512((void *) &Destination[NumBytes - 64], _mm512_set1_epi64((long long) BufferIO_RotatePattern(Pattern, NumBytes - 64)));
+    }
+#endif /* PlatformIO_ArchIsAMD64 */
+
+    static void BufferIO_SelectKernels(void) {
+        BufferIO_CopyKernel Copy = BufferIO_CopyBytes_Portable;
+        BufferIO_SetKernel  Set  = BufferIO_SetBytes_Portable;
+        BufferIO_MoveKernel Move = BufferIO_MoveBytes_Portable;
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+        PlatformIO_SIMDExtensions Extensions = PlatformIO_GetSIMDExtensions();
+        if ((Extensions & SIMDExtension_AVX512F) == SIMDExtension_AVX512F) {
+            Copy                 = BufferIO_CopyBytes_AVX512;
+            Set                  = BufferIO_SetBytes_AVX512;
+            Move                 = BufferIO_MoveBytes_AVX2;
+        } else if ((Extensions & SIMDExtension_AVX2) == SIMDExtension_AVX2) {
+            Copy                 = BufferIO_CopyBytes_AVX2;
+            Set                  = BufferIO_SetBytes_AVX2;
+            Move                 = BufferIO_MoveBytes_AVX2;
+        } else if ((Extensions & SIMDExtension_SSE2) == SIMDExtension_SSE2) {
+            Copy                 = BufferIO_CopyBytes_SSE2;
+            Set                  = BufferIO_SetBytes_SSE2;
+            Move                 = BufferIO_MoveBytes_SSE2;
+        }
+#endif /* PlatformIO_ArchIsAMD64 */
+        BufferIO_SelectedKernels.Copy = Copy;
+        BufferIO_SelectedKernels.Set  = Set;
+        BufferIO_SelectedKernels.Move = Move;
+    }
+
+#if PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+    static BOOL CALLBACK BufferIO_SelectKernels_Once(PINIT_ONCE Once, PVOID Parameter, PVOID *Context) {
+        BufferIO_SelectKernels();
+        return TRUE;
+    }
+#endif /* PlatformIO_TargetOS */
+
+    static const BufferIO_Kernels *BufferIO_GetKernels(void) { // Selected exactly once, the once primitive publishes the choice to every thread
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        static pthread_once_t Once = PTHREAD_ONCE_INIT;
+        pthread_once(&Once, BufferIO_SelectKernels);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        static INIT_ONCE      Once = INIT_ONCE_STATIC_INIT;
+        InitOnceExecuteOnce(&Once, BufferIO_SelectKernels_Once, NULL, NULL);
+#endif /* PlatformIO_TargetOS */
+        return &BufferIO_SelectedKernels;
+    }
+
+    void BufferIO_SetNonTemporalThreshold(size_t ThresholdInBytes) {
+        BufferIO_NonTemporalThreshold = ThresholdInBytes;
+    }
+
     size_t BufferIO_MemoryCopy8(uint8_t *restrict Destination, const uint8_t *restrict Source, const size_t NumElements2Copy) { // memcpy
         AssertIO(Destination != NULL);
         AssertIO(Source != NULL);
         AssertIO(NumElements2Copy > 0);
 
-        size_t ElementsCopied   = 0;
-#pragma omp simd
-        for (size_t Byte = 0; Byte < NumElements2Copy; Byte++) {
-            Destination[Byte]   = Source[Byte];
-            ElementsCopied     += 1;
-        }
-        return ElementsCopied;
+        BufferIO_GetKernels()->Copy(Destination, Source, NumElements2Copy);
+        return NumElements2Copy;
     }
 
-    size_t BufferIO_MemoryCopy16(uint64_t *restrict Destination, const uint64_t *restrict Source, const size_t NumElements2Copy) {
+    size_t BufferIO_MemoryCopy16(uint16_t *restrict Destination, const uint16_t *restrict Source, const size_t NumElements2Copy) {
         AssertIO(Destination != NULL);
         AssertIO(Source != NULL);
         AssertIO(NumElements2Copy > 0);
 
-        size_t   ElementsCopied = 0;
-#pragma omp simd
-        for (size_t Element = 0; Element < NumElements2Copy; Element++) {
-            Destination[Element] = Source[Element];
-            ElementsCopied      += 1;
-        }
-        return ElementsCopied;
+        BufferIO_GetKernels()->Copy((uint8_t *) Destination, (const uint8_t *) Source, NumElements2Copy * sizeof(uint16_t));
+        return NumElements2Copy;
     }
 
-    size_t BufferIO_MemoryCopy32(uint64_t *restrict Destination, const uint64_t *restrict Source, const size_t NumElements2Copy) {
+    size_t BufferIO_MemoryCopy32(uint32_t *restrict Destination, const uint32_t *restrict Source, const size_t NumElements2Copy) {
         AssertIO(Destination != NULL);
         AssertIO(Source != NULL);
         AssertIO(NumElements2Copy > 0);
 
-        size_t   ElementsCopied = 0;
-#pragma omp simd
-        for (size_t Element = 0; Element < NumElements2Copy; Element++) {
-            Destination[Element] = Source[Element];
-            ElementsCopied      += 1;
-        }
-        return ElementsCopied;
+        BufferIO_GetKernels()->Copy((uint8_t *) Destination, (const uint8_t *) Source, NumElements2Copy * sizeof(uint32_t));
+        return NumElements2Copy;
     }
 
     size_t BufferIO_MemoryCopy64(uint64_t *restrict Destination, const uint64_t *restrict Source, const size_t NumElements2Copy) {
@@ -849,67 +2331,306 @@ extern "C" {
         AssertIO(Source != NULL);
         AssertIO(NumElements2Copy > 0);
 
-        size_t   ElementsCopied = 0;
-#pragma omp simd
-        for (size_t Element = 0; Element < NumElements2Copy; Element++) {
-            Destination[Element] = Source[Element];
-            ElementsCopied      += 1;
+        BufferIO_GetKernels()->Copy((uint8_t *) Destination, (const uint8_t *) Source, NumElements2Copy * sizeof(uint64_t));
+        return NumElements2Copy;
+    }
+
+    size_t BufferIO_MemoryMove8(uint8_t *Destination, const uint8_t *Source, const size_t NumElements2Move) { // memmove
+        AssertIO(Destination != NULL);
+        AssertIO(Source != NULL);
+
+        if (Destination != Source && NumElements2Move > 0) {
+            BufferIO_GetKernels()->Move(Destination, Source, NumElements2Move);
         }
-        return ElementsCopied;
+        return NumElements2Move;
     }
 
     size_t BufferIO_MemorySet8(uint8_t *Array, uint8_t Value2Set, size_t NumElements2Set) { // memset
         AssertIO(Array != NULL);
         AssertIO(NumElements2Set > 0);
 
-        size_t NumElementsSet = 0;
-#pragma omp simd
-        for (size_t Element = 0; Element < NumElementsSet; Element++) {
-            Array[Element]    = Value2Set;
-            NumElementsSet   += 1;
-        }
-        return NumElementsSet;
+        BufferIO_GetKernels()->Set(Array, Value2Set * 0x0101010101010101ULL, NumElements2Set);
+        return NumElements2Set;
     }
 
     size_t BufferIO_MemorySet16(uint16_t *Array, uint16_t Value2Set, size_t NumElements2Set) {
         AssertIO(Array != NULL);
         AssertIO(NumElements2Set > 0);
 
-        size_t NumElementsSet = 0;
-#pragma omp simd
-        for (size_t Element = 0; Element < NumElementsSet; Element++) {
-            Array[Element]    = Value2Set;
-            NumElementsSet   += 1;
-        }
-        return NumElementsSet;
+        BufferIO_GetKernels()->Set((uint8_t *) Array, Value2Set * 0x0001000100010001ULL, NumElements2Set * sizeof(uint16_t));
+        return NumElements2Set;
     }
 
-    size_t BufferIO_MemorySet32(uint32_t *Array, uint16_t Value2Set, size_t NumElements2Set) {
+    size_t BufferIO_MemorySet32(uint32_t *Array, uint32_t Value2Set, size_t NumElements2Set) {
         AssertIO(Array != NULL);
         AssertIO(NumElements2Set > 0);
 
-        size_t NumElementsSet = 0;
-#pragma omp simd
-        for (size_t Element = 0; Element < NumElementsSet; Element++) {
-            Array[Element]    = Value2Set;
-            NumElementsSet   += 1;
-        }
-        return NumElementsSet;
+        BufferIO_GetKernels()->Set((uint8_t *) Array, Value2Set * 0x0000000100000001ULL, NumElements2Set * sizeof(uint32_t));
+        return NumElements2Set;
     }
     
-    size_t BufferIO_MemorySet64(uint64_t *Array, uint16_t Value2Set, size_t NumElements2Set) {
+    size_t BufferIO_MemorySet64(uint64_t *Array, uint64_t Value2Set, size_t NumElements2Set) {
         AssertIO(Array != NULL);
         AssertIO(NumElements2Set > 0);
 
-        size_t NumElementsSet = 0;
-#pragma omp simd
-        for (size_t Element = 0; Element < NumElementsSet; Element++) {
-            Array[Element]    = Value2Set;
-            NumElementsSet   += 1;
-        }
-        return NumElementsSet;
+        BufferIO_GetKernels()->Set((uint8_t *) Array, Value2Set, NumElements2Set * sizeof(uint64_t));
+        return NumElements2Set;
     }
     /* Standard Functions */
+
+    /* Checksums */
+    static const uint32_t (*BufferIO_CRC32_GetTable(BufferIO_CRCPolynomials Polynomial))[CRC32TableSize] {
+        return Polynomial == CRCPolynomial_Castagnoli ? CRC32Table_Castagnoli : CRC32Table_IEEE802_3;
+    }
+
+    static uint32_t BufferIO_CRC32_Slicing8(const uint32_t Table[CRC32NumSlices][CRC32TableSize], uint32_t State, const uint8_t *Bytes, size_t NumBytes) {
+        while (NumBytes >= 8) {
+            uint64_t Word = BitBuffer_LoadLE64(Bytes) ^ State;
+            State         = Table[7][Word & 0xFF]         ^ Table[6][(Word >> 8) & 0xFF]  ^ Table[5][(Word >> 16) & 0xFF] ^ Table[4][(Word >> 24) & 0xFF]
+                          ^ Table[3][(Word >> 32) & 0xFF] ^ Table[2][(Word >> 40) & 0xFF] ^ Table[1][(Word >> 48) & 0xFF] ^ Table[0][Word >> 56];
+            Bytes        += 8;
+            NumBytes     -= 8;
+        }
+        while (NumBytes > 0) {
+            State         = (State >> 8) ^ Table[0][(State ^ *Bytes) & 0xFF];
+            Bytes        += 1;
+            NumBytes     -= 1;
+        }
+        return State;
+    }
+
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+    /*
+     Folds 4 lanes of 128 bits at a time with carry-less multiplies, then folds down to one lane and Barrett reduces it to 32 bits.
+     NumBytes must be at least 64 and a multiple of 16.
+     */
+    PlatformIO_TargetFeatures("pclmul,sse2")
+    static uint32_t BufferIO_CRC32_PCLMUL(const BufferIO_CRC32FoldConstants *Fold, uint32_t State, const uint8_t *Bytes, size_t NumBytes) {
+        __m128i Lane1    = _mm_loadu_si128((const __m128i *) (Bytes + 0));
+        __m128i Lane2    = _mm_loadu_si128((const __m128i *) (Bytes + 16));
+        __m128i Lane3    = _mm_loadu_si128((const __m128i *) (Bytes + 32));
+        __m128i Lane4    = _mm_loadu_si128((const __m128i *) (Bytes + 48));
+        __m128i Constant = _mm_loadu_si128((const __m128i *) Fold->Fold4);
+        Lane1            = _mm_xor_si128(Lane1, _mm_cvtsi32_si128((int) State));
+        Bytes           += 64;
+        NumBytes        -= 64;
+
+        while (NumBytes >= 64) {
+            __m128i Low1 = _mm_clmulepi64_si128(Lane1, Constant, 0x00);
+            __m128i Low2 = _mm_clmulepi64_si128(Lane2, Constant, 0x00);
+            __m128i Low3 = _mm_clmulepi64_si128(Lane3, Constant, 0x00);
+            __m128i Low4 = _mm_clmulepi64_si128(Lane4, Constant, 0x00);
+            Lane1        = _mm_clmulepi64_si128(Lane1, Constant, 0x11);
+            Lane2        = _mm_clmulepi64_si128(Lane2, Constant, 0x11);
+            Lane3        = _mm_clmulepi64_si128(Lane3, Constant, 0x11);
+            Lane4        = _mm_clmulepi64_si128(Lane4, Constant, 0x11);
+            Lane1        = _mm_xor_si128(_mm_xor_si128(Lane1, Low1), _mm_loadu_si128((const __m128i *) (Bytes + 0)));
+            Lane2        = _mm_xor_si128(_mm_xor_si128(Lane2, Low2), _mm_loadu_si128((const __m128i *) (Bytes + 16)));
+            Lane3        = _mm_xor_si128(_mm_xor_si128(Lane3, Low3), _mm_loadu_si128((const __m128i *) (Bytes + 32)));
+            Lane4        = _mm_xor_si128(_mm_xor_si128(Lane4, Low4), _mm_loadu_si128((const __m128i *) (Bytes + 48)));
+            Bytes       += 64;
+            NumBytes    -= 64;
+        }
+
+        Constant         = _mm_loadu_si128((const __m128i *) Fold->Fold1);
+        __m128i Low      = _mm_clmulepi64_si128(Lane1, Constant, 0x00);
+        Lane1            = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(Lane1, Constant, 0x11), Low), Lane2);
+        Low              = _mm_clmulepi64_si128(Lane1, Constant, 0x00);
+        Lane1            = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(Lane1, Constant, 0x11), Low), Lane3);
+        Low              = _mm_clmulepi64_si128(Lane1, Constant, 0x00);
+        Lane1            = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(Lane1, Constant, 0x11), Low), Lane4);
+
+        while (NumBytes >= 16) {
+            Low          = _mm_clmulepi64_si128(Lane1, Constant, 0x00);
+            Lane1        = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(Lane1, Constant, 0x11), Low), _mm_loadu_si128((const __m128i *) Bytes));
+            Bytes       += 16;
+            NumBytes    -= 16;
+        }
+
+        /* 128 bits to 64 */
+        __m128i Mask32   = _mm_setr_epi32(~0, 0, ~0, 0);
+        Lane1            = _mm_xor_si128(_mm_srli_si128(Lane1, 8), _mm_clmulepi64_si128(Lane1, Constant, 0x10));
+        Constant         = _mm_loadu_si128((const __m128i *) Fold->Reduce64);
+        Lane1            = _mm_xor_si128(_mm_srli_si128(Lane1, 4), _mm_clmulepi64_si128(_mm_and_si128(Lane1, Mask32), Constant, 0x00));
+
+        /* Barrett reduction, 64 bits to 32 */
+        Constant         = _mm_loadu_si128((const __m128i *) Fold->Barrett);
+        __m128i Quotient = _mm_and_si128(_mm_clmulepi64_si128(_mm_and_si128(Lane1, Mask32), Constant, 0x10), Mask32);
+        Lane1            = _mm_xor_si128(Lane1, _mm_clmulepi64_si128(Quotient, Constant, 0x00));
+        return (uint32_t) _mm_cvtsi128_si32(_mm_srli_si128(Lane1, 4));
+    }
+#endif /* PlatformIO_ArchIsAMD64 */
+
+    void BufferIO_CRC32_Init(BufferIO_CRC32 *CRC, BufferIO_CRCPolynomials Polynomial, uint32_t InitValue) {
+        AssertIO(CRC != NULL);
+        AssertIO(Polynomial == CRCPolynomial_IEEE802_3 || Polynomial == CRCPolynomial_Castagnoli);
+
+        CRC->State      = InitValue;
+        CRC->Polynomial = Polynomial;
+    }
+
+    void BufferIO_CRC32_Update(BufferIO_CRC32 *CRC, const uint8_t *Bytes, size_t NumBytes) {
+        AssertIO(CRC != NULL);
+        AssertIO(Bytes != NULL || NumBytes == 0);
+
+        uint32_t State = CRC->State;
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+        if (NumBytes >= 64 && (PlatformIO_GetSIMDExtensions() & SIMDExtension_PCLMUL) == SIMDExtension_PCLMUL) {
+            const BufferIO_CRC32FoldConstants *Fold = CRC->Polynomial == CRCPolynomial_Castagnoli ? &CRC32Fold_Castagnoli : &CRC32Fold_IEEE802_3;
+            size_t Folded  = NumBytes - (NumBytes % 16);
+            State          = BufferIO_CRC32_PCLMUL(Fold, State, Bytes, Folded);
+            Bytes         += Folded;
+            NumBytes      -= Folded;
+        }
+#endif /* PlatformIO_ArchIsAMD64 */
+        CRC->State     = BufferIO_CRC32_Slicing8(BufferIO_CRC32_GetTable(CRC->Polynomial), State, Bytes, NumBytes);
+    }
+
+    uint32_t BufferIO_CRC32_Final(BufferIO_CRC32 *CRC) {
+        AssertIO(CRC != NULL);
+        return ~CRC->State;
+    }
+
+    /*
+     Every BlockSize bytes are summed without a modulo: A += Bytes[i], B += A.
+     The vector versions keep per lane sums of the bytes, of the bytes weighted by their distance from the end of the vector, and of A at the start of each vector.
+     */
+    static void BufferIO_Adler32_Scalar(uint32_t *A, uint32_t *B, const uint8_t *Bytes, size_t NumBytes) {
+        uint32_t SumA   = *A;
+        uint32_t SumB   = *B;
+        while (NumBytes >= 8) {
+            SumA       += Bytes[0]; SumB += SumA;
+            SumA       += Bytes[1]; SumB += SumA;
+            SumA       += Bytes[2]; SumB += SumA;
+            SumA       += Bytes[3]; SumB += SumA;
+            SumA       += Bytes[4]; SumB += SumA;
+            SumA       += Bytes[5]; SumB += SumA;
+            SumA       += Bytes[6]; SumB += SumA;
+            SumA       += Bytes[7]; SumB += SumA;
+            Bytes      += 8;
+            NumBytes   -= 8;
+        }
+        while (NumBytes > 0) {
+            SumA       += *Bytes;
+            SumB       += SumA;
+            Bytes      += 1;
+            NumBytes   -= 1;
+        }
+        *A              = SumA;
+        *B              = SumB;
+    }
+
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+    PlatformIO_TargetFeatures("sse2")
+    static uint32_t BufferIO_Adler32_HorizontalSum_SSE2(__m128i Vector) {
+        Vector          = _mm_add_epi32(Vector, _mm_shuffle_epi32(Vector, _MM_SHUFFLE(1, 0, 3, 2)));
+        Vector          = _mm_add_epi32(Vector, _mm_shuffle_epi32(Vector, _MM_SHUFFLE(2, 3, 0, 1)));
+        return (uint32_t) _mm_cvtsi128_si32(Vector);
+    }
+
+    /* NumBytes must be a multiple of 16 and at most BlockSize */
+    PlatformIO_TargetFeatures("sse2")
+    static void BufferIO_Adler32_SSE2(uint32_t *A, uint32_t *B, const uint8_t *Bytes, size_t NumBytes) {
+        const __m128i Zero       = _mm_setzero_si128();
+        const __m128i WeightsLow = _mm_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9);
+        const __m128i WeightsHigh= _mm_setr_epi16(8, 7, 6, 5, 4, 3, 2, 1);
+        __m128i PreviousA        = _mm_setzero_si128();
+        __m128i SumA             = _mm_setzero_si128();
+        __m128i SumB             = _mm_setzero_si128();
+        uint32_t NumVectors      = (uint32_t) (NumBytes / 16);
+        for (uint32_t Vector = 0; Vector < NumVectors; Vector++) {
+            __m128i Data         = _mm_loadu_si128((const __m128i *) &Bytes[Vector * 16]);
+            PreviousA            = _mm_add_epi32(PreviousA, SumA);
+            SumA                 = _mm_add_epi32(SumA, _mm_sad_epu8(Data, Zero));
+            SumB                 = _mm_add_epi32(SumB, _mm_madd_epi16(_mm_unpacklo_epi8(Data, Zero), WeightsLow));
+            SumB                 = _mm_add_epi32(SumB, _mm_madd_epi16(_mm_unpackhi_epi8(Data, Zero), WeightsHigh));
+        }
+        *B                      += (uint32_t) NumBytes * *A + (BufferIO_Adler32_HorizontalSum_SSE2(PreviousA) << 4) + BufferIO_Adler32_HorizontalSum_SSE2(SumB);
+        *A                      += BufferIO_Adler32_HorizontalSum_SSE2(SumA);
+    }
+
+    /* NumBytes must be a multiple of 32 and at most BlockSize */
+    PlatformIO_TargetFeatures("avx2")
+    static void BufferIO_Adler32_AVX2(uint32_t *A, uint32_t *B, const uint8_t *Bytes, size_t NumBytes) {
+        const __m256i Zero       = _mm256_setzero_si256();
+        const __m256i Ones       = _mm256_set1_epi16(1);
+        const __m256i Weights    = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+        __m256i PreviousA        = _mm256_setzero_si256();
+        __m256i SumA             = _mm256_setzero_si256();
+        __m256i SumB             = _mm256_setzero_si256();
+        uint32_t NumVectors      = (uint32_t) (NumBytes / 32);
+        for (uint32_t Vector = 0; Vector < NumVectors; Vector++) {
+            __m256i Data         = _mm256_loadu_si256((const __m256i *) &Bytes[Vector * 32]);
+            PreviousA            = _mm256_add_epi32(PreviousA, SumA);
+            SumA                 = _mm256_add_epi32(SumA, _mm256_sad_epu8(Data, Zero));
+            SumB                 = _mm256_add_epi32(SumB, _mm256_madd_epi16(_mm256_maddubs_epi16(Data, Weights), Ones));
+        }
+        __m128i Previous128      = _mm_add_epi32(_mm256_castsi256_si128(PreviousA), _mm256_extracti128_si256(PreviousA, 1));
+        __m128i SumA128          = _mm_add_epi32(_mm256_castsi256_si128(SumA), _mm256_extracti128_si256(SumA, 1));
+        __m128i SumB128          = _mm_add_epi32(_mm256_castsi256_si128(SumB), _mm256_extracti128_si256(SumB, 1));
+        *B                      += (uint32_t) NumBytes * *A + (BufferIO_Adler32_HorizontalSum_SSE2(Previous128) << 5) + BufferIO_Adler32_HorizontalSum_SSE2(SumB128);
+        *A                      += BufferIO_Adler32_HorizontalSum_SSE2(SumA128);
+    }
+#endif /* PlatformIO_ArchIsAMD64 */
+
+    void BufferIO_Adler32_Init(BufferIO_Adler32 *Adler) {
+        AssertIO(Adler != NULL);
+        Adler->A                 = 1;
+        Adler->B                 = 0;
+    }
+
+    void BufferIO_Adler32_Update(BufferIO_Adler32 *Adler, const uint8_t *Bytes, size_t NumBytes) {
+        AssertIO(Adler != NULL);
+        AssertIO(Bytes != NULL || NumBytes == 0);
+
+        uint32_t A               = Adler->A;
+        uint32_t B               = Adler->B;
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+        PlatformIO_SIMDExtensions Extensions = PlatformIO_GetSIMDExtensions();
+        size_t VectorSize        = (Extensions & SIMDExtension_AVX2) == SIMDExtension_AVX2 ? 32 : (Extensions & SIMDExtension_SSE2) == SIMDExtension_SSE2 ? 16 : 1;
+#else
+        size_t VectorSize        = 1;
+#endif /* PlatformIO_ArchIsAMD64 */
+        while (NumBytes > 0) {
+            size_t BlockSize     = NumBytes < Adler32BlockSize ? NumBytes : Adler32BlockSize;
+            size_t Vectorized    = BlockSize - (BlockSize % VectorSize);
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+            if (VectorSize == 32) {
+                BufferIO_Adler32_AVX2(&A, &B, Bytes, Vectorized);
+            } else if (VectorSize == 16) {
+                BufferIO_Adler32_SSE2(&A, &B, Bytes, Vectorized);
+            } else {
+                Vectorized       = 0;
+            }
+#else
+            Vectorized           = 0;
+#endif /* PlatformIO_ArchIsAMD64 */
+            BufferIO_Adler32_Scalar(&A, &B, &Bytes[Vectorized], BlockSize - Vectorized);
+            A                   %= Adler32Modulus;
+            B                   %= Adler32Modulus;
+            Bytes               += BlockSize;
+            NumBytes            -= BlockSize;
+        }
+        Adler->A                 = A;
+        Adler->B                 = B;
+    }
+
+    uint32_t BufferIO_Adler32_Final(BufferIO_Adler32 *Adler) {
+        AssertIO(Adler != NULL);
+        return (Adler->B << 16) | Adler->A;
+    }
+
+    uint32_t BufferIO_Adler32_Combine(uint32_t Adler1, uint32_t Adler2, size_t Chunk2Size) {
+        uint32_t Remainder       = (uint32_t) (Chunk2Size % Adler32Modulus);
+        uint32_t A               = Adler1 & 0xFFFF;
+        uint32_t B               = (Remainder * A) % Adler32Modulus;
+        A                       += (Adler2 & 0xFFFF) + Adler32Modulus - 1;
+        B                       += (Adler1 >> 16) + (Adler2 >> 16) + Adler32Modulus - Remainder;
+        A                       %= Adler32Modulus;
+        B                       %= Adler32Modulus;
+        return (B << 16) | A;
+    }
+    /* Checksums */
     
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
 }
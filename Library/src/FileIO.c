@@ -9,9 +9,24 @@
 #include "../include/TextIO/StringIO.h"   /* Included for StringIO's declarations */
 
 #if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
-#include <dirent.h>
+#include <dirent.h>                       /* Included for fdopendir, readdir */
+#include <fcntl.h>                        /* Included for open, openat */
+#include <sys/mman.h>                     /* Included for mmap, msync, madvise */
+#include <unistd.h>                       /* Included for ftruncate, sysconf, read, write */
+#include <errno.h>                        /* Included for EXDEV, EINVAL, ENOSYS, EMFILE */
+#include <pthread.h>                      /* Included for pthread_create, for FileIO_DirectoryWalker */
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+#include <windows.h>                      /* Included for CreateFileMappingW, MapViewOfFile, FindFirstFileExW, CreateThread */
+#include <io.h>                           /* Included for _get_osfhandle, _wopen */
+#include <fcntl.h>                        /* Included for _O_RDONLY */
+#endif
+
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsLinux)
+#include <sys/sendfile.h>                 /* Included for sendfile */
+#include <sys/syscall.h>                  /* Included for SYS_getdents64 */
 #endif
 
+#include <string.h>                       /* Included for memcpy, strlen */
 #include <sys/types.h>
 #include <sys/stat.h>
 
@@ -28,6 +43,83 @@ extern "C" {
         TextIO_StringTypes  Type; // Orientation
         AsynchronousIO_FileModes   Mode; // like was the file opened for reading/writing, etc
     } FileIO_FILE;
+
+    typedef enum FileIOConstants {
+        FileIO_MaxTransferSize           = 1024 * 1024 * 1024, // Largest chunk handed to the kernel per call
+        FileIO_TransferBufferSize        = 1024 * 1024,        // Buffered fallback's staging buffer
+        FileIO_SpliceSize                = 64 * 1024,          // Default pipe capacity, for splicing between two non-pipes
+        FileIO_ListingSize               = 64 * 1024,          // getdents64 buffer, a few hundred entries per system call
+        FileIO_InitialPathSize           = 256,
+    } FileIOConstants;
+
+    /* Cheapest first; a method that's refused falls through to the next without losing progress */
+    typedef enum FileIO_TransferMethods : uint8_t {
+        TransferMethod_CopyRange         = 0, // copy_file_range, file to file, may be a reflink or a server side copy
+        TransferMethod_SendFile          = 1, // sendfile, from a file to anything
+        TransferMethod_Splice            = 2, // splice, from a pipe or socket to anything
+        TransferMethod_Buffered          = 3, // Through a user buffer, works everywhere
+    } FileIO_TransferMethods;
+
+    typedef struct FileIO_PendingDirectory {
+        UTF8               *Path;
+        size_t              PathSize;     // In code units, without the NULL terminator
+        AsynchronousIO_Descriptor Descriptor; // Opened with openat by the parent, -1 when it's opened by Path
+        uint16_t            Depth;        // Of the directory's children
+    } FileIO_PendingDirectory;
+
+    typedef struct FileIO_DirectoryWalker {
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        pthread_mutex_t          Lock;
+        pthread_cond_t           WorkChanged;
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        SRWLOCK                  Lock;
+        CONDITION_VARIABLE       WorkChanged;
+#endif /* PlatformIO_TargetOS */
+        FileIO_PendingDirectory *Pending;      // A stack, so the walk stays mostly depth first and the stack stays short
+        size_t                   NumPending;
+        size_t                   PendingCapacity;
+        size_t                   NumBusy;      // Threads reading a directory, which can still push more
+        UTF8                   **Extensions;
+        size_t                  *ExtensionSizes;
+        size_t                   NumExtensions;
+        FileIO_WalkFunction      Function;
+        void                    *Context;
+        uint16_t                 NumThreads;
+        FileIO_EntryFields       Fields;
+        bool                     IsStopped;
+        bool                     IsComplete;   // Cleared when a directory can't be read
+    } FileIO_DirectoryWalker;
+
+    /* Each thread's own buffers, so reading a directory doesn't need the lock */
+    typedef struct FileIO_WalkScratch {
+        UTF8               *Path;
+        size_t              PathCapacity;
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsLinux)
+        uint8_t            *Listing;
+#endif /* PlatformIO_TargetOS */
+    } FileIO_WalkScratch;
+
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsLinux)
+    /* The kernel's record layout, glibc only declares it as struct dirent64 from 2.30 on */
+    typedef struct FileIO_LinuxDirent64 {
+        uint64_t            Inode;
+        int64_t             Offset;
+        uint16_t            RecordSize;
+        uint8_t             Type;
+        char                Name[];
+    } FileIO_LinuxDirent64;
+#endif /* PlatformIO_TargetOS */
+
+    typedef struct FileIO_MapView {
+        uint8_t            *Mapping;      // Starts on a page (allocation granularity on Windows) boundary at or before the requested offset
+        size_t              MappingSize;  // Skip + Size
+        size_t              Skip;         // Bytes between Mapping and the requested offset
+        size_t              Size;         // Bytes the caller can access
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        HANDLE              File;         // Kept for FlushFileBuffers, FlushViewOfFile doesn't wait for the disk
+#endif /* PlatformIO_TargetOS */
+        FileIO_MapModes     Mode;
+    } FileIO_MapView;
     
     UTF8 *FileIO_UTF8_GetFileName(PlatformIO_Immutable(UTF8 *) Path8) {
         AssertIO(Path8 != NULL);
@@ -546,6 +638,803 @@ extern "C" {
         return !FileClosedSucessfully;
     }
     /* File Operations */
+
+    /* Mapped Views */
+    static FileIO_MapView *FileIO_MapView_MapDescriptor(AsynchronousIO_Descriptor Descriptor, size_t Offset, size_t Length, FileIO_MapModes Mode) {
+        AssertIO(PlatformIO_Is(Mode, MapMode_Read) || PlatformIO_Is(Mode, MapMode_Write) || PlatformIO_Is(Mode, MapMode_CopyOnWrite));
+
+        FileIO_MapView *View             = NULL;
+        uint8_t        *Mapping          = NULL;
+        size_t          FileSize         = 0;
+        size_t          End              = 0;
+        size_t          Skip             = 0;
+        bool            IsWritable       = PlatformIO_Is(Mode, MapMode_Write);
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        struct stat Status;
+        if (fstat(Descriptor, &Status) != 0) {
+            return NULL;
+        }
+        FileSize                         = (size_t) Status.st_size;
+        End                              = Length == 0 ? FileSize : Offset + Length;
+        if (End > FileSize) {
+            if (IsWritable == No) {
+                End                      = FileSize; // Touching pages past the end of the file is SIGBUS
+            } else if (ftruncate(Descriptor, (off_t) End) != 0) {
+                return NULL;
+            }
+        }
+        if (End <= Offset) {
+            return NULL;
+        }
+        size_t PageSize                  = (size_t) sysconf(_SC_PAGESIZE);
+        Skip                             = Offset % PageSize;
+        int    Protection                = PROT_READ;
+        int    Flags                     = MAP_PRIVATE;
+        if (IsWritable) {
+            Protection                  |= PROT_WRITE;
+            Flags                        = MAP_SHARED;
+        } else if PlatformIO_Is(Mode, MapMode_CopyOnWrite) {
+            Protection                  |= PROT_WRITE;
+        }
+        void *Address                    = mmap(NULL, End - Offset + Skip, Protection, Flags, Descriptor, (off_t) (Offset - Skip));
+        if (Address == MAP_FAILED) {
+            return NULL;
+        }
+        Mapping                          = (uint8_t*) Address;
+#if defined(MADV_HUGEPAGE)
+        if PlatformIO_Is(Mode, MapMode_HugePages) {
+            madvise(Mapping, End - Offset + Skip, MADV_HUGEPAGE); // Just a hint, file backed huge pages depend on the kernel and filesystem
+        }
+#endif /* MADV_HUGEPAGE */
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        HANDLE        File               = (HANDLE) _get_osfhandle(Descriptor);
+        LARGE_INTEGER Size               = {0};
+        if (File == INVALID_HANDLE_VALUE || GetFileSizeEx(File, &Size) == 0) {
+            return NULL;
+        }
+        FileSize                         = (size_t) Size.QuadPart;
+        End                              = Length == 0 ? FileSize : Offset + Length;
+        if (End > FileSize && IsWritable == No) {
+            End                          = FileSize;
+        }
+        if (End <= Offset) {
+            return NULL;
+        }
+        SYSTEM_INFO System;
+        GetSystemInfo(&System);
+        Skip                             = Offset % System.dwAllocationGranularity;
+        DWORD  Protection                = PAGE_READONLY;
+        DWORD  Access                    = FILE_MAP_READ;
+        uint64_t MaximumSize             = 0;
+        if (IsWritable) {
+            Protection                   = PAGE_READWRITE;
+            Access                       = FILE_MAP_WRITE;
+            MaximumSize                  = (uint64_t) End; // Grows the file when it's too small
+        } else if PlatformIO_Is(Mode, MapMode_CopyOnWrite) {
+            Protection                   = PAGE_WRITECOPY;
+            Access                       = FILE_MAP_COPY;
+        }
+        HANDLE MappingObject             = CreateFileMappingW(File, NULL, Protection, (DWORD) (MaximumSize >> 32), (DWORD) MaximumSize, NULL);
+        if (MappingObject == NULL) {
+            return NULL;
+        }
+        uint64_t MappingOffset           = (uint64_t) (Offset - Skip);
+        Mapping                          = (uint8_t*) MapViewOfFile(MappingObject, Access, (DWORD) (MappingOffset >> 32), (DWORD) MappingOffset, End - Offset + Skip);
+        CloseHandle(MappingObject); // The view keeps the mapping alive
+        if (Mapping == NULL) {
+            return NULL;
+        }
+#endif /* PlatformIO_TargetOS */
+        View                             = calloc(1, sizeof(FileIO_MapView));
+        AssertIO(View != NULL);
+        View->Mapping                    = Mapping;
+        View->MappingSize                = End - Offset + Skip;
+        View->Skip                       = Skip;
+        View->Size                       = End - Offset;
+        View->Mode                       = Mode;
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        if (IsWritable) {
+            DuplicateHandle(GetCurrentProcess(), File, GetCurrentProcess(), &View->File, 0, FALSE, DUPLICATE_SAME_ACCESS);
+        }
+#endif /* PlatformIO_TargetOS */
+        return View;
+    }
+
+    FileIO_MapView *FileIO_MapView_InitFromPathUTF8(PlatformIO_Immutable(UTF8 *) Path8, size_t Offset, size_t Length, FileIO_MapModes Mode) {
+        AssertIO(Path8 != NULL);
+
+        FileIO_MapView *View             = NULL;
+        size_t          Path8Offset      = UTF8_HasBOM(Path8) ? UTF8BOMSizeInCodeUnits : 0;
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        int             Flags            = PlatformIO_Is(Mode, MapMode_Write) ? O_RDWR | O_CREAT : O_RDONLY;
+        AsynchronousIO_Descriptor File   = open((const char*) &Path8[Path8Offset], Flags | O_CLOEXEC, 0644);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        int             Flags            = PlatformIO_Is(Mode, MapMode_Write) ? _O_RDWR | _O_CREAT : _O_RDONLY;
+        UTF16          *Path16           = UTF8_Convert(&Path8[Path8Offset]);
+        AsynchronousIO_Descriptor File   = _wopen((const wchar_t*) Path16, Flags | _O_BINARY, _S_IREAD | _S_IWRITE);
+        UTF16_Deinit(Path16);
+#endif /* PlatformIO_TargetOS */
+        if (File >= 0) {
+            View                         = FileIO_MapView_MapDescriptor(File, Offset, Length, Mode);
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+            close(File); // The mapping keeps the file alive
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+            _close(File);
+#endif /* PlatformIO_TargetOS */
+        }
+        return View;
+    }
+
+    FileIO_MapView *FileIO_MapView_InitFromStream(AsynchronousIOStream *Stream, size_t Offset, size_t Length, FileIO_MapModes Mode) {
+        AssertIO(Stream != NULL);
+
+        return FileIO_MapView_MapDescriptor(AsynchronousIOStream_GetDescriptor(Stream), Offset, Length, Mode);
+    }
+
+    void *FileIO_MapView_GetPointer(FileIO_MapView *View) {
+        AssertIO(View != NULL);
+
+        return &View->Mapping[View->Skip];
+    }
+
+    size_t FileIO_MapView_GetSize(FileIO_MapView *View) {
+        AssertIO(View != NULL);
+
+        return View->Size;
+    }
+
+    bool FileIO_MapView_Sync(FileIO_MapView *View) {
+        AssertIO(View != NULL);
+
+        bool Synced                      = Yes;
+        if PlatformIO_Is(View->Mode, MapMode_Write) {
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+            Synced                       = msync(View->Mapping, View->MappingSize, MS_SYNC) == 0;
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+            Synced                       = FlushViewOfFile(View->Mapping, View->MappingSize) != 0 && FlushFileBuffers(View->File) != 0;
+#endif /* PlatformIO_TargetOS */
+        }
+        return Synced;
+    }
+
+    void FileIO_MapView_Deinit(FileIO_MapView *View) {
+        AssertIO(View != NULL);
+
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        munmap(View->Mapping, View->MappingSize);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        UnmapViewOfFile(View->Mapping);
+        if (View->File != NULL) {
+            CloseHandle(View->File);
+        }
+#endif /* PlatformIO_TargetOS */
+        free(View);
+    }
+    /* Mapped Views */
+
+    /* Transfers */
+    /* Size, when it isn't NULL, comes from the same stat; fresher than the stream's cached size, which misses the file growing behind its back */
+    static bool FileIO_IsSeekable(AsynchronousIO_Descriptor Descriptor, size_t *Size) {
+        bool   IsSeekable                = No;
+        size_t FileSize                  = 0;
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        struct stat Status;
+        if (fstat(Descriptor, &Status) == 0) {
+            IsSeekable                   = S_ISREG(Status.st_mode) || S_ISBLK(Status.st_mode);
+            FileSize                     = S_ISREG(Status.st_mode) ? (size_t) Status.st_size : 0;
+        }
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        struct _stati64 Status;
+        if (_fstati64(Descriptor, &Status) == 0) {
+            IsSeekable                   = (Status.st_mode & _S_IFMT) == _S_IFREG;
+            FileSize                     = IsSeekable ? (size_t) Status.st_size : 0;
+        }
+#endif /* PlatformIO_TargetOS */
+        if (Size != NULL) {
+            *Size                        = FileSize;
+        }
+        return IsSeekable;
+    }
+
+    /* Seekable sides go through the stream so FileMode_Direct alignment is handled, pipes and sockets are read and written directly */
+    static ssize_t FileIO_TransferBuffered(AsynchronousIOStream *Destination, size_t DestinationOffset, bool DestinationIsSeekable, AsynchronousIOStream *Source, size_t SourceOffset, bool SourceIsSeekable, uint8_t *Buffer, size_t NumBytes) {
+        ssize_t Read                     = 0;
+        if (SourceIsSeekable) {
+            Read                         = (ssize_t) AsynchronousIOStream_ReadAt(Source, Buffer, 1, NumBytes, SourceOffset);
+        } else {
+            Read                         = read(AsynchronousIOStream_GetDescriptor(Source), Buffer, NumBytes);
+        }
+        if (Read <= 0) {
+            return Read;
+        }
+        size_t  Written                  = 0;
+        while (Written < (size_t) Read) {
+            ssize_t Result               = 0;
+            if (DestinationIsSeekable) {
+                Result                   = (ssize_t) AsynchronousIOStream_WriteAt(Destination, &Buffer[Written], 1, (size_t) Read - Written, DestinationOffset + Written);
+            } else {
+                Result                   = write(AsynchronousIOStream_GetDescriptor(Destination), &Buffer[Written], (size_t) Read - Written);
+            }
+            if (Result <= 0) {
+                break; // What was read but not written is lost for pipes and sockets, so report the short count
+            }
+            Written                     += (size_t) Result;
+        }
+        return Written > 0 ? (ssize_t) Written : -1;
+    }
+
+    size_t FileIO_Transfer(AsynchronousIOStream *Destination, size_t DestinationOffset, AsynchronousIOStream *Source, size_t SourceOffset, size_t NumBytes) {
+        AssertIO(Destination != NULL);
+        AssertIO(Source != NULL);
+
+        AsynchronousIOStream_Flush(Source);      // Write-behind data has to reach the descriptor before the kernel copies from it
+        AsynchronousIOStream_Flush(Destination); // And must not land on top of what's transferred afterwards
+        AsynchronousIO_Descriptor Input  = AsynchronousIOStream_GetDescriptor(Source);
+        AsynchronousIO_Descriptor Output = AsynchronousIOStream_GetDescriptor(Destination);
+        size_t   SourceSize              = 0;
+        bool     InputIsSeekable         = FileIO_IsSeekable(Input, &SourceSize);
+        bool     OutputIsSeekable        = FileIO_IsSeekable(Output, NULL);
+        if (NumBytes == 0) {
+            if (InputIsSeekable) {
+                NumBytes                 = SourceSize > SourceOffset ? SourceSize - SourceOffset : 0;
+            } else {
+                NumBytes                 = SIZE_MAX; // Until the other end closes
+            }
+        }
+        FileIO_TransferMethods Method    = TransferMethod_Buffered;
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsLinux)
+        if (InputIsSeekable && OutputIsSeekable) {
+            Method                       = TransferMethod_CopyRange;
+        } else if (InputIsSeekable) {
+            Method                       = TransferMethod_SendFile;
+        } else {
+            Method                       = TransferMethod_Splice;
+        }
+        int      Pipe[2]                 = {-1, -1};
+        off_t    OutputPosition          = -1; // sendfile only writes at the output's file offset, so it's moved there and put back afterwards
+#endif /* PlatformIO_TargetOS */
+        uint8_t *Buffer                  = NULL;
+        size_t   Transferred             = 0;
+        while (Transferred < NumBytes) {
+            size_t  Chunk                = NumBytes - Transferred < FileIO_MaxTransferSize ? NumBytes - Transferred : FileIO_MaxTransferSize;
+            ssize_t Result               = -1;
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsLinux)
+            loff_t  InputOffset          = (loff_t) (SourceOffset + Transferred);
+            loff_t  OutputOffset         = (loff_t) (DestinationOffset + Transferred);
+            if (Method == TransferMethod_CopyRange) {
+                Result                   = copy_file_range(Input, &InputOffset, Output, &OutputOffset, Chunk, 0);
+            } else if (Method == TransferMethod_SendFile) {
+                off_t SendOffset         = (off_t) InputOffset;
+                if (OutputIsSeekable && OutputPosition < 0) {
+                    OutputPosition       = lseek(Output, 0, SEEK_CUR);
+                }
+                if (OutputIsSeekable == No || (OutputPosition >= 0 && lseek(Output, (off_t) OutputOffset, SEEK_SET) >= 0)) {
+                    Result               = sendfile(Output, Input, &SendOffset, Chunk);
+                }
+            } else if (Method == TransferMethod_Splice) {
+                loff_t *InputAt          = InputIsSeekable ? &InputOffset : NULL;
+                loff_t *OutputAt         = OutputIsSeekable ? &OutputOffset : NULL;
+                struct stat InputStatus, OutputStatus;
+                bool    HasPipe          = (fstat(Input, &InputStatus) == 0 && S_ISFIFO(InputStatus.st_mode)) || (fstat(Output, &OutputStatus) == 0 && S_ISFIFO(OutputStatus.st_mode));
+                if (HasPipe) {
+                    Result               = splice(Input, InputAt, Output, OutputAt, Chunk, SPLICE_F_MOVE | SPLICE_F_MORE);
+                } else if (Pipe[0] >= 0 || pipe2(Pipe, O_CLOEXEC) == 0) { // splice needs a pipe on one end, so stage through our own
+                    ssize_t Staged       = splice(Input, InputAt, Pipe[1], NULL, Chunk < FileIO_SpliceSize ? Chunk : FileIO_SpliceSize, SPLICE_F_MOVE | SPLICE_F_MORE);
+                    Result               = Staged;
+                    if (Staged > 0) {
+                        ssize_t Drained  = 0;
+                        while (Drained < Staged) {
+                            ssize_t Moved = splice(Pipe[0], NULL, Output, OutputAt, (size_t) (Staged - Drained), SPLICE_F_MOVE | SPLICE_F_MORE);
+                            if (Moved <= 0) {
+                                break;
+                            }
+                            Drained     += Moved;
+                        }
+                        if (Drained < Staged) {
+                            Transferred += (size_t) Drained;
+                            break; // The rest is stuck in our pipe, it can't be handed back
+                        }
+                    }
+                }
+            }
+            if (Result < 0 && errno == EINTR) {
+                continue;
+            }
+            if (Result < 0 && Method != TransferMethod_Buffered && (errno == EXDEV || errno == EINVAL || errno == ENOSYS || errno == EOPNOTSUPP || errno == EBADF || errno == ESPIPE)) {
+                Method                   = Method == TransferMethod_CopyRange ? TransferMethod_SendFile : TransferMethod_Buffered; // Nothing moved, so retry the chunk the slower way
+                continue;
+            }
+#endif /* PlatformIO_TargetOS */
+            if (Method == TransferMethod_Buffered) {
+                if (Buffer == NULL) {
+                    Buffer               = malloc(FileIO_TransferBufferSize);
+                    AssertIO(Buffer != NULL);
+                }
+                Result                   = FileIO_TransferBuffered(Destination, DestinationOffset + Transferred, OutputIsSeekable, Source, SourceOffset + Transferred, InputIsSeekable, Buffer, Chunk < FileIO_TransferBufferSize ? Chunk : FileIO_TransferBufferSize);
+            }
+            if (Result <= 0) {
+                break; // End of the source, or an error
+            }
+            Transferred                 += (size_t) Result;
+        }
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsLinux)
+        if (Pipe[0] >= 0) {
+            close(Pipe[0]);
+            close(Pipe[1]);
+        }
+        if (OutputPosition >= 0) {
+            lseek(Output, OutputPosition, SEEK_SET);
+        }
+#endif /* PlatformIO_TargetOS */
+        free(Buffer);
+        return Transferred;
+    }
+    /* Transfers */
+
+    /* Directory Walking */
+    static void FileIO_DirectoryWalker_Lock(FileIO_DirectoryWalker *Walker) {
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        pthread_mutex_lock(&Walker->Lock);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        AcquireSRWLockExclusive(&Walker->Lock);
+#endif /* PlatformIO_TargetOS */
+    }
+
+    static void FileIO_DirectoryWalker_Unlock(FileIO_DirectoryWalker *Walker) {
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        pthread_mutex_unlock(&Walker->Lock);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        ReleaseSRWLockExclusive(&Walker->Lock);
+#endif /* PlatformIO_TargetOS */
+    }
+
+    static void FileIO_DirectoryWalker_Wake(FileIO_DirectoryWalker *Walker, bool WakeAll) {
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        if (WakeAll) {
+            pthread_cond_broadcast(&Walker->WorkChanged);
+        } else {
+            pthread_cond_signal(&Walker->WorkChanged);
+        }
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        if (WakeAll) {
+            WakeAllConditionVariable(&Walker->WorkChanged);
+        } else {
+            WakeConditionVariable(&Walker->WorkChanged);
+        }
+#endif /* PlatformIO_TargetOS */
+    }
+
+    /* Called with the lock held */
+    static void FileIO_DirectoryWalker_Push(FileIO_DirectoryWalker *Walker, PlatformIO_Immutable(UTF8 *) Path, size_t PathSize, AsynchronousIO_Descriptor Descriptor, uint16_t Depth) {
+        if (Walker->NumPending == Walker->PendingCapacity) {
+            size_t Capacity                  = Walker->PendingCapacity == 0 ? 64 : Walker->PendingCapacity * 2;
+            FileIO_PendingDirectory *Grown   = realloc(Walker->Pending, Capacity * sizeof(FileIO_PendingDirectory));
+            AssertIO(Grown != NULL);
+            Walker->Pending                  = Grown;
+            Walker->PendingCapacity          = Capacity;
+        }
+        UTF8 *Copy                           = malloc(PathSize + TextIO_NULLTerminatorSize);
+        AssertIO(Copy != NULL);
+        memcpy(Copy, Path, PathSize);
+        Copy[PathSize]                       = TextIO_NULLTerminator;
+        Walker->Pending[Walker->NumPending].Path       = Copy;
+        Walker->Pending[Walker->NumPending].PathSize   = PathSize;
+        Walker->Pending[Walker->NumPending].Descriptor = Descriptor;
+        Walker->Pending[Walker->NumPending].Depth      = Depth;
+        Walker->NumPending                  += 1;
+        FileIO_DirectoryWalker_Wake(Walker, No);
+    }
+
+    static bool FileIO_DirectoryWalker_IsWanted(FileIO_DirectoryWalker *Walker, PlatformIO_Immutable(UTF8 *) Name, size_t NameSize) {
+        if (Walker->Extensions == NULL) {
+            return Yes;
+        }
+        for (size_t Extension = 0; Extension < Walker->NumExtensions; Extension++) {
+            size_t ExtensionSize             = Walker->ExtensionSizes[Extension];
+            if (NameSize > ExtensionSize && Name[NameSize - ExtensionSize - 1] == '.') {
+                PlatformIO_Immutable(UTF8 *) Suffix = &Name[NameSize - ExtensionSize];
+                size_t CodeUnit              = 0;
+                while (CodeUnit < ExtensionSize) {
+                    UTF8 Folded              = (Suffix[CodeUnit] >= 'A' && Suffix[CodeUnit] <= 'Z') ? Suffix[CodeUnit] + 32 : Suffix[CodeUnit];
+                    if (Folded != Walker->Extensions[Extension][CodeUnit]) {
+                        break;
+                    }
+                    CodeUnit                += 1;
+                }
+                if (CodeUnit == ExtensionSize) {
+                    return Yes;
+                }
+            }
+        }
+        return No;
+    }
+
+    /* Entry arrives with Name, Type, and whatever the listing had; the rest is stat'd relative to the directory, without resolving the path again */
+    static bool FileIO_DirectoryWalker_Visit(FileIO_DirectoryWalker *Walker, FileIO_WalkScratch *Scratch, const FileIO_PendingDirectory *Directory, AsynchronousIO_Descriptor DirectoryDescriptor, FileIO_DirectoryEntry *Entry, size_t NameSize) {
+        if (Entry->Name[0] == '.' && (NameSize == 1 || (NameSize == 2 && Entry->Name[1] == '.'))) {
+            return Yes;
+        }
+        if (Entry->Type != EntryType_Directory && Entry->Type != EntryType_Unknown && FileIO_DirectoryWalker_IsWanted(Walker, Entry->Name, NameSize) == No) {
+            return Yes; // Rejected before paying for a stat
+        }
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        bool NeedsStat                       = Entry->Type == EntryType_Unknown || PlatformIO_Is(Walker->Fields, EntryField_Size) || PlatformIO_Is(Walker->Fields, EntryField_ModificationTime);
+        if (NeedsStat) {
+#if   defined(STATX_BASIC_STATS)
+            unsigned int Mask                = STATX_TYPE | STATX_MODE;
+            if PlatformIO_Is(Walker->Fields, EntryField_Size) {
+                Mask                        |= STATX_SIZE;
+            }
+            if PlatformIO_Is(Walker->Fields, EntryField_ModificationTime) {
+                Mask                        |= STATX_MTIME;
+            }
+            struct statx Information;
+            if (statx(DirectoryDescriptor, (const char *) Entry->Name, AT_SYMLINK_NOFOLLOW | AT_NO_AUTOMOUNT, Mask, &Information) != 0) {
+                return Yes; // Deleted since it was listed
+            }
+            mode_t Mode                      = Information.stx_mode;
+            Entry->Size                      = PlatformIO_Is(Walker->Fields, EntryField_Size) ? Information.stx_size : 0;
+            Entry->ModificationTime          = PlatformIO_Is(Walker->Fields, EntryField_ModificationTime) ? (Information.stx_mtime.tv_sec * 1000000000LL) + Information.stx_mtime.tv_nsec : 0;
+#else
+            struct stat Information;
+            if (fstatat(DirectoryDescriptor, (const char *) Entry->Name, &Information, AT_SYMLINK_NOFOLLOW) != 0) {
+                return Yes;
+            }
+            mode_t Mode                      = Information.st_mode;
+            Entry->Size                      = PlatformIO_Is(Walker->Fields, EntryField_Size) ? (uint64_t) Information.st_size : 0;
+            Entry->ModificationTime          = PlatformIO_Is(Walker->Fields, EntryField_ModificationTime) ? (int64_t) Information.st_mtime * 1000000000LL : 0; // Whole seconds, the nanosecond field's name isn't portable
+#endif /* STATX_BASIC_STATS */
+            if (S_ISREG(Mode)) {
+                Entry->Type                  = EntryType_File;
+            } else if (S_ISDIR(Mode)) {
+                Entry->Type                  = EntryType_Directory;
+            } else if (S_ISLNK(Mode)) {
+                Entry->Type                  = EntryType_SymbolicLink;
+            } else {
+                Entry->Type                  = EntryType_Other;
+            }
+        }
+        if (PlatformIO_Is(Walker->Fields, EntryField_Inode) == No) {
+            Entry->Inode                     = 0;
+        }
+        const UTF8 Separator                 = '/';
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        const UTF8 Separator                 = '\\';
+#endif /* PlatformIO_TargetOS */
+        if (Entry->Type != EntryType_Directory && FileIO_DirectoryWalker_IsWanted(Walker, Entry->Name, NameSize) == No) {
+            return Yes;
+        }
+        size_t DirectorySize                 = Directory->PathSize;
+        bool   AddSeparator                  = DirectorySize > 0 && Directory->Path[DirectorySize - 1] != Separator;
+        size_t PathSize                      = DirectorySize + AddSeparator + NameSize;
+        if (PathSize + TextIO_NULLTerminatorSize > Scratch->PathCapacity) {
+            size_t Capacity                  = (PathSize + TextIO_NULLTerminatorSize) * 2;
+            UTF8  *Grown                     = realloc(Scratch->Path, Capacity);
+            AssertIO(Grown != NULL);
+            Scratch->Path                    = Grown;
+            Scratch->PathCapacity            = Capacity;
+        }
+        memcpy(Scratch->Path, Directory->Path, DirectorySize);
+        if (AddSeparator) {
+            Scratch->Path[DirectorySize]     = Separator;
+        }
+        memcpy(&Scratch->Path[DirectorySize + AddSeparator], Entry->Name, NameSize);
+        Scratch->Path[PathSize]              = TextIO_NULLTerminator;
+        Entry->Path                          = Scratch->Path;
+        Entry->Name                          = &Scratch->Path[DirectorySize + AddSeparator];
+        Entry->Depth                         = Directory->Depth;
+        if (Entry->Type == EntryType_Directory) {
+            AsynchronousIO_Descriptor Child  = -1;
+            bool                      CanRead = Yes;
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+            Child                            = openat(DirectoryDescriptor, (const char *) Entry->Name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+            CanRead                          = Child >= 0 || errno == EMFILE || errno == ENFILE; // Out of descriptors, it's opened by path when its turn comes
+#endif /* PlatformIO_TargetOS */
+            FileIO_DirectoryWalker_Lock(Walker);
+            if (CanRead) {
+                FileIO_DirectoryWalker_Push(Walker, Scratch->Path, PathSize, Child, Directory->Depth + 1);
+            } else {
+                Walker->IsComplete           = No; // Gone, or swapped for a symbolic link, since it was listed
+            }
+            FileIO_DirectoryWalker_Unlock(Walker);
+        }
+        bool KeepWalking                     = Walker->Function(Entry, Walker->Context);
+        if (KeepWalking == No) {
+            FileIO_DirectoryWalker_Lock(Walker);
+            Walker->IsStopped                = Yes;
+            FileIO_DirectoryWalker_Wake(Walker, Yes);
+            FileIO_DirectoryWalker_Unlock(Walker);
+        }
+        return KeepWalking;
+    }
+
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+    static bool FileIO_DirectoryWalker_VisitRecord(FileIO_DirectoryWalker *Walker, FileIO_WalkScratch *Scratch, const FileIO_PendingDirectory *Directory, AsynchronousIO_Descriptor DirectoryDescriptor, const char *Name, uint64_t Inode, uint8_t RecordType) {
+        FileIO_DirectoryEntry Entry          = {.Name = (const UTF8 *) Name, .Inode = Inode, .Type = EntryType_Unknown};
+        if (RecordType == DT_REG) {
+            Entry.Type                       = EntryType_File;
+        } else if (RecordType == DT_DIR) {
+            Entry.Type                       = EntryType_Directory;
+        } else if (RecordType == DT_LNK) {
+            Entry.Type                       = EntryType_SymbolicLink;
+        } else if (RecordType != DT_UNKNOWN) {
+            Entry.Type                       = EntryType_Other;
+        }
+        return FileIO_DirectoryWalker_Visit(Walker, Scratch, Directory, DirectoryDescriptor, &Entry, strlen(Name));
+    }
+
+    /* Children come opened by their parent; the root, and children queued while the process was out of descriptors, are opened by path */
+    static AsynchronousIO_Descriptor FileIO_DirectoryWalker_Open(const FileIO_PendingDirectory *Directory) {
+        if (Directory->Descriptor >= 0) {
+            return Directory->Descriptor;
+        }
+        return open((const char *) Directory->Path, O_RDONLY | O_DIRECTORY | O_CLOEXEC | (Directory->Depth > 0 ? O_NOFOLLOW : 0)); // The root itself may be a symbolic link
+    }
+#endif /* PlatformIO_TargetOS */
+
+    static bool FileIO_DirectoryWalker_IsStopped(FileIO_DirectoryWalker *Walker) {
+        FileIO_DirectoryWalker_Lock(Walker);
+        bool IsStopped                       = Walker->IsStopped;
+        FileIO_DirectoryWalker_Unlock(Walker);
+        return IsStopped;
+    }
+
+    static bool FileIO_DirectoryWalker_Read(FileIO_DirectoryWalker *Walker, FileIO_WalkScratch *Scratch, const FileIO_PendingDirectory *Directory) {
+        bool ReadAll                         = Yes;
+        bool KeepWalking                     = Yes;
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsLinux)
+        AsynchronousIO_Descriptor Descriptor = FileIO_DirectoryWalker_Open(Directory);
+        if (Descriptor < 0) {
+            return No;
+        }
+        ssize_t ListingSize                  = 0;
+        while (KeepWalking && (ListingSize = syscall(SYS_getdents64, Descriptor, Scratch->Listing, FileIO_ListingSize)) > 0) {
+            ssize_t Offset                   = 0;
+            while (KeepWalking && Offset < ListingSize) {
+                FileIO_LinuxDirent64 *Record = (FileIO_LinuxDirent64 *) &Scratch->Listing[Offset];
+                KeepWalking                  = FileIO_DirectoryWalker_VisitRecord(Walker, Scratch, Directory, Descriptor, Record->Name, Record->Inode, Record->Type);
+                Offset                      += Record->RecordSize;
+            }
+            KeepWalking                     &= FileIO_DirectoryWalker_IsStopped(Walker) == No; // Once per listing, another thread may have stopped the walk
+        }
+        ReadAll                              = ListingSize == 0 || KeepWalking == No;
+        close(Descriptor);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        AsynchronousIO_Descriptor Descriptor = FileIO_DirectoryWalker_Open(Directory);
+        DIR *Listing                         = Descriptor >= 0 ? fdopendir(Descriptor) : NULL;
+        if (Listing == NULL) {
+            if (Descriptor >= 0) {
+                close(Descriptor);
+            }
+            return No;
+        }
+        while (KeepWalking) {
+            errno                            = 0; // readdir returns NULL for both the end and an error
+            struct dirent *Record            = readdir(Listing);
+            if (Record == NULL) {
+                ReadAll                      = errno == 0;
+                break;
+            }
+            KeepWalking                      = FileIO_DirectoryWalker_VisitRecord(Walker, Scratch, Directory, Descriptor, Record->d_name, (uint64_t) Record->d_ino, Record->d_type);
+        }
+        closedir(Listing); // Closes Descriptor too
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        size_t DirectorySize                 = Directory->PathSize;
+        UTF8  *Pattern8                      = malloc(DirectorySize + 2 + TextIO_NULLTerminatorSize);
+        AssertIO(Pattern8 != NULL);
+        memcpy(Pattern8, Directory->Path, DirectorySize);
+        Pattern8[DirectorySize]              = '\\';
+        Pattern8[DirectorySize + 1]          = '*';
+        Pattern8[DirectorySize + 2]          = TextIO_NULLTerminator;
+        UTF16 *Pattern16                     = UTF8_Convert(Pattern8);
+        free(Pattern8);
+        WIN32_FIND_DATAW Data;
+        HANDLE Find                          = FindFirstFileExW((const wchar_t *) Pattern16, FindExInfoBasic, &Data, FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
+        UTF16_Deinit(Pattern16);
+        if (Find == INVALID_HANDLE_VALUE) {
+            return No;
+        }
+        do {
+            UTF8 *Name8                      = UTF16_Convert((const UTF16 *) Data.cFileName);
+            FileIO_DirectoryEntry Entry      = {.Name = Name8, .Type = EntryType_File};
+            if ((Data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) == FILE_ATTRIBUTE_REPARSE_POINT) {
+                Entry.Type                   = EntryType_SymbolicLink;
+            } else if ((Data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == FILE_ATTRIBUTE_DIRECTORY) {
+                Entry.Type                   = EntryType_Directory;
+            }
+            if PlatformIO_Is(Walker->Fields, EntryField_Size) {
+                Entry.Size                   = ((uint64_t) Data.nFileSizeHigh << 32) | Data.nFileSizeLow;
+            }
+            if PlatformIO_Is(Walker->Fields, EntryField_ModificationTime) {
+                uint64_t Ticks               = ((uint64_t) Data.ftLastWriteTime.dwHighDateTime << 32) | Data.ftLastWriteTime.dwLowDateTime;
+                Entry.ModificationTime       = ((int64_t) Ticks - 116444736000000000LL) * 100; // 100ns ticks since 1601
+            }
+            KeepWalking                      = FileIO_DirectoryWalker_Visit(Walker, Scratch, Directory, -1, &Entry, strlen((const char *) Name8));
+            UTF8_Deinit(Name8);
+        } while (KeepWalking && FindNextFileW(Find, &Data) != 0);
+        FindClose(Find);
+#endif /* PlatformIO_TargetOS */
+        return ReadAll;
+    }
+
+    static void FileIO_DirectoryWalker_Work(FileIO_DirectoryWalker *Walker) {
+        FileIO_WalkScratch Scratch           = {0};
+        Scratch.PathCapacity                 = FileIO_InitialPathSize;
+        Scratch.Path                         = malloc(Scratch.PathCapacity);
+        AssertIO(Scratch.Path != NULL);
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsLinux)
+        Scratch.Listing                      = malloc(FileIO_ListingSize);
+        AssertIO(Scratch.Listing != NULL);
+#endif /* PlatformIO_TargetOS */
+        FileIO_DirectoryWalker_Lock(Walker);
+        while (Walker->IsStopped == No) {
+            if (Walker->NumPending == 0) {
+                if (Walker->NumBusy == 0) {
+                    break; // Nothing queued, and nobody left who could queue more
+                }
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+                pthread_cond_wait(&Walker->WorkChanged, &Walker->Lock);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+                SleepConditionVariableSRW(&Walker->WorkChanged, &Walker->Lock, INFINITE, 0);
+#endif /* PlatformIO_TargetOS */
+                continue;
+            }
+            Walker->NumPending              -= 1;
+            FileIO_PendingDirectory Directory = Walker->Pending[Walker->NumPending];
+            Walker->NumBusy                 += 1;
+            FileIO_DirectoryWalker_Unlock(Walker);
+            bool ReadAll                     = FileIO_DirectoryWalker_Read(Walker, &Scratch, &Directory);
+            free(Directory.Path);
+            FileIO_DirectoryWalker_Lock(Walker);
+            Walker->NumBusy                 -= 1;
+            Walker->IsComplete              &= ReadAll;
+            if (Walker->NumBusy == 0 && Walker->NumPending == 0) {
+                FileIO_DirectoryWalker_Wake(Walker, Yes); // Let everyone waiting see the walk is over
+            }
+        }
+        FileIO_DirectoryWalker_Unlock(Walker);
+        free(Scratch.Path);
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsLinux)
+        free(Scratch.Listing);
+#endif /* PlatformIO_TargetOS */
+    }
+
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+    static void *FileIO_DirectoryWalker_Thread(void *Argument) {
+        FileIO_DirectoryWalker_Work((FileIO_DirectoryWalker *) Argument);
+        return NULL;
+    }
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+    static DWORD WINAPI FileIO_DirectoryWalker_Thread(LPVOID Argument) {
+        FileIO_DirectoryWalker_Work((FileIO_DirectoryWalker *) Argument);
+        return 0;
+    }
+#endif /* PlatformIO_TargetOS */
+
+    FileIO_DirectoryWalker *FileIO_DirectoryWalker_Init(uint16_t NumThreads) {
+        FileIO_DirectoryWalker *Walker       = calloc(1, sizeof(FileIO_DirectoryWalker));
+        AssertIO(Walker != NULL);
+        if (NumThreads == 0) {
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+            long NumCPUs                     = sysconf(_SC_NPROCESSORS_ONLN);
+            NumThreads                       = NumCPUs > 0 && NumCPUs < UINT16_MAX ? (uint16_t) NumCPUs : 1;
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+            SYSTEM_INFO System;
+            GetSystemInfo(&System);
+            NumThreads                       = (uint16_t) System.dwNumberOfProcessors;
+#endif /* PlatformIO_TargetOS */
+        }
+        Walker->NumThreads                   = NumThreads;
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        pthread_mutex_init(&Walker->Lock, NULL);
+        pthread_cond_init(&Walker->WorkChanged, NULL);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        InitializeSRWLock(&Walker->Lock);
+        InitializeConditionVariable(&Walker->WorkChanged);
+#endif /* PlatformIO_TargetOS */
+        return Walker;
+    }
+
+    void FileIO_DirectoryWalker_SetFields(FileIO_DirectoryWalker *Walker, FileIO_EntryFields Fields) {
+        AssertIO(Walker != NULL);
+
+        Walker->Fields                       = Fields;
+    }
+
+    void FileIO_DirectoryWalker_SetExtensions(FileIO_DirectoryWalker *Walker, PlatformIO_Immutable(UTF8 *) const *Extensions, size_t NumExtensions) {
+        AssertIO(Walker != NULL);
+        AssertIO(Extensions == NULL || NumExtensions > 0);
+
+        for (size_t Extension = 0; Extension < Walker->NumExtensions; Extension++) {
+            free(Walker->Extensions[Extension]);
+        }
+        free(Walker->Extensions);
+        free(Walker->ExtensionSizes);
+        Walker->Extensions                   = NULL;
+        Walker->ExtensionSizes               = NULL;
+        Walker->NumExtensions                = 0;
+        if (Extensions != NULL) {
+            Walker->Extensions               = calloc(NumExtensions, sizeof(UTF8 *));
+            Walker->ExtensionSizes           = calloc(NumExtensions, sizeof(size_t));
+            AssertIO(Walker->Extensions != NULL && Walker->ExtensionSizes != NULL);
+            for (size_t Extension = 0; Extension < NumExtensions; Extension++) {
+                size_t ExtensionSize         = strlen((const char *) Extensions[Extension]);
+                UTF8  *Folded                = malloc(ExtensionSize + TextIO_NULLTerminatorSize);
+                AssertIO(Folded != NULL);
+                for (size_t CodeUnit = 0; CodeUnit < ExtensionSize; CodeUnit++) {
+                    UTF8 Original            = Extensions[Extension][CodeUnit];
+                    Folded[CodeUnit]         = (Original >= 'A' && Original <= 'Z') ? Original + 32 : Original;
+                }
+                Folded[ExtensionSize]        = TextIO_NULLTerminator;
+                Walker->Extensions[Extension]     = Folded;
+                Walker->ExtensionSizes[Extension] = ExtensionSize;
+            }
+            Walker->NumExtensions            = NumExtensions;
+        }
+    }
+
+    bool FileIO_DirectoryWalker_Walk(FileIO_DirectoryWalker *Walker, PlatformIO_Immutable(UTF8 *) Root, FileIO_WalkFunction Function, void *Context) {
+        AssertIO(Walker != NULL);
+        AssertIO(Root != NULL);
+        AssertIO(Function != NULL);
+
+        size_t RootOffset                    = UTF8_HasBOM(Root) ? UTF8BOMSizeInCodeUnits : 0;
+        Walker->Function                     = Function;
+        Walker->Context                      = Context;
+        Walker->IsStopped                    = No;
+        Walker->IsComplete                   = Yes;
+        Walker->NumBusy                      = 0;
+        FileIO_DirectoryWalker_Lock(Walker);
+        FileIO_DirectoryWalker_Push(Walker, &Root[RootOffset], strlen((const char *) &Root[RootOffset]), -1, 0);
+        FileIO_DirectoryWalker_Unlock(Walker);
+        uint16_t NumStarted                  = 0;
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        pthread_t *Threads                   = calloc(Walker->NumThreads, sizeof(pthread_t));
+        AssertIO(Threads != NULL);
+        while (NumStarted + 1 < Walker->NumThreads && pthread_create(&Threads[NumStarted], NULL, FileIO_DirectoryWalker_Thread, Walker) == 0) {
+            NumStarted                      += 1;
+        }
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        HANDLE    *Threads                   = calloc(Walker->NumThreads, sizeof(HANDLE));
+        AssertIO(Threads != NULL);
+        while (NumStarted + 1 < Walker->NumThreads && (Threads[NumStarted] = CreateThread(NULL, 0, FileIO_DirectoryWalker_Thread, Walker, 0, NULL)) != NULL) {
+            NumStarted                      += 1;
+        }
+#endif /* PlatformIO_TargetOS */
+        FileIO_DirectoryWalker_Work(Walker); // The caller is one of the workers
+        for (uint16_t Thread = 0; Thread < NumStarted; Thread++) {
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+            pthread_join(Threads[Thread], NULL);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+            WaitForSingleObject(Threads[Thread], INFINITE);
+            CloseHandle(Threads[Thread]);
+#endif /* PlatformIO_TargetOS */
+        }
+        free(Threads);
+        for (size_t Directory = 0; Directory < Walker->NumPending; Directory++) {
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+            if (Walker->Pending[Directory].Descriptor >= 0) {
+                close(Walker->Pending[Directory].Descriptor);
+            }
+#endif /* PlatformIO_TargetOS */
+            free(Walker->Pending[Directory].Path); // Left behind when the walk was stopped
+        }
+        Walker->NumPending                   = 0;
+        return Walker->IsComplete && Walker->IsStopped == No;
+    }
+
+    void FileIO_DirectoryWalker_Deinit(FileIO_DirectoryWalker *Walker) {
+        AssertIO(Walker != NULL);
+
+        FileIO_DirectoryWalker_SetExtensions(Walker, NULL, 0);
+        free(Walker->Pending);
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        pthread_cond_destroy(&Walker->WorkChanged);
+        pthread_mutex_destroy(&Walker->Lock);
+#endif /* PlatformIO_TargetOS */
+        free(Walker);
+    }
+    /* Directory Walking */
     
     // fchdir changes the current working directory
     
@@ -9,10 +9,22 @@
 #include <sys/sysctl.h>
 #elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
 #include <stddef.h>
+#endif /* PlatformIO_TargetOS */
+
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+#include <pthread.h>                       /* Included for pthread_once */
 #elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
 #include <sysinfoapi.h>
 #endif /* PlatformIO_TargetOS */
 
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+#if   (PlatformIO_Compiler == PlatformIO_CompilerIsClang) || (PlatformIO_Compiler == PlatformIO_CompilerIsGCC)
+#include <cpuid.h>                         /* Included for __cpuid_count */
+#elif (PlatformIO_Compiler == PlatformIO_CompilerIsMSVC)
+#include <intrin.h>                        /* Included for __cpuidex, _xgetbv */
+#endif /* PlatformIO_Compiler */
+#endif /* PlatformIO_Architecture */
+
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
 extern "C" {
 #endif
@@ -37,6 +49,91 @@ extern "C" {
         return TotalMemory;
     }
 
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+    static void PlatformIO_CPUID(uint32_t Leaf, uint32_t SubLeaf, uint32_t Registers[4]) {
+#if   (PlatformIO_Compiler == PlatformIO_CompilerIsClang) || (PlatformIO_Compiler == PlatformIO_CompilerIsGCC)
+        __cpuid_count(Leaf, SubLeaf, Registers[0], Registers[1], Registers[2], Registers[3]);
+#elif (PlatformIO_Compiler == PlatformIO_CompilerIsMSVC)
+        int Info[4];
+        __cpuidex(Info, (int) Leaf, (int) SubLeaf);
+        for (uint8_t Register = 0; Register < 4; Register++) {
+            Registers[Register] = (uint32_t) Info[Register];
+        }
+#endif /* PlatformIO_Compiler */
+    }
+
+    static uint64_t PlatformIO_GetEnabledStateComponents(void) {
+#if   (PlatformIO_Compiler == PlatformIO_CompilerIsClang) || (PlatformIO_Compiler == PlatformIO_CompilerIsGCC)
+        uint32_t Low  = 0;
+        uint32_t High = 0;
+        __asm__ volatile("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+        return ((uint64_t) High << 32) | Low;
+#elif (PlatformIO_Compiler == PlatformIO_CompilerIsMSVC)
+        return _xgetbv(0);
+#endif /* PlatformIO_Compiler */
+    }
+#endif /* PlatformIO_Architecture */
+
+    static PlatformIO_SIMDExtensions PlatformIO_SIMDExtensionsDetected = SIMDExtension_Unspecified;
+
+    static void PlatformIO_DetectSIMDExtensions(void) {
+        uint32_t Detected      = SIMDExtension_Unspecified;
+#if   (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+        uint32_t Leaf1[4]      = {0, 0, 0, 0};
+        uint32_t Leaf7[4]      = {0, 0, 0, 0};
+        PlatformIO_CPUID(0, 0, Leaf7);
+        uint32_t MaxLeaf       = Leaf7[0];
+        PlatformIO_CPUID(1, 0, Leaf1);
+        if (MaxLeaf >= 7) {
+            PlatformIO_CPUID(7, 0, Leaf7);
+        } else {
+            Leaf7[1]           = 0;
+        }
+        Detected              |= (Leaf1[3] & (1 << 26)) ? SIMDExtension_SSE2   : 0;
+        Detected              |= (Leaf1[2] & (1 << 9))  ? SIMDExtension_SSSE3  : 0;
+        Detected              |= (Leaf1[2] & (1 << 19)) ? SIMDExtension_SSE41  : 0;
+        Detected              |= (Leaf1[2] & (1 << 20)) ? SIMDExtension_SSE42  : 0;
+        Detected              |= (Leaf1[2] & (1 << 1))  ? SIMDExtension_PCLMUL : 0;
+        Detected              |= (Leaf7[1] & (1 << 8))  ? SIMDExtension_BMI2   : 0;
+        bool OSSavesYMM        = false;
+        bool OSSavesZMM        = false;
+        if (Leaf1[2] & (1 << 27)) { // OSXSAVE, XGETBV is usable
+            uint64_t StateComponents = PlatformIO_GetEnabledStateComponents();
+            OSSavesYMM         = (StateComponents & 0x06) == 0x06;
+            OSSavesZMM         = (StateComponents & 0xE6) == 0xE6;
+        }
+        if (OSSavesYMM) {
+            Detected          |= (Leaf1[2] & (1 << 28)) ? SIMDExtension_AVX  : 0;
+            Detected          |= (Leaf7[1] & (1 << 5))  ? SIMDExtension_AVX2 : 0;
+        }
+        if (OSSavesZMM) {
+            Detected          |= (Leaf7[1] & (1 << 16)) ? SIMDExtension_AVX512F  : 0;
+            Detected          |= (Leaf7[1] & (1 << 30)) ? SIMDExtension_AVX512BW : 0;
+        }
+#elif (PlatformIO_Architecture == PlatformIO_ArchIsARM64)
+        Detected               = SIMDExtension_NEON; // Advanced SIMD is mandatory on AArch64
+#endif /* PlatformIO_Architecture */
+        PlatformIO_SIMDExtensionsDetected = (PlatformIO_SIMDExtensions) Detected;
+    }
+
+#if PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+    static BOOL CALLBACK PlatformIO_DetectSIMDExtensions_Once(PINIT_ONCE Once, PVOID Parameter, PVOID *Context) {
+        PlatformIO_DetectSIMDExtensions();
+        return TRUE;
+    }
+#endif /* PlatformIO_TargetOS */
+
+    PlatformIO_SIMDExtensions PlatformIO_GetSIMDExtensions(void) { // Detected exactly once, the once primitive publishes the result to every thread
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        static pthread_once_t Once = PTHREAD_ONCE_INIT;
+        pthread_once(&Once, PlatformIO_DetectSIMDExtensions);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        static INIT_ONCE      Once = INIT_ONCE_STATIC_INIT;
+        InitOnceExecuteOnce(&Once, PlatformIO_DetectSIMDExtensions_Once, NULL, NULL);
+#endif /* PlatformIO_TargetOS */
+        return PlatformIO_SIMDExtensionsDetected;
+    }
+
     PlatformIO_Range Range_Init(size_t Start, size_t End) {
         PlatformIO_Range Range;
         Range.Start = Start;
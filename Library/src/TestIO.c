@@ -216,8 +216,9 @@ extern "C" {
 #if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsApple)
             CurrentTime      = mach_continuous_time();
 #elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsLinux)
-            struct timespec *TimeSpec = NULL;
-            clock_gettime(CLOCK_MONOTONIC, TimeSpec);
+            struct timespec TimeSpec;
+            clock_gettime(CLOCK_MONOTONIC, &TimeSpec);
+            CurrentTime      = ((uint64_t) TimeSpec.tv_sec * 1000000000ULL) + (uint64_t) TimeSpec.tv_nsec;
 #elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
             LARGE_INTEGER WinCounter;
             bool Success    = QueryPerformanceCounter(&WinCounter);
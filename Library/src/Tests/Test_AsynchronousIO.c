@@ -1,13 +1,528 @@
 #include "../../include/TestIO.h"           /* Included for testing */
 #include "../../include/AsynchronousIO.h"   /* Included for our declarations */
 
+#include <stdio.h>                          /* Included for printf */
+#include <stdlib.h>                         /* Included for mkstemp */
+#include <string.h>                         /* Included for memcmp */
+#include <time.h>                           /* Included for nanosleep */
+#include <unistd.h>                         /* Included for close, unlink */
+#include <fcntl.h>                          /* Included for posix_fadvise */
+#include <pthread.h>                        /* Included for pthread_create, to Sync from many threads at once */
+#include <sys/mman.h>                       /* Included for mmap, mincore */
+
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
 extern "C" {
 #endif
 
+    /* A temporary file behind a stream, shared by every test */
+    typedef struct Test_Fixture {
+        AsynchronousIOStream *Stream;
+        int                   Descriptor;
+        char                  Path[sizeof("/tmp/Test_AsynchronousIO_XXXXXX")];
+    } Test_Fixture;
+
+    /*
+     Creates the temporary file and a stream for it.
+     With FileMode_Unspecified the stream takes mkstemp's descriptor, otherwise the descriptor is closed and the file is opened again with FileMode.
+     Returns No when the file can't be created or opened; the fixture is already torn down then.
+     */
+    static bool Test_Fixture_Init(Test_Fixture *Fixture, AsynchronousIO_FileModes FileMode) {
+        memcpy(Fixture->Path, "/tmp/Test_AsynchronousIO_XXXXXX", sizeof(Fixture->Path));
+        Fixture->Descriptor               = mkstemp(Fixture->Path);
+        if (Fixture->Descriptor < 0) {
+            return No;
+        }
+        Fixture->Stream                   = AsynchronousIOStream_Init();
+        if (FileMode == FileMode_Unspecified) {
+            AsynchronousIOStream_SetDescriptor(Fixture->Stream, Fixture->Descriptor);
+        } else {
+            close(Fixture->Descriptor);
+            Fixture->Descriptor           = -1;
+            if (AsynchronousIOStream_OpenPathUTF8(Fixture->Stream, (const UTF8 *) Fixture->Path, FileMode) == No) {
+                AsynchronousIOStream_Deinit(Fixture->Stream);
+                unlink(Fixture->Path);
+                return No;
+            }
+        }
+        return Yes;
+    }
+
+    static void Test_Fixture_Deinit(Test_Fixture *Fixture) {
+        AsynchronousIOStream_Deinit(Fixture->Stream);
+        unlink(Fixture->Path);
+    }
+
+    /* The bytes every test writes and expects back */
+    static void Test_Fill(uint8_t *Array, size_t NumBytes) {
+        for (size_t Byte = 0; Byte < NumBytes; Byte++) {
+            Array[Byte]                   = (uint8_t) ((Byte * 131) + 7);
+        }
+    }
+
+    /* Round trips through whichever backend the kernel gives us, with the read buffer registered when it's io_uring */
+    bool Test_ReadWrite(void) {
+        Test_Fixture          Fixture;
+        if (Test_Fixture_Init(&Fixture, FileMode_Unspecified) == No) {
+            return No;
+        }
+        bool                  TestPassed = Yes;
+        AsynchronousIOStream *Stream     = Fixture.Stream;
+        size_t                NumBytes   = 1024 * 1024;
+        uint8_t              *Written    = calloc(NumBytes, sizeof(uint8_t));
+        uint8_t              *Read       = calloc(NumBytes, sizeof(uint8_t));
+        Test_Fill(Written, NumBytes);
+        if (AsynchronousIOStream_GetBackend(Stream) == Backend_IOURing) {
+            void   *Buffers[1]           = {Read};
+            size_t  BufferSizes[1]       = {NumBytes};
+            TestPassed                  &= AsynchronousIOStream_RegisterBuffers(Stream, Buffers, BufferSizes, 1);
+        }
+        TestPassed                      &= AsynchronousIOStream_Write(Stream, Written, 4, NumBytes / 4) == NumBytes / 4;
+        AsynchronousIOStream_SetPosition(Stream, 0);
+        TestPassed                      &= AsynchronousIOStream_Read(Stream, Read, 1, NumBytes) == NumBytes;
+        TestPassed                      &= memcmp(Written, Read, NumBytes) == 0;
+        TestPassed                      &= AsynchronousIOStream_Read(Stream, Read, 1, 16) == 0; // At the end
+        Test_Fixture_Deinit(&Fixture);
+        free(Written);
+        free(Read);
+        return TestPassed;
+    }
+
+    static void Test_Requests_CountCompletion(AsynchronousIO_Request *Request, void *Context) {
+        size_t *NumCompleted             = Context;
+        *NumCompleted                   += 1;
+    }
+
+    /* Scatters a batch of reads across a file, and checks each callback fired once and each landed where it should */
+    bool Test_Requests(void) {
+        Test_Fixture            Fixture;
+        if (Test_Fixture_Init(&Fixture, FileMode_Unspecified) == No) {
+            return No;
+        }
+        bool                    TestPassed  = Yes;
+        AsynchronousIOStream   *Stream      = Fixture.Stream;
+        size_t                  NumBytes    = 256 * 1024;
+        uint8_t                *Written     = calloc(NumBytes, sizeof(uint8_t));
+        uint8_t                *Read        = calloc(NumBytes, sizeof(uint8_t));
+        Test_Fill(Written, NumBytes);
+        TestPassed                         &= AsynchronousIOStream_Write(Stream, Written, 1, NumBytes) == NumBytes;
+
+        size_t                  NumCompleted = 0;
+        size_t                  ChunkSize   = 4096;
+        size_t                  NumRequests = NumBytes / ChunkSize;
+        AsynchronousIO_Request **Requests   = calloc(NumRequests, sizeof(AsynchronousIO_Request *));
+        for (size_t Index = 0; Index < NumRequests; Index++) {
+            size_t Chunk                    = (Index * 7) % NumRequests; // Out of order on purpose
+            Requests[Index]                 = AsynchronousIO_Request_Init(Stream, RequestType_Read, &Read[Chunk * ChunkSize], ChunkSize, Chunk * ChunkSize);
+            AsynchronousIO_Request_SetCallback(Requests[Index], Test_Requests_CountCompletion, &NumCompleted);
+        }
+        TestPassed                         &= AsynchronousIO_Submit(Requests, NumRequests);
+        size_t                  First       = AsynchronousIO_WaitAny(Requests, NumRequests);
+        TestPassed                         &= AsynchronousIO_Request_IsComplete(Requests[First]);
+        TestPassed                         &= AsynchronousIO_WaitAll(Requests, NumRequests);
+        TestPassed                         &= AsynchronousIO_Poll(Requests, NumRequests) == NumRequests;
+        TestPassed                         &= NumCompleted == NumRequests;
+        TestPassed                         &= memcmp(Written, Read, NumBytes) == 0;
+        for (size_t Index = 0; Index < NumRequests; Index++) {
+            AsynchronousIO_Request_Deinit(Requests[Index]);
+        }
+        free(Requests);
+        Test_Fixture_Deinit(&Fixture);
+        free(Written);
+        free(Read);
+        return TestPassed;
+    }
+
+    /* Gathers a header, an index, and a payload into one file, then scatters them back out */
+    bool Test_Vectors(void) {
+        Test_Fixture          Fixture;
+        if (Test_Fixture_Init(&Fixture, FileMode_Unspecified) == No) {
+            return No;
+        }
+        bool                  TestPassed  = Yes;
+        AsynchronousIOStream *Stream      = Fixture.Stream;
+        uint8_t               Header[12]  = {'F', 'o', 'u', 'n', 'd', 'a', 't', 'i', 'o', 'n', 'I', 'O'};
+        uint32_t              Index[100];
+        uint8_t               Payload[5000];
+        for (size_t Entry = 0; Entry < 100; Entry++) {
+            Index[Entry]                  = (uint32_t) (Entry * 50);
+        }
+        Test_Fill(Payload, 5000);
+        AsynchronousIO_Vector Written[3]  = {{Header, sizeof(Header)}, {Index, sizeof(Index)}, {Payload, sizeof(Payload)}};
+        size_t                NumBytes    = sizeof(Header) + sizeof(Index) + sizeof(Payload);
+        TestPassed                       &= AsynchronousIOStream_WriteVectors(Stream, Written, 3, VectorFlag_Unspecified) == NumBytes;
+
+        uint8_t               Header2[12];
+        uint32_t              Index2[100];
+        uint8_t               Payload2[5000];
+        AsynchronousIO_Vector Read[3]     = {{Header2, sizeof(Header2)}, {Index2, sizeof(Index2)}, {Payload2, sizeof(Payload2)}};
+        AsynchronousIOStream_SetPosition(Stream, 0);
+        TestPassed                       &= AsynchronousIOStream_ReadVectors(Stream, Read, 3, VectorFlag_Unspecified) == NumBytes;
+        TestPassed                       &= AsynchronousIOStream_GetPosition(Stream) == NumBytes;
+        TestPassed                       &= memcmp(Header, Header2, sizeof(Header)) == 0;
+        TestPassed                       &= memcmp(Index, Index2, sizeof(Index)) == 0;
+        TestPassed                       &= memcmp(Payload, Payload2, sizeof(Payload)) == 0;
+        Test_Fixture_Deinit(&Fixture);
+        return TestPassed;
+    }
+
+    /* More vectors than one system call takes, read back with different boundaries and past the end of the file */
+    bool Test_ManyVectors(void) {
+        Test_Fixture           Fixture;
+        if (Test_Fixture_Init(&Fixture, FileMode_Unspecified) == No) {
+            return No;
+        }
+        bool                   TestPassed  = Yes;
+        AsynchronousIOStream  *Stream      = Fixture.Stream;
+        AsynchronousIO_Vector  Pieces[200];
+        size_t                 NumBytes    = 0;
+        for (size_t Piece = 0; Piece < 200; Piece++) {
+            Pieces[Piece].NumBytes         = 1 + (Piece * 37) % 113;
+            NumBytes                      += Pieces[Piece].NumBytes;
+        }
+        uint8_t               *Written     = calloc(NumBytes, sizeof(uint8_t));
+        uint8_t               *Read        = calloc(NumBytes + 4096, sizeof(uint8_t));
+        Test_Fill(Written, NumBytes);
+        size_t                 Offset      = 0;
+        for (size_t Piece = 0; Piece < 200; Piece++) {
+            Pieces[Piece].Array            = &Written[Offset];
+            Offset                        += Pieces[Piece].NumBytes;
+        }
+        TestPassed                        &= AsynchronousIOStream_WriteVectors(Stream, Pieces, 200, VectorFlag_Unspecified) == NumBytes;
+
+        Offset                             = 0;
+        for (size_t Piece = 0; Piece < 150; Piece++) {
+            Pieces[Piece].Array            = &Read[Offset];
+            Pieces[Piece].NumBytes         = Piece < 149 ? 1 + (Piece * 53) % 151 : NumBytes + 4096 - Offset; // The last one runs past the end
+            Offset                        += Pieces[Piece].NumBytes;
+        }
+        AsynchronousIOStream_SetPosition(Stream, 0);
+        TestPassed                        &= AsynchronousIOStream_ReadVectors(Stream, Pieces, 150, VectorFlag_Unspecified) == NumBytes;
+        TestPassed                        &= AsynchronousIOStream_GetPosition(Stream) == NumBytes;
+        TestPassed                        &= memcmp(Written, Read, NumBytes) == 0;
+        Test_Fixture_Deinit(&Fixture);
+        free(Written);
+        free(Read);
+        return TestPassed;
+    }
+
+    /*
+     Vectors and requests direct IO would refuse as they are: an unaligned vector over the 1MiB bounce buffer, so the walk resumes partway through it,
+     then more aligned vectors than fit in one system call, then an odd sized tail; and requests at unaligned offsets.
+     */
+    bool Test_DirectVectors(void) {
+        Test_Fixture           Fixture;
+        if (Test_Fixture_Init(&Fixture, FileMode_Read | FileMode_Write | FileMode_Direct) == No) {
+            printf("Test_DirectVectors: skipped, the filesystem under /tmp refuses O_DIRECT\n");
+            return Yes;
+        }
+        bool                   TestPassed  = Yes;
+        AsynchronousIOStream  *Stream      = Fixture.Stream;
+        size_t                 Alignment   = AsynchronousIOStream_GetAlignment(Stream);
+        size_t                 Large       = 3 * 1024 * 1024;
+        size_t                 NumBytes    = Large + 70 * Alignment + 5;
+        uint8_t               *Written     = calloc(NumBytes + 1, sizeof(uint8_t));
+        uint8_t               *Blocks      = AsynchronousIOStream_AllocateAligned(Stream, 70 * Alignment);
+        uint8_t               *Read        = AsynchronousIOStream_AllocateAligned(Stream, NumBytes);
+        Test_Fill(&Written[1], NumBytes);
+        memcpy(Blocks, &Written[1 + Large], 70 * Alignment);
+        AsynchronousIO_Vector  Pieces[72];
+        Pieces[0]                          = (AsynchronousIO_Vector) {&Written[1], Large};
+        for (size_t Piece = 0; Piece < 70; Piece++) {
+            Pieces[1 + Piece]              = (AsynchronousIO_Vector) {&Blocks[Piece * Alignment], Alignment};
+        }
+        Pieces[71]                         = (AsynchronousIO_Vector) {&Written[1 + Large + 70 * Alignment], 5};
+        TestPassed                        &= AsynchronousIOStream_WriteVectors(Stream, Pieces, 72, VectorFlag_Unspecified) == NumBytes;
+        TestPassed                        &= AsynchronousIOStream_GetPosition(Stream) == NumBytes;
+        TestPassed                        &= AsynchronousIOStream_ReadAt(Stream, Read, 1, NumBytes, 0) == NumBytes;
+        TestPassed                        &= memcmp(&Written[1], Read, NumBytes) == 0;
+
+        memset(Read, 0, NumBytes);
+        AsynchronousIO_Request *Requests[2] = {
+            AsynchronousIO_Request_Init(Stream, RequestType_Read, &Read[1], 1000, 1),
+            AsynchronousIO_Request_Init(Stream, RequestType_Read, &Read[Alignment], Alignment, Alignment),
+        };
+        TestPassed                        &= AsynchronousIO_Submit(Requests, 2);
+        TestPassed                        &= AsynchronousIO_WaitAll(Requests, 2);
+        TestPassed                        &= memcmp(&Written[2], &Read[1], 1000) == 0;
+        TestPassed                        &= memcmp(&Written[1 + Alignment], &Read[Alignment], Alignment) == 0;
+        AsynchronousIO_Request_Deinit(Requests[0]);
+        AsynchronousIO_Request_Deinit(Requests[1]);
+        AsynchronousIOStream_FreeAligned(Blocks);
+        AsynchronousIOStream_FreeAligned(Read);
+        Test_Fixture_Deinit(&Fixture);
+        free(Written);
+        return TestPassed;
+    }
+
+    /* Unaligned writes and reads through FileMode_Direct have to land exactly where buffered ones would */
+    bool Test_Direct(void) {
+        Test_Fixture          Fixture;
+        if (Test_Fixture_Init(&Fixture, FileMode_Read | FileMode_Write | FileMode_Direct) == No) {
+            printf("Test_Direct: skipped, the filesystem under /tmp refuses O_DIRECT\n");
+            return Yes;
+        }
+        bool                  TestPassed  = Yes;
+        AsynchronousIOStream *Stream      = Fixture.Stream;
+        size_t                Alignment   = AsynchronousIOStream_GetAlignment(Stream);
+        size_t                NumBytes    = 3 * Alignment + 123;
+        uint8_t              *Written     = calloc(NumBytes, sizeof(uint8_t));
+        uint8_t              *Read        = AsynchronousIOStream_AllocateAligned(Stream, NumBytes);
+        Test_Fill(Written, NumBytes);
+        AsynchronousIOStream_SetPosition(Stream, 1);
+        TestPassed                       &= AsynchronousIOStream_Write(Stream, &Written[1], 1, NumBytes - 1) == NumBytes - 1;
+        AsynchronousIOStream_SetPosition(Stream, 0);
+        TestPassed                       &= AsynchronousIOStream_Write(Stream, Written, 1, 1) == 1;
+        AsynchronousIOStream_SetPosition(Stream, 0);
+        TestPassed                       &= AsynchronousIOStream_Read(Stream, Read, 1, NumBytes + 100) == NumBytes; // The tail was trimmed back
+        TestPassed                       &= memcmp(Written, Read, NumBytes) == 0;
+        for (size_t Byte = Alignment; Byte < 2 * Alignment; Byte++) {
+            Written[Byte]                 = (uint8_t) ~Written[Byte];
+        }
+        memcpy(&Read[1], &Written[Alignment], Alignment);
+        TestPassed                       &= AsynchronousIOStream_WriteAt(Stream, &Read[1], 1, Alignment, Alignment) == Alignment; // Whole blocks from memory that isn't aligned
+        AsynchronousIOStream_Deinit(Stream);
+        Stream                            = AsynchronousIOStream_Init();
+        Fixture.Stream                    = Stream;
+        TestPassed                       &= AsynchronousIOStream_OpenPathUTF8(Stream, (const UTF8 *) Fixture.Path, FileMode_Read | FileMode_Write | FileMode_Direct); // Updates in place
+        memset(Read, 0, NumBytes);
+        TestPassed                       &= AsynchronousIOStream_ReadAt(Stream, Read, 1, NumBytes + 100, 0) == NumBytes;
+        TestPassed                       &= memcmp(Written, Read, NumBytes) == 0;
+        AsynchronousIOStream_FreeAligned(Read);
+        Test_Fixture_Deinit(&Fixture);
+        free(Written);
+        return TestPassed;
+    }
+
+    /* ReadAt and WriteAt mustn't move the stream's position, and the size has to be there without a seek */
+    bool Test_Positional(void) {
+        Test_Fixture          Fixture;
+        if (Test_Fixture_Init(&Fixture, FileMode_Unspecified) == No) {
+            return No;
+        }
+        bool                  TestPassed  = Yes;
+        AsynchronousIOStream *Stream      = Fixture.Stream;
+        uint64_t              Written[64];
+        uint64_t              Read[64];
+        for (size_t Index = 0; Index < 64; Index++) {
+            Written[Index]                = Index * 0x9E3779B97F4A7C15ULL;
+        }
+        AsynchronousIOStream_SetPosition(Stream, 5);
+        TestPassed                       &= AsynchronousIOStream_WriteAt(Stream, &Written[32], 8, 32, 256) == 32;
+        TestPassed                       &= AsynchronousIOStream_WriteAt(Stream, Written, 8, 32, 0) == 32;
+        TestPassed                       &= AsynchronousIOStream_GetPosition(Stream) == 5;
+        TestPassed                       &= AsynchronousIOStream_ReadAt(Stream, Read, 8, 64, 0) == 64;
+        TestPassed                       &= memcmp(Written, Read, sizeof(Written)) == 0;
+        TestPassed                       &= AsynchronousIOStream_ReadAt(Stream, Read, 8, 1, sizeof(Written)) == 0;
+
+        AsynchronousIOStream *Reopened    = AsynchronousIOStream_Init();
+        AsynchronousIOStream_SetDescriptor(Reopened, dup(Fixture.Descriptor)); // Its own descriptor, Deinit closes it
+        TestPassed                       &= AsynchronousIOStream_GetSize(Reopened) == sizeof(Written);
+        TestPassed                       &= AsynchronousIOStream_Deinit(Reopened);
+        Test_Fixture_Deinit(&Fixture);
+        return TestPassed;
+    }
+
+    /* Advice has to be accepted on a plain file, and a sequential reader still has to get every byte back in order */
+    bool Test_Advise(void) {
+        Test_Fixture          Fixture;
+        if (Test_Fixture_Init(&Fixture, FileMode_Unspecified) == No) {
+            return No;
+        }
+        bool                  TestPassed  = Yes;
+        AsynchronousIOStream *Stream      = Fixture.Stream;
+        size_t                NumBytes    = 1024 * 1024;
+        uint8_t              *Written     = calloc(NumBytes, sizeof(uint8_t));
+        uint8_t               Read[4096];
+        Test_Fill(Written, NumBytes);
+        TestPassed                       &= AsynchronousIOStream_WriteAt(Stream, Written, 1, NumBytes, 0) == NumBytes;
+        TestPassed                       &= AsynchronousIOStream_Advise(Stream, AccessPattern_Sequential, 0, 0);
+        TestPassed                       &= AsynchronousIOStream_Advise(Stream, AccessPattern_WillNeed, 0, 65536);
+        AsynchronousIOStream_SetPosition(Stream, 0);
+        for (size_t Offset = 0; Offset < NumBytes; Offset += sizeof(Read)) {
+            TestPassed                   &= AsynchronousIOStream_Read(Stream, Read, 1, sizeof(Read)) == sizeof(Read);
+            TestPassed                   &= memcmp(&Written[Offset], Read, sizeof(Read)) == 0;
+        }
+        TestPassed                       &= AsynchronousIOStream_Advise(Stream, AccessPattern_WillNeed, 0, 0); // To the end of the file
+        TestPassed                       &= AsynchronousIOStream_Advise(Stream, AccessPattern_WillNeed, 0, 5ULL * 1024 * 1024 * 1024); // Wider than 32 bits
+        TestPassed                       &= AsynchronousIOStream_Advise(Stream, AccessPattern_DontNeed, 0, 0);
+        Test_Fixture_Deinit(&Fixture);
+        free(Written);
+        return TestPassed;
+    }
+
+    /* Whether the page at Offset is in the page cache, -1 if that can't be told */
+    static int PageIsResident(int Descriptor, size_t Offset) {
+        int            Resident    = -1;
+#if PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsLinux)
+        size_t         PageSize    = (size_t) sysconf(_SC_PAGESIZE);
+        void          *Mapping     = mmap(NULL, PageSize, PROT_READ, MAP_SHARED, Descriptor, (off_t) (Offset & ~(PageSize - 1)));
+        unsigned char  Vector      = 0;
+        if (Mapping != MAP_FAILED) {
+            Resident               = mincore(Mapping, PageSize, &Vector) == 0 ? (Vector & 1) : -1;
+            munmap(Mapping, PageSize);
+        }
+#endif /* PlatformIO_TargetOS */
+        return Resident;
+    }
+
+    /* Two sequential reads have to get the detector prefetching ahead of the reader, with the kernel's own readahead turned off */
+    bool Test_SequentialDetector(void) {
+        Test_Fixture          Fixture;
+        if (Test_Fixture_Init(&Fixture, FileMode_Unspecified) == No) {
+            return No;
+        }
+        bool                  TestPassed  = Yes;
+        AsynchronousIOStream *Stream      = Fixture.Stream;
+        size_t                NumBytes    = 1024 * 1024;
+        size_t                Ahead       = 64 * 1024; // Inside the first window, well past anything the reads themselves touch
+        uint8_t              *Written     = calloc(NumBytes, sizeof(uint8_t));
+        uint8_t               Read[4096];
+        Test_Fill(Written, NumBytes);
+        TestPassed                       &= AsynchronousIOStream_WriteAt(Stream, Written, 1, NumBytes, 0) == NumBytes;
+        TestPassed                       &= AsynchronousIOStream_Sync(Stream);
+        AsynchronousIOStream_Advise(Stream, AccessPattern_DontNeed, 0, 0);
+        posix_fadvise(Fixture.Descriptor, 0, 0, POSIX_FADV_RANDOM); // Straight to the descriptor, so only the kernel's readahead is off
+        if (PageIsResident(Fixture.Descriptor, Ahead) != 0) {
+            printf("Test_SequentialDetector: skipped, the page cache under /tmp can't be dropped or inspected\n");
+        } else {
+            AsynchronousIOStream_SetPosition(Stream, 0);
+            TestPassed                   &= AsynchronousIOStream_Read(Stream, Read, 1, sizeof(Read)) == sizeof(Read);
+            TestPassed                   &= AsynchronousIOStream_Read(Stream, Read, 1, sizeof(Read)) == sizeof(Read);
+            TestPassed                   &= memcmp(&Written[sizeof(Read)], Read, sizeof(Read)) == 0;
+            int                Resident   = 0;
+            struct timespec    Pause      = {.tv_sec = 0, .tv_nsec = 10 * 1000 * 1000};
+            for (size_t Try = 0; Try < 200 && Resident == 0; Try++) { // The prefetch isn't waited for
+                Resident                  = PageIsResident(Fixture.Descriptor, Ahead);
+                nanosleep(&Pause, NULL);
+            }
+            TestPassed                   &= Resident == 1;
+        }
+        Test_Fixture_Deinit(&Fixture);
+        free(Written);
+        return TestPassed;
+    }
+
+    /* Thousands of tiny writes through the write-behind buffer have to come out the same as if each had gone straight to the file */
+    bool Test_WriteBehind(void) {
+        Test_Fixture          Fixture;
+        if (Test_Fixture_Init(&Fixture, FileMode_Unspecified) == No) {
+            return No;
+        }
+        bool                  TestPassed  = Yes;
+        AsynchronousIOStream *Stream      = Fixture.Stream;
+        AsynchronousIOStream_SetWriteBehind(Stream, 16384, 0);
+        size_t                NumBytes    = 100000;
+        uint8_t              *Written     = calloc(NumBytes, sizeof(uint8_t));
+        uint8_t              *Read        = calloc(NumBytes, sizeof(uint8_t));
+        Test_Fill(Written, NumBytes);
+        size_t                Offset      = 0;
+        while (Offset < NumBytes) {
+            size_t Record                 = 1 + (Offset % 37) < NumBytes - Offset ? 1 + (Offset % 37) : NumBytes - Offset;
+            TestPassed                   &= AsynchronousIOStream_Write(Stream, &Written[Offset], 1, Record) == Record;
+            Offset                       += Record;
+        }
+        TestPassed                       &= AsynchronousIOStream_Sync(Stream);
+        TestPassed                       &= AsynchronousIOStream_ReadAt(Stream, Read, 1, NumBytes, 0) == NumBytes;
+        TestPassed                       &= memcmp(Written, Read, NumBytes) == 0;
+        Test_Fixture_Deinit(&Fixture);
+        free(Written);
+        free(Read);
+        return TestPassed;
+    }
+
+#define SyncTestThreads 16
+#define SyncTestRecords 100
+
+    typedef struct Test_Sync_Worker {
+        AsynchronousIOStream *Stream;
+        uint8_t              *Written;
+        size_t                NumBytes;
+        size_t                Thread;
+        bool                  Passed;
+    } Test_Sync_Worker;
+
+    /* Thread 0 streams small Writes through the write-behind buffer; the rest each WriteAt a record of their own past its end, then Sync */
+    static void *Test_Sync_Thread(void *Argument) {
+        Test_Sync_Worker *Worker          = (Test_Sync_Worker*) Argument;
+        if (Worker->Thread == 0) {
+            size_t Offset                 = 0;
+            while (Offset < Worker->NumBytes) {
+                size_t Record             = 1 + (Offset % 37) < Worker->NumBytes - Offset ? 1 + (Offset % 37) : Worker->NumBytes - Offset;
+                Worker->Passed           &= AsynchronousIOStream_Write(Worker->Stream, &Worker->Written[Offset], 1, Record) == Record;
+                Offset                   += Record;
+            }
+            Worker->Passed               &= AsynchronousIOStream_Sync(Worker->Stream);
+        } else {
+            for (size_t Record = 0; Record < SyncTestRecords; Record++) {
+                size_t Offset             = Worker->NumBytes + (((Record * (SyncTestThreads - 1)) + (Worker->Thread - 1)) * 64);
+                Worker->Passed           &= AsynchronousIOStream_WriteAt(Worker->Stream, &Worker->Written[Offset], 1, 64, Offset) == 64;
+                Worker->Passed           &= AsynchronousIOStream_Sync(Worker->Stream);
+            }
+        }
+        return NULL;
+    }
+
+    /* Syncs from many threads at once share fdatasyncs while another thread keeps the write-behind buffer busy; nothing can go missing */
+    bool Test_SyncThreads(void) {
+        Test_Fixture          Fixture;
+        if (Test_Fixture_Init(&Fixture, FileMode_Unspecified) == No) {
+            return No;
+        }
+        bool                  TestPassed  = Yes;
+        AsynchronousIOStream *Stream      = Fixture.Stream;
+        AsynchronousIOStream_SetWriteBehind(Stream, 16384, 1);
+        size_t                NumBytes    = 100000;
+        size_t                Total       = NumBytes + (SyncTestThreads - 1) * SyncTestRecords * 64;
+        uint8_t              *Written     = calloc(Total, sizeof(uint8_t));
+        uint8_t              *Read        = calloc(Total, sizeof(uint8_t));
+        Test_Fill(Written, Total);
+        Test_Sync_Worker      Workers[SyncTestThreads];
+        pthread_t             Threads[SyncTestThreads];
+        for (size_t Thread = 0; Thread < SyncTestThreads; Thread++) {
+            Workers[Thread]               = (Test_Sync_Worker) {.Stream = Stream, .Written = Written, .NumBytes = NumBytes, .Thread = Thread, .Passed = Yes};
+            TestPassed                   &= pthread_create(&Threads[Thread], NULL, Test_Sync_Thread, &Workers[Thread]) == 0;
+        }
+        for (size_t Thread = 0; Thread < SyncTestThreads; Thread++) {
+            pthread_join(Threads[Thread], NULL);
+            TestPassed                   &= Workers[Thread].Passed;
+        }
+        TestPassed                       &= AsynchronousIOStream_ReadAt(Stream, Read, 1, Total, 0) == Total;
+        TestPassed                       &= memcmp(Written, Read, Total) == 0;
+        Test_Fixture_Deinit(&Fixture);
+        free(Written);
+        free(Read);
+        return TestPassed;
+    }
+
+#undef SyncTestRecords
+#undef SyncTestThreads
+
+    /* Data older than the flush interval goes out with the next Write, without waiting for the buffer to fill */
+    bool Test_FlushInterval(void) {
+        Test_Fixture          Fixture;
+        if (Test_Fixture_Init(&Fixture, FileMode_Unspecified) == No) {
+            return No;
+        }
+        bool                  TestPassed  = Yes;
+        AsynchronousIOStream *Stream      = Fixture.Stream;
+        AsynchronousIOStream_SetWriteBehind(Stream, 65536, 20);
+        uint8_t               Written[200];
+        uint8_t               Read[200];
+        Test_Fill(Written, sizeof(Written));
+        struct timespec       Pause       = {.tv_sec = 0, .tv_nsec = 30 * 1000 * 1000};
+        TestPassed                       &= AsynchronousIOStream_Write(Stream, Written, 1, 100) == 100;
+        TestPassed                       &= AsynchronousIOStream_ReadAt(Stream, Read, 1, 100, 0) == 0; // Still in the buffer
+        nanosleep(&Pause, NULL);
+        TestPassed                       &= AsynchronousIOStream_Write(Stream, &Written[100], 1, 100) == 100;
+        TestPassed                       &= AsynchronousIOStream_ReadAt(Stream, Read, 1, 200, 0) == 200;
+        TestPassed                       &= memcmp(Written, Read, sizeof(Written)) == 0;
+        Test_Fixture_Deinit(&Fixture);
+        return TestPassed;
+    }
+
     int main(const int argc, const char *argv[]) {
-        bool   TestSuitePassed      = true;
-        return TestSuitePassed;
+        bool   TestSuitePassed      = Test_ReadWrite() & Test_Requests() & Test_Vectors() & Test_ManyVectors() & Test_Direct() & Test_DirectVectors() & Test_Positional() & Test_Advise() & Test_SequentialDetector() & Test_WriteBehind() & Test_SyncThreads() & Test_FlushInterval();
+        return TestSuitePassed == Yes ? EXIT_SUCCESS : EXIT_FAILURE;
     }
 
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
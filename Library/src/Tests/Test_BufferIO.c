@@ -5,6 +5,11 @@
 #include "../../include/MathIO.h"
 #include "../../include/CryptographyIO.h"
 
+#include <pthread.h>                        /* Included for pthread_create, to share a BitBufferPool between threads */
+#include <stdlib.h>                         /* Included for mkstemp */
+#include <string.h>                         /* Included for memcpy and memset, to benchmark against */
+#include <unistd.h>                         /* Included for close, unlink, write */
+
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
 extern "C" {
 #endif
@@ -187,6 +192,835 @@ extern "C" {
         return TestPassed;
     }
     
+#define BenchmarkBufferSize   (1024 * 1024)
+#define BenchmarkNumPasses    8
+
+    /* BitBuffer_ReadBits before the cached engine: per call order dispatch, then a byte at a time loop */
+    static uint64_t Benchmark_ReadBitsLegacy(const uint8_t *Buffer, size_t *BitOffset, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t NumBits) {
+        uint64_t Extracted  = 0ULL;
+        uint8_t  Consumed   = 0;
+        while (Consumed < NumBits) {
+            uint8_t  Available = 8 - (*BitOffset % 8);
+            uint8_t  Bits2Get  = (uint8_t) Minimum(Available, NumBits - Consumed);
+            uint8_t  Mask      = (uint8_t) (Exponentiate(2, Bits2Get) - 1);
+            uint8_t  Byte      = Buffer[*BitOffset / 8];
+            if (ByteOrder == ByteOrder_Right2Left) {
+                if (BitOrder == BitOrder_Right2Left) {
+                    Extracted |= (uint64_t) ((Byte >> (8 - Available)) & Mask) << Consumed;
+                } else if (BitOrder == BitOrder_Left2Right) {
+                    Extracted  = (Extracted << Bits2Get) | ((Byte >> (Available - Bits2Get)) & Mask);
+                }
+            } else if (ByteOrder == ByteOrder_Left2Right) {
+                if (BitOrder == BitOrder_Right2Left) {
+                    Extracted |= (uint64_t) ((Byte >> (8 - Available)) & Mask) << Consumed;
+                } else if (BitOrder == BitOrder_Left2Right) {
+                    Extracted  = (Extracted << Bits2Get) | ((Byte >> (Available - Bits2Get)) & Mask);
+                }
+            }
+            Consumed  += Bits2Get;
+            *BitOffset += Bits2Get;
+        }
+        if (ByteOrder == ByteOrder_Right2Left && BitOrder == BitOrder_Left2Right) { // The first 8 bits read are the least significant byte
+            uint64_t Regrouped = 0ULL;
+            uint8_t  Shift     = 0;
+            uint8_t  Remaining = NumBits;
+            while (Remaining > 0) {
+                uint8_t Group  = (uint8_t) Minimum(8, Remaining);
+                Remaining     -= Group;
+                Regrouped     |= ((Extracted >> Remaining) & (Exponentiate(2, Group) - 1)) << Shift;
+                Shift         += Group;
+            }
+            Extracted          = Regrouped;
+        } else if (ByteOrder == ByteOrder_Left2Right && BitOrder == BitOrder_Right2Left) { // The first 8 bits read are the most significant byte
+            uint64_t Regrouped = 0ULL;
+            uint8_t  Shift     = 0;
+            while (Shift < NumBits) {
+                uint8_t Group  = (uint8_t) Minimum(8, NumBits - Shift);
+                Regrouped      = (Regrouped << Group) | ((Extracted >> Shift) & (Exponentiate(2, Group) - 1));
+                Shift         += Group;
+            }
+            Extracted          = Regrouped;
+        }
+        return Extracted;
+    }
+
+    static double Benchmark_GetBitsPerSecond(uint64_t NumBits, uint64_t ElapsedNanoseconds) {
+        return ElapsedNanoseconds > 0 ? ((double) NumBits * 1000000000.0) / (double) ElapsedNanoseconds : 0.0;
+    }
+
+    bool Benchmark_ReadBits(InsecurePRNG *Insecure) {
+        bool TestPassed                 = Yes;
+        static const BufferIO_ByteOrders ByteOrders[4] = {ByteOrder_Right2Left, ByteOrder_Right2Left, ByteOrder_Left2Right, ByteOrder_Left2Right};
+        static const BufferIO_BitOrders  BitOrders[4]  = {BitOrder_Right2Left,  BitOrder_Left2Right,  BitOrder_Right2Left,  BitOrder_Left2Right};
+        static const char               *OrderNames[4] = {"NearByte_NearBit", "NearByte_FarBit", "FarByte_NearBit", "FarByte_FarBit"};
+
+        BitBuffer *BitB                 = BitBuffer_Init(BenchmarkBufferSize);
+        uint8_t   *Array                = BitBuffer_GetArray(BitB);
+        for (size_t Byte = 0; Byte < BenchmarkBufferSize; Byte++) {
+            Array[Byte]                 = (uint8_t) InsecurePRNG_CreateInteger(Insecure, 8);
+        }
+        BitBuffer_SetArray(BitB, Array, BenchmarkBufferSize);
+
+        uint8_t FieldSizes[64];
+        for (uint8_t Field = 0; Field < 64; Field++) {
+            FieldSizes[Field]           = (uint8_t) (InsecurePRNG_CreateInteger(Insecure, 5) + 1); // 1 to 32 bits, like a codec's header and residual fields
+        }
+
+        for (uint8_t Order = 0; Order < 4; Order++) {
+            uint64_t LegacySum          = 0ULL;
+            uint64_t EngineSum          = 0ULL;
+            uint64_t NumBitsRead        = 0ULL;
+            uint64_t LegacyTime         = 0ULL;
+            uint64_t EngineTime         = 0ULL;
+            for (uint8_t Pass = 0; Pass < BenchmarkNumPasses; Pass++) {
+                size_t   LegacyOffset   = 0;
+                uint8_t  Field          = 0;
+                uint64_t Start          = GetTime_Elapsed();
+                while (LegacyOffset + 64 < Bytes2Bits(BenchmarkBufferSize)) {
+                    LegacySum          += Benchmark_ReadBitsLegacy(Array, &LegacyOffset, ByteOrders[Order], BitOrders[Order], FieldSizes[Field % 64]);
+                    Field              += 1;
+                }
+                LegacyTime             += GetTime_Elapsed() - Start;
+
+                BitBuffer_SetPosition(BitB, 0);
+                Field                   = 0;
+                Start                   = GetTime_Elapsed();
+                while (BitBuffer_GetPosition(BitB) + 64 < Bytes2Bits(BenchmarkBufferSize)) {
+                    EngineSum          += BitBuffer_ReadBits(BitB, ByteOrders[Order], BitOrders[Order], FieldSizes[Field % 64]);
+                    Field              += 1;
+                }
+                EngineTime             += GetTime_Elapsed() - Start;
+                NumBitsRead            += LegacyOffset;
+            }
+            printf("%s: Legacy %.0f bits/second, Engine %.0f bits/second (%.2fx)\n", OrderNames[Order],
+                   Benchmark_GetBitsPerSecond(NumBitsRead, LegacyTime),
+                   Benchmark_GetBitsPerSecond(NumBitsRead, EngineTime),
+                   EngineTime > 0 ? (double) LegacyTime / (double) EngineTime : 0.0);
+            TestPassed                 &= LegacySum == EngineSum;
+        }
+        BitBuffer_Deinit(BitB);
+        return TestPassed;
+    }
+
+#undef BenchmarkBufferSize
+#undef BenchmarkNumPasses
+
+#define ArrayNumFields 1024
+
+    /* Writes Fields with the Width bit WriteBitsArray at Start, then reads them back one at a time and in bulk; the last fields are within 8 bytes of the end, so the tail takes the scalar path */
+    static bool Test_BitsArrayRoundTrip(uint8_t Width, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, uint8_t FieldSize, size_t Start, const uint64_t *Fields) {
+        bool       TestPassed               = Yes;
+        size_t     NumBits                  = Start + (ArrayNumFields * FieldSize);
+        size_t     NumBytes                 = Bits2Bytes(RoundingType_Up, NumBits);
+        NumBytes                           += (8 - (NumBytes % 8)) % 8; // BitBuffer_Init takes whole 8 byte words
+        BitBuffer *BitB                     = BitBuffer_Init(NumBytes);
+        uint16_t  *Array16                  = calloc(ArrayNumFields, sizeof(uint16_t));
+        uint32_t  *Array32                  = calloc(ArrayNumFields, sizeof(uint32_t));
+        uint64_t  *Array64                  = calloc(ArrayNumFields, sizeof(uint64_t));
+        for (size_t Field = 0; Field < ArrayNumFields; Field++) {
+            Array16[Field]                  = (uint16_t) Fields[Field];
+            Array32[Field]                  = (uint32_t) Fields[Field];
+            Array64[Field]                  = Fields[Field];
+        }
+        BitBuffer_SetPosition(BitB, Start);
+        if (Width == 16) {
+            BitBuffer_WriteBitsArray16(BitB, ByteOrder, BitOrder, FieldSize, Array16, ArrayNumFields);
+        } else if (Width == 32) {
+            BitBuffer_WriteBitsArray32(BitB, ByteOrder, BitOrder, FieldSize, Array32, ArrayNumFields);
+        } else {
+            BitBuffer_WriteBitsArray64(BitB, ByteOrder, BitOrder, FieldSize, Array64, ArrayNumFields);
+        }
+        TestPassed                         &= BitBuffer_GetPosition(BitB) == NumBits;
+        BitBuffer_SetPosition(BitB, Start);
+        for (size_t Field = 0; Field < ArrayNumFields; Field++) {
+            if (BitBuffer_ReadBits(BitB, ByteOrder, BitOrder, FieldSize) != Fields[Field]) {
+                TestPassed                  = No;
+            }
+        }
+        memset(Array16, 0, ArrayNumFields * sizeof(uint16_t));
+        memset(Array32, 0, ArrayNumFields * sizeof(uint32_t));
+        memset(Array64, 0, ArrayNumFields * sizeof(uint64_t));
+        BitBuffer_SetPosition(BitB, Start);
+        if (Width == 16) {
+            BitBuffer_ReadBitsArray16(BitB, ByteOrder, BitOrder, FieldSize, Array16, ArrayNumFields);
+        } else if (Width == 32) {
+            BitBuffer_ReadBitsArray32(BitB, ByteOrder, BitOrder, FieldSize, Array32, ArrayNumFields);
+        } else {
+            BitBuffer_ReadBitsArray64(BitB, ByteOrder, BitOrder, FieldSize, Array64, ArrayNumFields);
+        }
+        TestPassed                         &= BitBuffer_GetPosition(BitB) == NumBits;
+        for (size_t Field = 0; Field < ArrayNumFields; Field++) {
+            uint64_t Read                   = Width == 16 ? Array16[Field] : Width == 32 ? Array32[Field] : Array64[Field];
+            if (Read != Fields[Field]) {
+                TestPassed                  = No;
+            }
+        }
+        BitBuffer_Deinit(BitB);
+        free(Array16);
+        free(Array32);
+        free(Array64);
+        return TestPassed;
+    }
+
+    /* Every width, order and field size, from byte aligned starts that reach the SIMD kernels and unaligned ones that don't */
+    bool Test_ReadWriteBitsArray(InsecurePRNG *Insecure) {
+        bool TestPassed                     = Yes;
+        static const uint8_t Widths[3]      = {16, 32, 64};
+        static const uint8_t FieldSizes[3][10] = {
+            {1, 5, 7, 8, 9, 12, 13, 15, 16, 0},
+            {1, 7, 8, 12, 16, 20, 24, 25, 31, 32},
+            {1, 8, 17, 32, 33, 48, 56, 57, 63, 64},
+        };
+        static const size_t  Starts[4]      = {0, 3, 8, 13};
+        uint64_t  *Fields                   = calloc(ArrayNumFields, sizeof(uint64_t));
+        for (uint8_t Width = 0; Width < 3; Width++) {
+            for (uint8_t ByteOrder = ByteOrder_Right2Left; ByteOrder <= ByteOrder_Left2Right; ByteOrder++) {
+                for (uint8_t BitOrder = BitOrder_Right2Left; BitOrder <= BitOrder_Left2Right; BitOrder++) {
+                    for (uint8_t Size = 0; Size < 10 && FieldSizes[Width][Size] > 0; Size++) {
+                        uint8_t FieldSize   = FieldSizes[Width][Size];
+                        for (uint8_t Start = 0; Start < 4; Start++) {
+                            for (size_t Field = 0; Field < ArrayNumFields; Field++) {
+                                Fields[Field] = InsecurePRNG_CreateInteger(Insecure, FieldSize);
+                            }
+                            TestPassed     &= Test_BitsArrayRoundTrip(Widths[Width], ByteOrder, BitOrder, FieldSize, Starts[Start], Fields);
+                        }
+                    }
+                }
+            }
+        }
+        free(Fields);
+        return TestPassed;
+    }
+
+#undef ArrayNumFields
+
+#define CodeBufferSize 256
+#define CodeMaxValues  2048
+
+    typedef enum CodeKinds {
+        CodeKind_Unary     = 0,
+        CodeKind_RICE      = 1,
+        CodeKind_ExpGolomb = 2,
+    } CodeKinds;
+
+    static uint64_t Test_CodeSizeInBits(CodeKinds Kind, uint8_t Parameter, uint64_t Value) {
+        if (Kind == CodeKind_Unary) {
+            return Value + 1;
+        } else if (Kind == CodeKind_RICE) {
+            return (Value >> Parameter) + 1 + Parameter;
+        }
+        uint64_t Offset                     = Value + (1ULL << Parameter);
+        uint8_t  Suffix                     = 0;
+        while ((Offset >> (Suffix + 1)) != 0) {
+            Suffix                         += 1;
+        }
+        return (Suffix - Parameter) + 1 + Suffix;
+    }
+
+    /*
+     Fills the array from Start with one kind of code until the next one wouldn't fit, so runs cross bytes and Caches,
+     then shrinks the BitBuffer so the last code ends exactly at NumBits and reads everything back.
+     */
+    static bool Test_CodesRoundTrip(InsecurePRNG *Insecure, BufferIO_ByteOrders ByteOrder, BufferIO_BitOrders BitOrder, BufferIO_UnaryTerminators Terminator, CodeKinds Kind, size_t Start) {
+        bool       TestPassed               = Yes;
+        BitBuffer *BitB                     = BitBuffer_Init(CodeBufferSize);
+        uint64_t  *Values                   = calloc(CodeMaxValues, sizeof(uint64_t));
+        uint32_t  *Decoded                  = calloc(CodeMaxValues, sizeof(uint32_t));
+        uint8_t    Parameter                = Kind == CodeKind_RICE ? (uint8_t) InsecurePRNG_CreateInteger(Insecure, 3) : Kind == CodeKind_ExpGolomb ? (uint8_t) InsecurePRNG_CreateInteger(Insecure, 2) : 0;
+        size_t     NumValues                = 0;
+        BitBuffer_SetPosition(BitB, Start);
+        for (;;) {
+            uint64_t Value                  = InsecurePRNG_CreateInteger(Insecure, Kind == CodeKind_Unary ? 7 : 9);
+            if (Kind == CodeKind_Unary && NumValues % 2 == 1) {
+                Value                      += 1; // Odd values are written as UnaryType_Natural
+            }
+            if (BitBuffer_GetPosition(BitB) + Test_CodeSizeInBits(Kind, Parameter, Value) > Bytes2Bits(CodeBufferSize)) {
+                break;
+            }
+            if (Kind == CodeKind_Unary) {
+                BitBuffer_WriteUnary(BitB, ByteOrder, BitOrder, NumValues % 2 == 1 ? UnaryType_Natural : UnaryType_Whole, Terminator, Value);
+            } else if (Kind == CodeKind_RICE) {
+                BitBuffer_WriteRICE(BitB, ByteOrder, BitOrder, Terminator, Parameter, Value);
+            } else {
+                BitBuffer_WriteExpGolomb(BitB, ByteOrder, BitOrder, Parameter, Value);
+            }
+            Values[NumValues]               = Value;
+            NumValues                      += 1;
+        }
+        size_t     End                      = BitBuffer_GetPosition(BitB);
+        BitBuffer_SetSize(BitB, End); // The last code ends at NumBits, whatever follows it in the array isn't a stop bit
+        BitBuffer_SetPosition(BitB, Start);
+        for (size_t Value = 0; Value < NumValues; Value++) {
+            uint64_t Read                   = 0;
+            if (Kind == CodeKind_Unary) {
+                Read                        = BitBuffer_ReadUnary(BitB, ByteOrder, BitOrder, Value % 2 == 1 ? UnaryType_Natural : UnaryType_Whole, Terminator);
+            } else if (Kind == CodeKind_RICE) {
+                Read                        = BitBuffer_ReadRICE(BitB, ByteOrder, BitOrder, Terminator, Parameter);
+            } else {
+                Read                        = BitBuffer_ReadExpGolomb(BitB, ByteOrder, BitOrder, Parameter);
+            }
+            TestPassed                     &= Read == Values[Value];
+        }
+        TestPassed                         &= BitBuffer_GetPosition(BitB) == End;
+        if (Kind == CodeKind_RICE) {
+            BitBuffer_SetPosition(BitB, Start);
+            BitBuffer_ReadRICEArray(BitB, ByteOrder, BitOrder, Terminator, Parameter, Decoded, NumValues);
+            for (size_t Value = 0; Value < NumValues; Value++) {
+                TestPassed                 &= Decoded[Value] == Values[Value];
+            }
+            TestPassed                     &= BitBuffer_GetPosition(BitB) == End;
+        }
+        BitBuffer_Deinit(BitB);
+        free(Values);
+        free(Decoded);
+        return TestPassed;
+    }
+
+    /* Unary, RICE and Exp-Golomb codes in every order, then a run that reaches NumBits without its stop bit */
+    bool Test_ReadWriteCodes(InsecurePRNG *Insecure) {
+        bool TestPassed                     = Yes;
+        static const size_t Starts[3]       = {0, 5, 13};
+        for (uint8_t ByteOrder = ByteOrder_Right2Left; ByteOrder <= ByteOrder_Left2Right; ByteOrder++) {
+            for (uint8_t BitOrder = BitOrder_Right2Left; BitOrder <= BitOrder_Left2Right; BitOrder++) {
+                for (uint8_t Terminator = UnaryTerminator_Zero; Terminator <= UnaryTerminator_One; Terminator++) {
+                    for (uint8_t Kind = CodeKind_Unary; Kind <= CodeKind_ExpGolomb; Kind++) {
+                        for (uint8_t Start = 0; Start < 3; Start++) {
+                            TestPassed     &= Test_CodesRoundTrip(Insecure, ByteOrder, BitOrder, Terminator, Kind, Starts[Start]);
+                        }
+                    }
+                }
+
+                BitBuffer *Ones             = BitBuffer_Init(16);
+                BufferIO_MemorySet8(BitBuffer_GetArray(Ones), 0xFF, 16);
+                BitBuffer_SetSize(Ones, 100); // The array keeps going, and past it the window is zeros
+                BitBuffer_SetPosition(Ones, 3);
+                TestPassed                 &= BitBuffer_ReadUnary(Ones, ByteOrder, BitOrder, UnaryType_Whole, UnaryTerminator_Zero) == 97;
+                TestPassed                 &= BitBuffer_GetPosition(Ones) == 100;
+                BitBuffer_Deinit(Ones);
+            }
+        }
+        return TestPassed;
+    }
+
+#undef CodeMaxValues
+#undef CodeBufferSize
+
+#define CRCBufferSize 4096
+
+    static uint32_t BitwiseCRC32(const uint8_t *Bytes, size_t NumBytes, BufferIO_CRCPolynomials Polynomial) {
+        uint32_t State = 0xFFFFFFFF;
+        for (size_t Byte = 0; Byte < NumBytes; Byte++) {
+            State     ^= Bytes[Byte];
+            for (uint8_t Bit = 0; Bit < 8; Bit++) {
+                State  = (State & 1) ? (State >> 1) ^ (uint32_t) Polynomial : State >> 1;
+            }
+        }
+        return ~State;
+    }
+
+    /* Checks the published check values, then compares the sliced/folded CRCs against a bitwise one at every length */
+    bool Test_CalculateCRC(InsecurePRNG *Insecure) {
+        bool TestPassed                     = Yes;
+        static const uint8_t CheckString[9] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+        BitBuffer *Check                    = BitBuffer_Init(16);
+        BitBuffer *BitB                     = BitBuffer_Init(CRCBufferSize);
+        for (uint8_t Byte = 0; Byte < sizeof(CheckString); Byte++) {
+            BitBuffer_WriteBits(Check, ByteOrder_Right2Left, BitOrder_Right2Left, 8, CheckString[Byte]);
+        }
+        if (BitBuffer_CalculateCRC(Check, 0, sizeof(CheckString), 0xFFFFFFFF, CRCPolynomial_IEEE802_3) != 0xCBF43926) {
+            TestPassed                      = No;
+        }
+        if (BitBuffer_CalculateCRC(Check, 0, sizeof(CheckString), 0xFFFFFFFF, CRCPolynomial_Castagnoli) != 0xE3069283) {
+            TestPassed                      = No;
+        }
+
+        uint8_t *Bytes                      = calloc(CRCBufferSize, sizeof(uint8_t));
+        for (size_t Byte = 0; Byte < CRCBufferSize; Byte++) {
+            Bytes[Byte]                     = InsecurePRNG_CreateInteger(Insecure, 8);
+            BitBuffer_WriteBits(BitB, ByteOrder_Right2Left, BitOrder_Right2Left, 8, Bytes[Byte]);
+        }
+        for (size_t NumBytes = 1; NumBytes < CRCBufferSize; NumBytes += 1 + NumBytes / 8) {
+            size_t Offset                   = InsecurePRNG_CreateInteger(Insecure, 3);
+            if (Offset + NumBytes > CRCBufferSize) {
+                break;
+            }
+            for (uint8_t Polynomial = 0; Polynomial < 2; Polynomial++) {
+                BufferIO_CRCPolynomials Poly = Polynomial == 0 ? CRCPolynomial_IEEE802_3 : CRCPolynomial_Castagnoli;
+                uint32_t Expected           = BitwiseCRC32(&Bytes[Offset], NumBytes, Poly);
+                BufferIO_CRC32 Running;
+                BufferIO_CRC32_Init(&Running, Poly, 0xFFFFFFFF);
+                BitBuffer_UpdateCRC(BitB, &Running, Bytes2Bits(Offset), NumBytes / 3);
+                BitBuffer_UpdateCRC(BitB, &Running, Bytes2Bits(Offset + NumBytes / 3), NumBytes - NumBytes / 3);
+                if (BitBuffer_CalculateCRC(BitB, Bytes2Bits(Offset), NumBytes, 0xFFFFFFFF, Poly) != Expected || BufferIO_CRC32_Final(&Running) != Expected) {
+                    TestPassed              = No;
+                }
+            }
+        }
+        BitBuffer_Deinit(Check);
+        BitBuffer_Deinit(BitB);
+        free(Bytes);
+        return TestPassed;
+    }
+
+#undef CRCBufferSize
+
+#define Adler32BufferSize 16384
+
+    /* Checks a known Adler32, then compares the block/vector sums, the running version, and Combine against a per byte one */
+    bool Test_CalculateAdler32(InsecurePRNG *Insecure) {
+        bool TestPassed                     = Yes;
+        static const uint8_t Wikipedia[9]   = {'W', 'i', 'k', 'i', 'p', 'e', 'd', 'i', 'a'};
+        BufferIO_Adler32 Known;
+        BufferIO_Adler32_Init(&Known);
+        BufferIO_Adler32_Update(&Known, Wikipedia, sizeof(Wikipedia));
+        if (BufferIO_Adler32_Final(&Known) != 0x11E60398) {
+            TestPassed                      = No;
+        }
+
+        BitBuffer *BitB                     = BitBuffer_Init(Adler32BufferSize);
+        uint8_t   *Bytes                    = calloc(Adler32BufferSize, sizeof(uint8_t));
+        for (size_t Byte = 0; Byte < Adler32BufferSize; Byte++) {
+            Bytes[Byte]                     = InsecurePRNG_CreateInteger(Insecure, 8);
+            BitBuffer_WriteBits(BitB, ByteOrder_Right2Left, BitOrder_Right2Left, 8, Bytes[Byte]);
+        }
+        for (size_t NumBytes = 1; NumBytes < Adler32BufferSize; NumBytes += 1 + NumBytes / 8) {
+            size_t   Offset                 = InsecurePRNG_CreateInteger(Insecure, 3);
+            size_t   Split                  = NumBytes / 3;
+            uint32_t A                      = 1;
+            uint32_t B                      = 0;
+            if (Offset + NumBytes > Adler32BufferSize) {
+                break;
+            }
+            for (size_t Byte = Offset; Byte < Offset + NumBytes; Byte++) {
+                A                           = (A + Bytes[Byte]) % 65521;
+                B                           = (B + A) % 65521;
+            }
+            uint32_t Expected               = (B << 16) | A;
+            BufferIO_Adler32 First;
+            BufferIO_Adler32 Second;
+            BufferIO_Adler32_Init(&First);
+            BufferIO_Adler32_Init(&Second);
+            BitBuffer_UpdateAdler32(BitB, &First, Bytes2Bits(Offset), Split);
+            BitBuffer_UpdateAdler32(BitB, &Second, Bytes2Bits(Offset + Split), NumBytes - Split);
+            uint32_t Combined               = BufferIO_Adler32_Combine(BufferIO_Adler32_Final(&First), BufferIO_Adler32_Final(&Second), NumBytes - Split);
+            BitBuffer_UpdateAdler32(BitB, &First, Bytes2Bits(Offset + Split), NumBytes - Split);
+            if (BitBuffer_CalculateAdler32(BitB, Bytes2Bits(Offset), NumBytes) != Expected || BufferIO_Adler32_Final(&First) != Expected || Combined != Expected) {
+                TestPassed                  = No;
+            }
+        }
+        BitBuffer_Deinit(BitB);
+        free(Bytes);
+        return TestPassed;
+    }
+
+#undef Adler32BufferSize
+
+#define MemoryTestBufferSize 8192
+
+    /*
+     MemoryCopy16/32/64 and MemorySet16/32/64 with element counts that leave a partial vector,
+     and arrays that start anywhere in a vector, including off their element's alignment, against memcpy;
+     the bytes around the array have to come through untouched.
+     */
+    bool Test_MemoryCopySet(InsecurePRNG *Insecure) {
+        bool     TestPassed                 = Yes;
+        uint8_t *Source                     = malloc(MemoryTestBufferSize);
+        uint8_t *Destination                = malloc(MemoryTestBufferSize);
+        uint8_t *Expected                   = malloc(MemoryTestBufferSize);
+        for (size_t Byte = 0; Byte < MemoryTestBufferSize; Byte++) {
+            Source[Byte]                    = (uint8_t) InsecurePRNG_CreateInteger(Insecure, 8);
+        }
+        for (uint16_t Iteration = 0; Iteration < 3072; Iteration++) {
+            uint8_t  ElementSize            = (uint8_t) (2 << (Iteration % 3)); // 2, 4, 8
+            size_t   NumElements            = 1 + InsecurePRNG_CreateInteger(Insecure, Iteration % 4 == 0 ? 9 : 5);
+            size_t   NumBytes               = NumElements * ElementSize;
+            size_t   SourceOffset           = InsecurePRNG_CreateInteger(Insecure, 6);
+            size_t   DestinationOffset      = InsecurePRNG_CreateInteger(Insecure, 6);
+            uint64_t Value                  = InsecurePRNG_CreateInteger(Insecure, 64);
+            BufferIO_SetNonTemporalThreshold(Iteration % 8 == 0 ? 256 : 4 * 1024 * 1024); // Reach the streaming stores too
+
+            memset(Destination, 0xA5, MemoryTestBufferSize);
+            memset(Expected, 0xA5, MemoryTestBufferSize);
+            memcpy(&Expected[DestinationOffset], &Source[SourceOffset], NumBytes);
+            if (ElementSize == 2) {
+                BufferIO_MemoryCopy16((uint16_t *) &Destination[DestinationOffset], (const uint16_t *) &Source[SourceOffset], NumElements);
+            } else if (ElementSize == 4) {
+                BufferIO_MemoryCopy32((uint32_t *) &Destination[DestinationOffset], (const uint32_t *) &Source[SourceOffset], NumElements);
+            } else {
+                BufferIO_MemoryCopy64((uint64_t *) &Destination[DestinationOffset], (const uint64_t *) &Source[SourceOffset], NumElements);
+            }
+            TestPassed                     &= memcmp(Destination, Expected, MemoryTestBufferSize) == 0;
+
+            memset(Destination, 0xA5, MemoryTestBufferSize);
+            memset(Expected, 0xA5, MemoryTestBufferSize);
+            for (size_t Element = 0; Element < NumElements; Element++) {
+                uint16_t Value16            = (uint16_t) Value;
+                uint32_t Value32            = (uint32_t) Value;
+                memcpy(&Expected[DestinationOffset + (Element * ElementSize)], ElementSize == 2 ? (void *) &Value16 : ElementSize == 4 ? (void *) &Value32 : (void *) &Value, ElementSize);
+            }
+            if (ElementSize == 2) {
+                BufferIO_MemorySet16((uint16_t *) &Destination[DestinationOffset], (uint16_t) Value, NumElements);
+            } else if (ElementSize == 4) {
+                BufferIO_MemorySet32((uint32_t *) &Destination[DestinationOffset], (uint32_t) Value, NumElements);
+            } else {
+                BufferIO_MemorySet64((uint64_t *) &Destination[DestinationOffset], Value, NumElements);
+            }
+            TestPassed                     &= memcmp(Destination, Expected, MemoryTestBufferSize) == 0;
+        }
+        BufferIO_SetNonTemporalThreshold(4 * 1024 * 1024);
+        free(Source);
+        free(Destination);
+        free(Expected);
+        return TestPassed;
+    }
+
+#undef MemoryTestBufferSize
+
+#define MemoryBenchmarkMinSize 16
+#define MemoryBenchmarkMaxSize (64 * 1024 * 1024)
+#define MemoryBenchmarkBytes   (256 * 1024 * 1024) // Bytes moved per size, so small sizes run enough iterations to time
+
+    /* Times MemoryCopy8/MemorySet8 against libc from 16B to 64MB, quadrupling, and checks they produced the same bytes; main only runs it with --benchmark */
+    bool Benchmark_MemoryCopySet(InsecurePRNG *Insecure) {
+        bool     TestPassed                 = Yes;
+        uint8_t *Source                     = malloc(MemoryBenchmarkMaxSize);
+        uint8_t *Destination                = malloc(MemoryBenchmarkMaxSize);
+        uint8_t *Expected                   = malloc(MemoryBenchmarkMaxSize);
+        for (size_t Byte = 0; Byte < MemoryBenchmarkMaxSize; Byte += 8) {
+            uint64_t Random                 = InsecurePRNG_CreateInteger(Insecure, 64);
+            memcpy(&Source[Byte], &Random, sizeof(Random));
+        }
+        for (size_t Size = MemoryBenchmarkMinSize; Size <= MemoryBenchmarkMaxSize; Size *= 4) {
+            size_t   NumIterations          = MemoryBenchmarkBytes / Size;
+            uint64_t Start                  = GetTime_Elapsed();
+            for (size_t Iteration = 0; Iteration < NumIterations; Iteration++) {
+                memcpy(Expected, Source, Size);
+            }
+            uint64_t LibCCopyTime           = GetTime_Elapsed() - Start;
+            Start                           = GetTime_Elapsed();
+            for (size_t Iteration = 0; Iteration < NumIterations; Iteration++) {
+                BufferIO_MemoryCopy8(Destination, Source, Size);
+            }
+            uint64_t CopyTime               = GetTime_Elapsed() - Start;
+            TestPassed                     &= memcmp(Destination, Expected, Size) == 0;
+
+            Start                           = GetTime_Elapsed();
+            for (size_t Iteration = 0; Iteration < NumIterations; Iteration++) {
+                memset(Expected, (int) (Iteration & 0xFF), Size);
+            }
+            uint64_t LibCSetTime            = GetTime_Elapsed() - Start;
+            Start                           = GetTime_Elapsed();
+            for (size_t Iteration = 0; Iteration < NumIterations; Iteration++) {
+                BufferIO_MemorySet8(Destination, (uint8_t) (Iteration & 0xFF), Size);
+            }
+            uint64_t SetTime                = GetTime_Elapsed() - Start;
+            TestPassed                     &= memcmp(Destination, Expected, Size) == 0;
+
+            printf("%zu bytes: memcpy %.2f GB/s, MemoryCopy8 %.2f GB/s, memset %.2f GB/s, MemorySet8 %.2f GB/s\n", Size,
+                   LibCCopyTime > 0 ? (double) MemoryBenchmarkBytes / (double) LibCCopyTime : 0.0,
+                   CopyTime     > 0 ? (double) MemoryBenchmarkBytes / (double) CopyTime     : 0.0,
+                   LibCSetTime  > 0 ? (double) MemoryBenchmarkBytes / (double) LibCSetTime  : 0.0,
+                   SetTime      > 0 ? (double) MemoryBenchmarkBytes / (double) SetTime      : 0.0);
+        }
+        free(Source);
+        free(Destination);
+        free(Expected);
+        return TestPassed;
+    }
+
+#undef MemoryBenchmarkMinSize
+#undef MemoryBenchmarkMaxSize
+#undef MemoryBenchmarkBytes
+
+#define MoveBufferSize 4096
+
+    /* Moves overlapping ranges both ways against memmove, then compacts a partly read BitBuffer */
+    bool Test_MemoryMoveCompact(InsecurePRNG *Insecure) {
+        bool     TestPassed                 = Yes;
+        uint8_t *Moved                      = malloc(MoveBufferSize);
+        uint8_t *Expected                   = malloc(MoveBufferSize);
+        for (uint16_t Iteration = 0; Iteration < 1024; Iteration++) {
+            size_t NumBytes                 = 1 + InsecurePRNG_CreateInteger(Insecure, 11);
+            size_t Source                   = InsecurePRNG_CreateInteger(Insecure, 10);
+            size_t Destination              = InsecurePRNG_CreateInteger(Insecure, 10);
+            for (size_t Byte = 0; Byte < MoveBufferSize; Byte++) {
+                Moved[Byte]                 = (uint8_t) (Byte * 7 + Iteration);
+                Expected[Byte]              = Moved[Byte];
+            }
+            BufferIO_MemoryMove8(&Moved[Destination], &Moved[Source], NumBytes);
+            memmove(&Expected[Destination], &Expected[Source], NumBytes);
+            TestPassed                     &= memcmp(Moved, Expected, MoveBufferSize) == 0;
+        }
+
+        BitBuffer *BitB                     = BitBuffer_Init(MoveBufferSize);
+        for (size_t Byte = 0; Byte < MoveBufferSize; Byte++) {
+            BitBuffer_WriteBits(BitB, ByteOrder_Right2Left, BitOrder_Right2Left, 8, (uint8_t) (Byte * 7));
+        }
+        size_t ReadBytes                    = 1 + InsecurePRNG_CreateInteger(Insecure, 11);
+        BitBuffer_SetPosition(BitB, Bytes2Bits(ReadBytes) + 3);
+        TestPassed                         &= BitBuffer_Compact(BitB) == ReadBytes;
+        TestPassed                         &= BitBuffer_GetPosition(BitB) == 3;
+        TestPassed                         &= BitBuffer_GetSize(BitB) == Bytes2Bits(MoveBufferSize - ReadBytes);
+        TestPassed                         &= BitBuffer_GetArray(BitB)[0] == (uint8_t) (ReadBytes * 7);
+        BitBuffer_Deinit(BitB);
+        free(Moved);
+        free(Expected);
+        return TestPassed;
+    }
+
+#undef MoveBufferSize
+
+    /* Released BitBuffers come back for the same size class, zeroed only when the pool asks for it */
+    bool Test_BitBufferPool(InsecurePRNG *Insecure) {
+        bool           TestPassed           = Yes;
+        BitBufferPool *Reused               = BitBufferPool_Init(BitBufferPoolOption_ThreadCaches);
+        BitBufferPool *Zeroed               = BitBufferPool_Init(BitBufferPoolOption_ZeroOnAcquire);
+        for (uint8_t Iteration = 0; Iteration < 64; Iteration++) {
+            size_t     Size                 = 8 * (1 + InsecurePRNG_CreateInteger(Insecure, 10));
+            BitBuffer *First                = BitBufferPool_Acquire(Reused, Size);
+            BufferIO_MemorySet8(BitBuffer_GetArray(First), 0xA5, Size);
+            BitBufferPool_Release(Reused, First);
+            BitBuffer *Second               = BitBufferPool_Acquire(Reused, Size);
+            TestPassed                     &= Second == First;
+            TestPassed                     &= BitBuffer_GetSize(Second) == Bytes2Bits(Size);
+            TestPassed                     &= BitBuffer_GetPosition(Second) == 0;
+            BitBuffer_Resize(Second, Size * 3); // Grows past the class, it's released into a larger one
+            TestPassed                     &= BitBuffer_GetArray(Second)[Size - 1] == 0xA5;
+            BitBufferPool_Release(Reused, Second);
+
+            BitBuffer *Dirty                = BitBufferPool_Acquire(Zeroed, Size);
+            BufferIO_MemorySet8(BitBuffer_GetArray(Dirty), 0xA5, Size);
+            BitBufferPool_Release(Zeroed, Dirty);
+            BitBuffer *Clean                = BitBufferPool_Acquire(Zeroed, Size);
+            for (size_t Byte = 0; Byte < Size; Byte++) {
+                TestPassed                 &= BitBuffer_GetArray(Clean)[Byte] == 0;
+            }
+            BitBufferPool_Release(Zeroed, Clean);
+        }
+
+        BitBuffer *Empty                    = BitBufferPool_Acquire(Reused, 0);
+        TestPassed                         &= Empty != NULL && BitBuffer_GetSize(Empty) == 0;
+        BitBufferPool_Release(Reused, Empty);
+
+        BitBuffer *Unpooled                 = BitBuffer_Init(104); // Its capacity isn't a power of two
+        BitBuffer_Resize(Unpooled, 136); // Rounds up to 256, not 208
+        BitBufferPool_Release(Reused, Unpooled);
+        BitBuffer *Rounded                  = BitBufferPool_Acquire(Reused, 256);
+        TestPassed                         &= Rounded == Unpooled;
+        BitBufferPool_Release(Reused, Rounded);
+
+        BitBufferPool_FlushThreadCache(Reused);
+        BitBufferPool_Deinit(Reused);
+        BitBufferPool_Deinit(Zeroed);
+        return TestPassed;
+    }
+    
+#define PoolTestThreads 4
+#define PoolTestHeld    8
+
+    typedef struct Test_BitBufferPool_Worker {
+        BitBufferPool *Pools[2];
+        uint8_t        Tag;
+        bool           Passed;
+    } Test_BitBufferPool_Worker;
+
+    /* Holds a few BitBuffers from two pools at once, each filled with the thread's tag, so one handed to two threads at once shows up */
+    static void *Test_BitBufferPool_Thread(void *Argument) {
+        Test_BitBufferPool_Worker *Worker   = (Test_BitBufferPool_Worker*) Argument;
+        BitBuffer                 *Held[PoolTestHeld] = {NULL};
+        for (uint32_t Iteration = 0; Iteration < 8192; Iteration++) {
+            uint8_t        Slot             = Iteration % PoolTestHeld;
+            BitBufferPool *Pool             = Worker->Pools[Slot % 2];
+            if (Held[Slot] != NULL) {
+                size_t     Size             = Bits2Bytes(RoundingType_Down, BitBuffer_GetSize(Held[Slot]));
+                for (size_t Byte = 0; Byte < Size; Byte++) {
+                    Worker->Passed         &= BitBuffer_GetArray(Held[Slot])[Byte] == Worker->Tag;
+                }
+                BitBufferPool_Release(Pool, Held[Slot]);
+            }
+            size_t         Size             = 8 * (1 + (Iteration * 7 + Worker->Tag) % 32);
+            Held[Slot]                      = BitBufferPool_Acquire(Pool, Size);
+            BufferIO_MemorySet8(BitBuffer_GetArray(Held[Slot]), Worker->Tag, Size);
+        }
+        for (uint8_t Slot = 0; Slot < PoolTestHeld; Slot++) {
+            BitBufferPool_Release(Worker->Pools[Slot % 2], Held[Slot]);
+        }
+        BitBufferPool_FlushThreadCache(Worker->Pools[0]);
+        BitBufferPool_FlushThreadCache(Worker->Pools[1]);
+        return NULL;
+    }
+
+    /* Every thread caches for both pools, and takes the pools' locks when its caches are empty or full */
+    bool Test_BitBufferPoolThreads(void) {
+        bool                      TestPassed = Yes;
+        BitBufferPool            *Pools[2]   = {BitBufferPool_Init(BitBufferPoolOption_ThreadCaches), BitBufferPool_Init(BitBufferPoolOption_ThreadCaches)};
+        Test_BitBufferPool_Worker Workers[PoolTestThreads];
+        pthread_t                 Threads[PoolTestThreads];
+        for (uint8_t Thread = 0; Thread < PoolTestThreads; Thread++) {
+            Workers[Thread]                 = (Test_BitBufferPool_Worker) {.Pools = {Pools[0], Pools[1]}, .Tag = (uint8_t) (0xA0 + Thread), .Passed = Yes};
+            TestPassed                     &= pthread_create(&Threads[Thread], NULL, Test_BitBufferPool_Thread, &Workers[Thread]) == 0;
+        }
+        for (uint8_t Thread = 0; Thread < PoolTestThreads; Thread++) {
+            pthread_join(Threads[Thread], NULL);
+            TestPassed                     &= Workers[Thread].Passed;
+        }
+        BitBufferPool_Deinit(Pools[0]);
+        BitBufferPool_Deinit(Pools[1]);
+        return TestPassed;
+    }
+
+#undef PoolTestHeld
+#undef PoolTestThreads
+
+#define MappedFileSize 70000 // Spans pages, and isn't a multiple of one
+
+    /* Maps a file by path, reads it back through the BitBuffer, advises it, and checks writes to the read only array are refused */
+    bool Test_MappedFile(InsecurePRNG *Insecure) {
+        bool       TestPassed               = Yes;
+        char       Path[]                   = "/tmp/Test_BufferIO_XXXXXX";
+        int        Descriptor               = mkstemp(Path);
+        if (Descriptor < 0) {
+            return No;
+        }
+        uint8_t   *Expected                 = malloc(MappedFileSize);
+        for (size_t Byte = 0; Byte < MappedFileSize; Byte++) {
+            Expected[Byte]                  = (uint8_t) InsecurePRNG_CreateInteger(Insecure, 8);
+        }
+        TestPassed                         &= write(Descriptor, Expected, MappedFileSize) == MappedFileSize;
+        close(Descriptor);
+
+        BitBuffer *Mapped                   = BitBuffer_InitFromMappedFileUTF8((const UTF8 *) Path);
+        TestPassed                         &= Mapped != NULL;
+        if (Mapped != NULL) {
+            TestPassed                     &= BitBuffer_GetSize(Mapped) == Bytes2Bits(MappedFileSize);
+            TestPassed                     &= memcmp(BitBuffer_GetArray(Mapped), Expected, MappedFileSize) == 0;
+            TestPassed                     &= BitBuffer_AdviseMapping(Mapped, AccessPattern_Sequential, 0, 0);
+            TestPassed                     &= BitBuffer_AdviseMapping(Mapped, AccessPattern_WillNeed, Bytes2Bits(5000) + 3, Bytes2Bits(10000));
+            TestPassed                     &= BitBuffer_AdviseMapping(Mapped, AccessPattern_Random, Bytes2Bits(MappedFileSize - 1), 0);
+            BitBuffer_SetPosition(Mapped, Bytes2Bits(4097));
+            TestPassed                     &= BitBuffer_ReadBits(Mapped, ByteOrder_Right2Left, BitOrder_Right2Left, 8) == Expected[4097];
+
+            size_t     Position             = BitBuffer_GetPosition(Mapped);
+            BitBuffer *Scratch              = BitBuffer_Init(64);
+            BitBuffer_Copy(Scratch, Mapped, 0, 64); // Each of these is refused
+            BitBuffer_WriteBits(Mapped, ByteOrder_Right2Left, BitOrder_Right2Left, 8, 0);
+            BitBuffer_SetArray(Mapped, BitBuffer_GetArray(Scratch), 64);
+            TestPassed                     &= BitBuffer_Erase(Mapped, 0) == No;
+            TestPassed                     &= BitBuffer_GetPosition(Mapped) == Position;
+            TestPassed                     &= BitBuffer_GetSize(Mapped) == Bytes2Bits(MappedFileSize);
+            TestPassed                     &= memcmp(BitBuffer_GetArray(Mapped), Expected, MappedFileSize) == 0;
+            BitBuffer_Deinit(Scratch);
+            BitBuffer_Deinit(Mapped);
+        }
+
+        BitBuffer *Unmapped                 = BitBuffer_Init(64);
+        TestPassed                         &= BitBuffer_AdviseMapping(Unmapped, AccessPattern_Sequential, 0, 0) == No;
+        BitBuffer_Deinit(Unmapped);
+        unlink(Path);
+        free(Expected);
+        return TestPassed;
+    }
+
+#undef MappedFileSize
+
+#define StreamArraySize 4096
+#define StreamFileSize  (StreamArraySize * 9 + 1234) // Ends partway through an array, and partway through a ring
+
+    /* Reads the whole stream through ReadStream, moving the stream back to Restart once halfway through */
+    static bool Test_ReadStreamWithDepth(AsynchronousIOStream *Stream, const uint8_t *Expected, uint8_t PrefetchDepth, size_t Restart) {
+        bool       TestPassed               = Yes;
+        BitBuffer *BitB                     = BitBuffer_Init(StreamArraySize);
+        BitBuffer_SetInputStream(BitB, Stream);
+        BitBuffer_SetPrefetchDepth(BitB, PrefetchDepth);
+        AsynchronousIOStream_SetPosition(Stream, 0);
+        size_t     Position                 = 0;
+        bool       Restarted                = No;
+        for (;;) {
+            BitBuffer_ReadStream(BitB);
+            size_t NumBytes                 = Bits2Bytes(RoundingType_Down, BitBuffer_GetSize(BitB));
+            if (NumBytes == 0) {
+                break;
+            }
+            TestPassed                     &= Position + NumBytes <= StreamFileSize;
+            if (TestPassed == No) {
+                break;
+            }
+            for (size_t Byte = 0; Byte < NumBytes; Byte++) { // Reading all of it leaves nothing for the next ReadStream to keep
+                TestPassed                 &= BitBuffer_ReadBits(BitB, ByteOrder_Right2Left, BitOrder_Right2Left, 8) == Expected[Position + Byte];
+            }
+            Position                       += NumBytes;
+            if (Restarted == No && Position >= StreamFileSize / 2) {
+                AsynchronousIOStream_SetPosition(Stream, Restart); // What's prefetched past here has to be thrown away
+                Position                    = Restart;
+                Restarted                   = Yes;
+            }
+        }
+        TestPassed                         &= Restarted && Position == StreamFileSize;
+        BitBuffer_Deinit(BitB);
+        return TestPassed;
+    }
+
+    /* Writes the whole stream a byte at a time through WriteStream, going back to rewrite the start once */
+    static bool Test_WriteStreamWithDepth(AsynchronousIOStream *Stream, const uint8_t *Expected, uint8_t PrefetchDepth) {
+        bool       TestPassed               = Yes;
+        BitBuffer *BitB                     = BitBuffer_Init(StreamArraySize);
+        BitBuffer_SetOutputStream(BitB, Stream);
+        BitBuffer_SetPrefetchDepth(BitB, PrefetchDepth);
+        AsynchronousIOStream_SetPosition(Stream, 0);
+        for (size_t Byte = 0; Byte < StreamFileSize; Byte++) {
+            BitBuffer_WriteBits(BitB, ByteOrder_Right2Left, BitOrder_Right2Left, 8, (uint8_t) ~Expected[Byte]);
+            if (BitBuffer_GetPosition(BitB) == Bytes2Bits(StreamArraySize)) {
+                TestPassed                 &= BitBuffer_WriteStream(BitB);
+            }
+        }
+        TestPassed                         &= BitBuffer_WriteStream(BitB);
+        AsynchronousIOStream_SetPosition(Stream, 0); // Every byte so far is wrong on purpose, the rewrite has to land after them
+        for (size_t Byte = 0; Byte < StreamFileSize; Byte++) {
+            BitBuffer_WriteBits(BitB, ByteOrder_Right2Left, BitOrder_Right2Left, 8, Expected[Byte]);
+            if (BitBuffer_GetPosition(BitB) == Bytes2Bits(StreamArraySize)) {
+                TestPassed                 &= BitBuffer_WriteStream(BitB);
+            }
+        }
+        TestPassed                         &= BitBuffer_WriteStream(BitB);
+        BitBuffer_SetPrefetchDepth(BitB, 0); // Waits for the writes still in flight
+        TestPassed                         &= AsynchronousIOStream_GetPosition(Stream) == StreamFileSize;
+
+        uint8_t   *Written                  = calloc(StreamFileSize, sizeof(uint8_t));
+        TestPassed                         &= AsynchronousIOStream_ReadAt(Stream, Written, 1, StreamFileSize, 0) == StreamFileSize;
+        TestPassed                         &= memcmp(Written, Expected, StreamFileSize) == 0;
+        free(Written);
+        BitBuffer_Deinit(BitB);
+        return TestPassed;
+    }
+
+    /* ReadStream and WriteStream, blocking and with a ring of 1 and 3 chunks, must all see the same bytes */
+    bool Test_ReadWriteStream(InsecurePRNG *Insecure) {
+        bool                  TestPassed    = Yes;
+        char                  Path[]        = "/tmp/Test_BufferIO_XXXXXX";
+        int                   Descriptor    = mkstemp(Path);
+        if (Descriptor < 0) {
+            return No;
+        }
+        AsynchronousIOStream *Stream        = AsynchronousIOStream_Init();
+        AsynchronousIOStream_SetDescriptor(Stream, Descriptor);
+        uint8_t              *Expected      = malloc(StreamFileSize);
+        for (size_t Byte = 0; Byte < StreamFileSize; Byte++) {
+            Expected[Byte]                  = (uint8_t) InsecurePRNG_CreateInteger(Insecure, 8);
+        }
+        uint8_t               Depths[3]     = {0, 1, 3};
+        for (uint8_t Depth = 0; Depth < 3; Depth++) {
+            TestPassed                     &= Test_WriteStreamWithDepth(Stream, Expected, Depths[Depth]);
+            TestPassed                     &= Test_ReadStreamWithDepth(Stream, Expected, Depths[Depth], 1 + InsecurePRNG_CreateInteger(Insecure, 14));
+        }
+        AsynchronousIOStream_Deinit(Stream);
+        unlink(Path);
+        free(Expected);
+        return TestPassed;
+    }
+
+#undef StreamFileSize
+#undef StreamArraySize
+    
     int main(const int argc, const char *argv[]) {
         TestIO_RunTests(BufferIOTests);
 
@@ -196,7 +1030,21 @@ extern "C" {
         bool FarFarPassed            = Test_ReadWriteBitsFarFar(Insecure);
         bool NearFarPassed           = Test_ReadWriteBitsNearFar(Insecure);
         bool FarNearPassed           = Test_ReadWriteBitsFarNear(Insecure);
-        uint8_t AllTestsPassed       = (NearNearPassed + FarFarPassed + NearFarPassed + FarNearPassed) == 4;
+        bool ArrayPassed             = Test_ReadWriteBitsArray(Insecure);
+        bool CodesPassed             = Test_ReadWriteCodes(Insecure);
+        bool CRCPassed               = Test_CalculateCRC(Insecure);
+        bool Adler32Passed           = Test_CalculateAdler32(Insecure);
+        bool MovePassed              = Test_MemoryMoveCompact(Insecure);
+        bool PoolPassed              = Test_BitBufferPool(Insecure) & Test_BitBufferPoolThreads();
+        bool StreamPassed            = Test_ReadWriteStream(Insecure);
+        bool MappedPassed            = Test_MappedFile(Insecure);
+        bool BenchmarkPassed         = Benchmark_ReadBits(Insecure);
+        bool CopySetPassed           = Test_MemoryCopySet(Insecure);
+        bool MemoryPassed            = Yes;
+        if (argc > 1 && strcmp(argv[1], "--benchmark") == 0) { // Moves gigabytes, so it's only run when asked for
+            MemoryPassed             = Benchmark_MemoryCopySet(Insecure);
+        }
+        uint8_t AllTestsPassed       = (NearNearPassed + FarFarPassed + NearFarPassed + FarNearPassed + ArrayPassed + CodesPassed + CRCPassed + Adler32Passed + MovePassed + CopySetPassed + PoolPassed + StreamPassed + MappedPassed + BenchmarkPassed + MemoryPassed) == 15;
         return EXIT_SUCCESS;
     }
     
@@ -3,6 +3,14 @@
 
 #include "../../include/include/CryptographyIO.h"
 
+#include <fcntl.h>                                /* Included for open */
+#include <stdio.h>                                /* Included for snprintf */
+#include <stdlib.h>                               /* Included for mkstemp, mkdtemp */
+#include <string.h>                               /* Included for memcmp */
+#include <unistd.h>                               /* Included for pipe, pread, write, close, unlink, rmdir */
+#include <sys/stat.h>                             /* Included for mkdir */
+#include <sys/socket.h>                           /* Included for socketpair */
+
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
 extern "C" {
 #endif
@@ -28,8 +36,232 @@ extern "C" {
         return TestPassed;
     }
 
+    /* Unaligned offsets, copy-on-write staying private, and shared writes growing the file */
+    bool Test_MapView(void) {
+        bool            TestPassed  = true;
+        char            Path[]      = "/tmp/Test_FileIO_XXXXXX";
+        int             Descriptor  = mkstemp(Path);
+        if (Descriptor < 0) {
+            return false;
+        }
+        uint8_t         Data[10000];
+        for (size_t Byte = 0; Byte < sizeof(Data); Byte++) {
+            Data[Byte]              = (uint8_t) (Byte * 7);
+        }
+        TestPassed                 &= write(Descriptor, Data, sizeof(Data)) == (ssize_t) sizeof(Data);
+        close(Descriptor);
+
+        FileIO_MapView *Read        = FileIO_MapView_InitFromPathUTF8((const UTF8 *) Path, 5001, 0, MapMode_Read | MapMode_HugePages);
+        TestPassed                 &= Read != NULL && FileIO_MapView_GetSize(Read) == sizeof(Data) - 5001;
+        if (Read != NULL) {
+            uint8_t    *Bytes       = FileIO_MapView_GetPointer(Read);
+            for (size_t Byte = 0; Byte < FileIO_MapView_GetSize(Read); Byte++) {
+                TestPassed         &= Bytes[Byte] == Data[5001 + Byte];
+            }
+            FileIO_MapView_Deinit(Read);
+        }
+
+        FileIO_MapView *Private     = FileIO_MapView_InitFromPathUTF8((const UTF8 *) Path, 1, 10, MapMode_CopyOnWrite);
+        TestPassed                 &= Private != NULL && FileIO_MapView_GetSize(Private) == 10;
+        if (Private != NULL) {
+            uint8_t    *Bytes       = FileIO_MapView_GetPointer(Private);
+            TestPassed             &= Bytes[0] == Data[1];
+            Bytes[0]                = 0xFF;
+            TestPassed             &= FileIO_MapView_Sync(Private);
+            FileIO_MapView_Deinit(Private);
+        }
+
+        FileIO_MapView *Shared      = FileIO_MapView_InitFromPathUTF8((const UTF8 *) Path, sizeof(Data) - 4, 8, MapMode_Write);
+        TestPassed                 &= Shared != NULL && FileIO_MapView_GetSize(Shared) == 8;
+        if (Shared != NULL) {
+            uint8_t    *Bytes       = FileIO_MapView_GetPointer(Shared);
+            TestPassed             &= Bytes[0] == Data[sizeof(Data) - 4];
+            for (size_t Byte = 0; Byte < 8; Byte++) {
+                Bytes[Byte]         = (uint8_t) (0xA0 + Byte);
+            }
+            TestPassed             &= FileIO_MapView_Sync(Shared);
+            FileIO_MapView_Deinit(Shared);
+        }
+
+        uint8_t         Check[10]   = {0};
+        Descriptor                  = open(Path, O_RDONLY);
+        TestPassed                 &= pread(Descriptor, Check, 1, 1) == 1 && Check[0] == Data[1];
+        TestPassed                 &= pread(Descriptor, Check, sizeof(Check), sizeof(Data) - 4) == 8;
+        for (size_t Byte = 0; Byte < 8; Byte++) {
+            TestPassed             &= Check[Byte] == (uint8_t) (0xA0 + Byte);
+        }
+        close(Descriptor);
+        TestPassed                 &= FileIO_MapView_InitFromPathUTF8((const UTF8 *) Path, sizeof(Data) + 4, 0, MapMode_Read) == NULL;
+        unlink(Path);
+        return TestPassed;
+    }
+
+    /*
+     Each case sets up the conditions Linux picks one path for: file to file is copy_file_range, file to pipe is sendfile, pipe to file is splice,
+     socket to file is splice through a pipe of our own, and an O_APPEND destination is refused by both copy_file_range and sendfile so it's buffered.
+     A file on another filesystem is sendfile where copy_file_range won't cross filesystems, and copy_file_range where it will.
+     */
+    bool Test_Transfer(void) {
+        bool                  TestPassed  = true;
+        char                  From[]      = "/tmp/Test_FileIO_XXXXXX";
+        char                  To[]        = "/tmp/Test_FileIO_XXXXXX";
+        int                   Input       = mkstemp(From);
+        int                   Output      = mkstemp(To);
+        int                   Pipe[2]     = {-1, -1};
+        if (Input < 0 || Output < 0 || pipe(Pipe) != 0) {
+            return false;
+        }
+        uint8_t               Data[50000];
+        for (size_t Byte = 0; Byte < sizeof(Data); Byte++) {
+            Data[Byte]                    = (uint8_t) (Byte * 13);
+        }
+        TestPassed                       &= write(Input, Data, sizeof(Data)) == (ssize_t) sizeof(Data);
+        AsynchronousIOStream *Source      = AsynchronousIOStream_Init();
+        AsynchronousIOStream *Destination = AsynchronousIOStream_Init();
+        AsynchronousIOStream *Writer      = AsynchronousIOStream_Init();
+        AsynchronousIOStream *Reader      = AsynchronousIOStream_Init();
+        AsynchronousIOStream_SetDescriptor(Source, Input);
+        AsynchronousIOStream_SetDescriptor(Destination, Output);
+        AsynchronousIOStream_SetDescriptor(Writer, Pipe[1]);
+        AsynchronousIOStream_SetDescriptor(Reader, Pipe[0]);
+
+        TestPassed                       &= FileIO_Transfer(Destination, 100, Source, 3, 0) == sizeof(Data) - 3;
+        uint8_t               Check[sizeof(Data)];
+        TestPassed                       &= pread(Output, Check, sizeof(Check), 100) == (ssize_t) sizeof(Data) - 3;
+        TestPassed                       &= memcmp(Check, &Data[3], sizeof(Data) - 3) == 0;
+
+        TestPassed                       &= FileIO_Transfer(Writer, 0, Source, 1000, 20000) == 20000; // Less than the pipe holds, so nothing blocks
+        TestPassed                       &= FileIO_Transfer(Destination, 0, Reader, 0, 20000) == 20000;
+        TestPassed                       &= pread(Output, Check, 20000, 0) == 20000;
+        TestPassed                       &= memcmp(Check, &Data[1000], 20000) == 0;
+
+        TestPassed                       &= pwrite(Input, Data, 1000, sizeof(Data)) == 1000; // Grows behind the stream's back, NumBytes = 0 has to see it
+        TestPassed                       &= FileIO_Transfer(Destination, 0, Source, sizeof(Data) - 500, 0) == 1500;
+        TestPassed                       &= pread(Output, Check, 1500, 0) == 1500;
+        TestPassed                       &= memcmp(Check, &Data[sizeof(Data) - 500], 500) == 0 && memcmp(&Check[500], Data, 1000) == 0;
+
+        int                   Sockets[2]  = {-1, -1};
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, Sockets) == 0) {
+            AsynchronousIOStream *Socket  = AsynchronousIOStream_Init();
+            AsynchronousIOStream_SetDescriptor(Socket, Sockets[0]);
+            TestPassed                   &= write(Sockets[1], &Data[2000], 10000) == 10000;
+            TestPassed                   &= FileIO_Transfer(Destination, 50, Socket, 0, 10000) == 10000;
+            TestPassed                   &= pread(Output, Check, 10000, 50) == 10000;
+            TestPassed                   &= memcmp(Check, &Data[2000], 10000) == 0;
+            AsynchronousIOStream_Deinit(Socket);
+            close(Sockets[1]);
+        }
+
+        char                  Appended[]  = "/tmp/Test_FileIO_XXXXXX";
+        int                   Appending   = mkstemp(Appended);
+        if (Appending >= 0) {
+            close(Appending);
+            Appending                     = open(Appended, O_WRONLY | O_APPEND);
+            AsynchronousIOStream *Append  = AsynchronousIOStream_Init();
+            AsynchronousIOStream_SetDescriptor(Append, Appending);
+            TestPassed                   &= FileIO_Transfer(Append, 0, Source, 5, 30000) == 30000;
+            int                   Reading = open(Appended, O_RDONLY);
+            TestPassed                   &= pread(Reading, Check, 30000, 0) == 30000;
+            TestPassed                   &= memcmp(Check, &Data[5], 30000) == 0;
+            close(Reading);
+            AsynchronousIOStream_Deinit(Append);
+            unlink(Appended);
+        }
+
+        char                  Elsewhere[] = "/dev/shm/Test_FileIO_XXXXXX";
+        int                   Other       = mkstemp(Elsewhere);
+        if (Other >= 0) {
+            AsynchronousIOStream *Shared  = AsynchronousIOStream_Init();
+            AsynchronousIOStream_SetDescriptor(Shared, Other);
+            TestPassed                   &= lseek(Other, 7, SEEK_SET) == 7;
+            TestPassed                   &= FileIO_Transfer(Shared, 300, Source, 0, 40000) == 40000;
+            TestPassed                   &= lseek(Other, 0, SEEK_CUR) == 7; // sendfile's seek was put back
+            TestPassed                   &= pread(Other, Check, 40000, 300) == 40000;
+            TestPassed                   &= memcmp(Check, Data, 40000) == 0;
+            AsynchronousIOStream_Deinit(Shared);
+            unlink(Elsewhere);
+        }
+
+        AsynchronousIOStream_Deinit(Source);
+        AsynchronousIOStream_Deinit(Destination);
+        AsynchronousIOStream_Deinit(Writer);
+        AsynchronousIOStream_Deinit(Reader);
+        unlink(From);
+        unlink(To);
+        return TestPassed;
+    }
+
+    typedef struct Test_WalkTally {
+        uint64_t NumDirectories;
+        uint64_t NumFiles;
+        uint64_t TotalSize;
+        uint64_t StopAfter;
+    } Test_WalkTally;
+
+    static bool Test_WalkCount(const FileIO_DirectoryEntry *Entry, void *Context) {
+        Test_WalkTally *Tally = Context;
+        uint64_t        Seen  = 0;
+        if (Entry->Type == EntryType_Directory) {
+            Seen              = __atomic_add_fetch(&Tally->NumDirectories, 1, __ATOMIC_RELAXED);
+        } else if (Entry->Type == EntryType_File) {
+            Seen              = __atomic_add_fetch(&Tally->NumFiles, 1, __ATOMIC_RELAXED);
+            __atomic_add_fetch(&Tally->TotalSize, Entry->Size, __ATOMIC_RELAXED);
+        }
+        return Tally->StopAfter == 0 || Seen < Tally->StopAfter;
+    }
+
+    /* 20 directories of 50 files each, walked whole, filtered by extension, and stopped early */
+    bool Test_DirectoryWalker(void) {
+        bool                    TestPassed  = true;
+        char                    Root[]      = "/tmp/Test_FileIO_XXXXXX";
+        char                    Path[128];
+        uint8_t                 Data[64]    = {0};
+        uint64_t                TotalSize   = 0;
+        if (mkdtemp(Root) == NULL) {
+            return false;
+        }
+        for (int Directory = 0; Directory < 20; Directory++) {
+            snprintf(Path, sizeof(Path), "%s/Directory%d", Root, Directory);
+            TestPassed                     &= mkdir(Path, 0755) == 0;
+            for (int File = 0; File < 50; File++) {
+                snprintf(Path, sizeof(Path), "%s/Directory%d/File%d.%s", Root, Directory, File, File % 2 == 0 ? "txt" : "bin");
+                int Descriptor              = open(Path, O_WRONLY | O_CREAT, 0644);
+                TestPassed                 &= write(Descriptor, Data, (size_t) File) == File;
+                TotalSize                  += (uint64_t) File;
+                close(Descriptor);
+            }
+        }
+        FileIO_DirectoryWalker *Walker      = FileIO_DirectoryWalker_Init(4);
+        FileIO_DirectoryWalker_SetFields(Walker, EntryField_Size);
+        Test_WalkTally          All         = {0};
+        TestPassed                         &= FileIO_DirectoryWalker_Walk(Walker, (const UTF8 *) Root, Test_WalkCount, &All);
+        TestPassed                         &= All.NumDirectories == 20 && All.NumFiles == 1000 && All.TotalSize == TotalSize;
+
+        const UTF8             *Extensions[] = {(const UTF8 *) "TXT"};
+        FileIO_DirectoryWalker_SetExtensions(Walker, Extensions, 1);
+        Test_WalkTally          Text        = {0};
+        TestPassed                         &= FileIO_DirectoryWalker_Walk(Walker, (const UTF8 *) Root, Test_WalkCount, &Text);
+        TestPassed                         &= Text.NumDirectories == 20 && Text.NumFiles == 500;
+
+        Test_WalkTally          Stopped     = {.StopAfter = 10};
+        TestPassed                         &= FileIO_DirectoryWalker_Walk(Walker, (const UTF8 *) Root, Test_WalkCount, &Stopped) == false;
+        TestPassed                         &= Stopped.NumFiles < 1000;
+        FileIO_DirectoryWalker_Deinit(Walker);
+
+        for (int Directory = 0; Directory < 20; Directory++) {
+            for (int File = 0; File < 50; File++) {
+                snprintf(Path, sizeof(Path), "%s/Directory%d/File%d.%s", Root, Directory, File, File % 2 == 0 ? "txt" : "bin");
+                unlink(Path);
+            }
+            snprintf(Path, sizeof(Path), "%s/Directory%d", Root, Directory);
+            rmdir(Path);
+        }
+        rmdir(Root);
+        return TestPassed;
+    }
+
     int main(const int argc, const char *argv[]) {
-        bool   TestSuitePassed      = Test_FileOpenWriteReadClose8(NULL);
+        bool   TestSuitePassed      = Test_FileOpenWriteReadClose8(NULL) & Test_MapView() & Test_Transfer() & Test_DirectoryWalker();
         int    ExitCode             = EXIT_FAILURE;
         if (TestSuitePassed) {
             ExitCode                = EXIT_SUCCESS;
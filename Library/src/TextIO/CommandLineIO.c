@@ -247,7 +247,8 @@ extern "C" {
             UTF8_Set(Indicator, '-', TerminalWidth);
             UTF8    *FormattedString     = UTF8_Format(UTF8String("%s[%U32s %llu/%llu %llu]%s%s"), Indicator, Strings[String], Numerator[String], Denominator[String], PercentComplete, Indicator, TextIO_NewLine8);
             UTF8_File_WriteString(stdout, FormattedString);
-            free(Indicator);
+            UTF8_Deinit(FormattedString);
+            UTF8_Deinit(Indicator);
         }
         free(StringSize);
         free(NumProgressIndicatorsPerString);
@@ -261,8 +262,8 @@ extern "C" {
 
         UTF8 *ProgramsOptions = UTF8_Format(UTF8String("%s's Options (-|--|/):%s"), Name, TextIO_NewLine8);
         UTF8_File_WriteString(stdout, ProgramsOptions);
-        free(Name);
-        free(ProgramsOptions);
+        UTF8_Deinit(Name);
+        UTF8_Deinit(ProgramsOptions);
 
         size_t StringSetSize = 0;
         for (size_t Switch = 0; Switch < CLI->NumSwitches; Switch++) {
@@ -738,20 +739,42 @@ extern "C" {
         AssertIO(CLI != NULL);
 
         for (uint64_t Option = 0ULL; Option < CLI->NumOptions; Option++) {
-            free(CLI->Switches[Option].Name);
-            free(CLI->Switches[Option].Description);
+            if (CLI->Switches[Option].Name != NULL) {
+                UTF32_Deinit(CLI->Switches[Option].Name);
+            }
+            if (CLI->Switches[Option].Description != NULL) {
+                UTF32_Deinit(CLI->Switches[Option].Description);
+            }
             free(CLI->Switches[Option].Children);
-            free(CLI->Switches[Option].Argument);
+            if (CLI->Switches[Option].Argument != NULL) {
+                UTF32_Deinit(CLI->Switches[Option].Argument);
+            }
         }
         free(CLI->Switches);
-        free(CLI->ProgramName);
-        free(CLI->ProgramAuthor);
-        free(CLI->ProgramDescription);
-        free(CLI->ProgramVersion);
-        free(CLI->ProgramCopyright);
-        free(CLI->ProgramLicenseName);
-        free(CLI->ProgramLicenseDescription);
-        free(CLI->ProgramLicenseURL);
+        if (CLI->ProgramName != NULL) {
+            UTF32_Deinit(CLI->ProgramName);
+        }
+        if (CLI->ProgramAuthor != NULL) {
+            UTF32_Deinit(CLI->ProgramAuthor);
+        }
+        if (CLI->ProgramDescription != NULL) {
+            UTF32_Deinit(CLI->ProgramDescription);
+        }
+        if (CLI->ProgramVersion != NULL) {
+            UTF32_Deinit(CLI->ProgramVersion);
+        }
+        if (CLI->ProgramCopyright != NULL) {
+            UTF32_Deinit(CLI->ProgramCopyright);
+        }
+        if (CLI->ProgramLicenseName != NULL) {
+            UTF32_Deinit(CLI->ProgramLicenseName);
+        }
+        if (CLI->ProgramLicenseDescription != NULL) {
+            UTF32_Deinit(CLI->ProgramLicenseDescription);
+        }
+        if (CLI->ProgramLicenseURL != NULL) {
+            UTF32_Deinit(CLI->ProgramLicenseURL);
+        }
         free(CLI);
     }
     
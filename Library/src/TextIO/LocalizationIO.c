@@ -166,9 +166,9 @@ extern "C" {
         if (DecimalSeperator16 != NULL) {
             UTF32 *DecimalSeperator32 = UTF16_Decode(DecimalSeperator16);
             DecimalSeperator          = UTF8_Encode(DecimalSeperator32);
-            free(DecimalSeperator32);
+            UTF32_Deinit(DecimalSeperator32);
+            UTF16_Deinit(DecimalSeperator16);
         }
-        free(DecimalSeperator16);
 #endif
         return DecimalSeperator;
     }
@@ -181,8 +181,8 @@ extern "C" {
         UTF8 *DecimalSeperator8 = UTF8_Clone((PlatformIO_Immutable(UTF8 *)) Locale->decimal_point);
         if (DecimalSeperator8 != NULL) {
             DecimalSeperator = UTF8_Convert(DecimalSeperator8);
+            UTF8_Deinit(DecimalSeperator8);
         }
-        free(DecimalSeperator8);
 #elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
         DecimalSeperator           = UTF16_Clone((PlatformIO_Immutable(UTF16 *)) Locale->_W_decimal_point);
 #endif
@@ -200,9 +200,9 @@ extern "C" {
         if (GroupingSeperator16 != NULL) {
             UTF32 *GroupingSeperator32 = UTF16_Decode(GroupingSeperator16);
             GroupingSeperator          = UTF8_Encode(GroupingSeperator32);
-            free(GroupingSeperator32);
+            UTF32_Deinit(GroupingSeperator32);
+            UTF16_Deinit(GroupingSeperator16);
         }
-        free(GroupingSeperator16);
 #endif
         return GroupingSeperator;
     }
@@ -215,8 +215,8 @@ extern "C" {
         UTF8 *GroupingSeperator8 = UTF8_Clone((PlatformIO_Immutable(UTF8 *)) Locale->thousands_sep);
         if (GroupingSeperator8 != NULL) {
             GroupingSeperator = UTF8_Convert(GroupingSeperator8);
+            UTF8_Deinit(GroupingSeperator8);
         }
-        free(GroupingSeperator8);
 #elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
         GroupingSeperator = UTF16_Clone((PlatformIO_Immutable(UTF16 *)) Locale->_W_thousands_sep);
 #endif
@@ -283,9 +283,9 @@ extern "C" {
 
         UTF32 *String32      = UTF8_Decode(String);
         UTF32 *Delocalized32 = UTF32_DelocalizeInteger(Base, String32);
-        free(String32);
+        UTF32_Deinit(String32);
         Delocalized          = UTF8_Encode(Delocalized32);
-        free(Delocalized32);
+        UTF32_Deinit(Delocalized32);
 
         return Delocalized;
     }
@@ -298,9 +298,9 @@ extern "C" {
 
         UTF32 *String32      = UTF16_Decode(String);
         UTF32 *Delocalized32 = UTF32_DelocalizeInteger(Base, String32);
-        free(String32);
+        UTF32_Deinit(String32);
         Delocalized          = UTF16_Encode(Delocalized32);
-        free(Delocalized32);
+        UTF32_Deinit(Delocalized32);
 
         return Delocalized;
     }
@@ -394,9 +394,9 @@ extern "C" {
 
         UTF32 *String32      = UTF8_Decode(String);
         UTF32 *Delocalized32 = UTF32_DelocalizeDecimal(Base, String32);
-        free(String32);
+        UTF32_Deinit(String32);
         Delocalized          = UTF8_Encode(Delocalized32);
-        free(Delocalized32);
+        UTF32_Deinit(Delocalized32);
 
         return Delocalized;
     }
@@ -408,9 +408,9 @@ extern "C" {
 
         UTF32 *String32      = UTF16_Decode(String);
         UTF32 *Delocalized32 = UTF32_DelocalizeDecimal(Base, String32);
-        free(String32);
+        UTF32_Deinit(String32);
         Delocalized          = UTF16_Encode(Delocalized32);
-        free(Delocalized32);
+        UTF32_Deinit(Delocalized32);
 
         return Delocalized;
     }
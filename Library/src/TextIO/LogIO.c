@@ -84,8 +84,8 @@ extern "C" {
         AssertIO(Combined != NULL);
         snprintf((char*) Combined, SizeCombined, "%s %s", SecurityName8, FormattedArgs);
         
-        free(FormattedArgs);
-        free(SecurityName8);
+        UTF8_Deinit(FormattedArgs);
+        UTF8_Deinit(SecurityName8);
 
         if (Log_LogFile != NULL) {
             UTF8_File_WriteString(Log_LogFile, Combined);
@@ -93,14 +93,17 @@ extern "C" {
         } else {
             printf("%s", Combined);
         }
+        UTF8_Deinit(Combined);
     }
     
     void Log_Deinit(void) {
         if (Log_LogFile != NULL) {
             FileIO_Close(Log_LogFile);
+            Log_LogFile = NULL;
         }
         if (Log_ProgramName8 != NULL) {
-            free(Log_ProgramName8);
+            UTF8_Deinit(Log_ProgramName8);
+            Log_ProgramName8 = NULL;
         }
     }
 
@@ -7,6 +7,18 @@
 #include "../../include/TextIO/Private/TextIOTables.h" /* Included for the Text tables */
 #include "../../include/TextIO/StringSetIO.h"          /* Included for StringSet support */
 
+#include <string.h>                                    /* Included for strlen, memcpy */
+
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+#include <pthread.h>                                   /* Included for pthread_once */
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+#include <windows.h>                                   /* Included for InitOnceExecuteOnce */
+#endif /* PlatformIO_TargetOS */
+
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+#include <immintrin.h>                                 /* Included for the SIMD validation kernels */
+#endif /* PlatformIO_Architecture */
+
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
 extern "C" {
 #endif
@@ -37,6 +49,8 @@ extern "C" {
         UTF16_Debug_Text_16LE   = 0x3631,
         UTF32_Debug_Text_32BE   = 0x3332,
         UTF32_Debug_Text_32LE   = 0x3233,
+        StringIO_MaxIntegerSize = 65,   // 64 binary digits and a sign
+        StringIO_ArenaAlignment = 16,
     } StringIOConstants;
     
     typedef struct UTF8CodePoint {
@@ -99,11 +113,158 @@ CodePoint.CodeUnits[3] = String[3];
         return String[0];
     }
     
+    /* TextIO_Arena */
+    typedef struct TextIO_ArenaBlock {
+        struct TextIO_ArenaBlock      *Previous;
+        size_t                         Capacity;
+        size_t                         Offset;
+        uint8_t                        Data[];
+    } TextIO_ArenaBlock;
+
+    /* The first block lives in the same allocation as the arena, Spare holds blocks a reset let go of */
+    typedef struct TextIO_Arena {
+        TextIO_ArenaBlock             *Current;
+        TextIO_ArenaBlock             *Spare;
+        TextIO_ArenaBlock             *First;
+        size_t                         BlockSize;
+    } TextIO_Arena;
+
+    static PlatformIO_ThreadLocal TextIO_Arena *TextIO_Arena_Default;
+
+    TextIO_Arena *TextIO_Arena_Init(size_t BlockSize) {
+        AssertIO(BlockSize > 0);
+        TextIO_Arena *Arena            = malloc(sizeof(TextIO_Arena) + sizeof(TextIO_ArenaBlock) + BlockSize);
+        AssertIO(Arena != NULL);
+        Arena->First                   = (TextIO_ArenaBlock*) &Arena[1];
+        Arena->First->Previous         = NULL;
+        Arena->First->Capacity         = BlockSize;
+        Arena->First->Offset           = 0;
+        Arena->Current                 = Arena->First;
+        Arena->Spare                   = NULL;
+        Arena->BlockSize               = BlockSize;
+        return Arena;
+    }
+
+    /* Reuses a spare block that fits NumBytes, otherwise allocates a new one */
+    static TextIO_ArenaBlock *TextIO_Arena_GetBlock(TextIO_Arena *Arena, size_t NumBytes) {
+        TextIO_ArenaBlock **Link       = &Arena->Spare;
+        while (*Link != NULL) {
+            if ((*Link)->Capacity >= NumBytes) {
+                TextIO_ArenaBlock *Block = *Link;
+                *Link                  = Block->Previous;
+                return Block;
+            }
+            Link                       = &(*Link)->Previous;
+        }
+        size_t Capacity                = NumBytes > Arena->BlockSize ? NumBytes : Arena->BlockSize;
+        TextIO_ArenaBlock *Block       = malloc(sizeof(TextIO_ArenaBlock) + Capacity);
+        AssertIO(Block != NULL);
+        Block->Capacity                = Capacity;
+        return Block;
+    }
+
+    void *TextIO_Arena_Allocate(TextIO_Arena *Arena, size_t NumBytes) {
+        AssertIO(Arena != NULL);
+        TextIO_ArenaBlock *Block       = Arena->Current;
+        uintptr_t          Address     = (uintptr_t) &Block->Data[Block->Offset];
+        size_t             Padding     = (StringIO_ArenaAlignment - (Address % StringIO_ArenaAlignment)) % StringIO_ArenaAlignment;
+        if (Block->Capacity - Block->Offset < Padding + NumBytes) {
+            Block                      = TextIO_Arena_GetBlock(Arena, NumBytes + StringIO_ArenaAlignment);
+            Block->Previous            = Arena->Current;
+            Block->Offset              = 0;
+            Arena->Current             = Block;
+            Address                    = (uintptr_t) Block->Data;
+            Padding                    = (StringIO_ArenaAlignment - (Address % StringIO_ArenaAlignment)) % StringIO_ArenaAlignment;
+        }
+        void *Allocation               = &Block->Data[Block->Offset + Padding];
+        Block->Offset                 += Padding + NumBytes;
+        return Allocation;
+    }
+
+    TextIO_ArenaMark TextIO_Arena_GetMark(TextIO_Arena *Arena) {
+        AssertIO(Arena != NULL);
+        TextIO_ArenaMark Mark          = {
+            .Block                     = Arena->Current,
+            .Offset                    = Arena->Current->Offset,
+        };
+        return Mark;
+    }
+
+    void TextIO_Arena_ResetToMark(TextIO_Arena *Arena, TextIO_ArenaMark Mark) {
+        AssertIO(Arena != NULL);
+        AssertIO(Mark.Block != NULL);
+        while (Arena->Current != Mark.Block) {
+            TextIO_ArenaBlock *Block   = Arena->Current;
+            AssertIO(Block != Arena->First); // Mark was reset past already, or is from another arena
+            Arena->Current             = Block->Previous;
+            Block->Previous            = Arena->Spare;
+            Arena->Spare               = Block;
+        }
+        AssertIO(Mark.Offset <= Arena->Current->Offset);
+        Arena->Current->Offset         = Mark.Offset;
+    }
+
+    void TextIO_Arena_Reset(TextIO_Arena *Arena) {
+        AssertIO(Arena != NULL);
+        TextIO_ArenaMark Start         = {
+            .Block                     = Arena->First,
+            .Offset                    = 0,
+        };
+        TextIO_Arena_ResetToMark(Arena, Start);
+    }
+
+    TextIO_Arena *TextIO_Arena_SetDefault(TextIO_Arena *Arena) {
+        TextIO_Arena *Previous         = TextIO_Arena_Default;
+        TextIO_Arena_Default           = Arena;
+        return Previous;
+    }
+
+    TextIO_Arena *TextIO_Arena_GetDefault(void) {
+        return TextIO_Arena_Default;
+    }
+
+    void TextIO_Arena_Deinit(TextIO_Arena *Arena) {
+        AssertIO(Arena != NULL);
+        AssertIO(TextIO_Arena_Default != Arena);
+        TextIO_Arena_Reset(Arena);
+        while (Arena->Spare != NULL) {
+            TextIO_ArenaBlock *Block   = Arena->Spare;
+            Arena->Spare               = Block->Previous;
+            free(Block);
+        }
+        free(Arena);
+    }
+
+    /* Every Init'd string starts with the arena it came from, NULL for the heap, so Deinit knows whether to free it */
+    static void *StringIO_AllocateString(size_t NumBytes) {
+        TextIO_Arena  *Arena           = TextIO_Arena_Default;
+        size_t         AllocationSize  = sizeof(TextIO_Arena*) + NumBytes;
+        TextIO_Arena **Owner           = NULL;
+        if (Arena != NULL) {
+            Owner                      = TextIO_Arena_Allocate(Arena, AllocationSize);
+            memset(Owner, 0, AllocationSize);
+        } else {
+            Owner                      = calloc(1, AllocationSize);
+        }
+        AssertIO(Owner != NULL);
+        Owner[0]                       = Arena;
+        return &Owner[1];
+    }
+
+    /* String is what Init returned, the size prefix sits just before it */
+    static void StringIO_ReleaseString(void *String) {
+        TextIO_Arena **Owner           = (TextIO_Arena**) ((uint8_t*) String - sizeof(size_t)) - 1;
+        if (Owner[0] == NULL) {
+            free(Owner);
+        }
+    }
+    /* TextIO_Arena */
+    
     UTF8 *UTF8_Init(size_t NumCodeUnits) {
         AssertIO(NumCodeUnits > 0);
         UTF8 *String        = NULL;
         size_t StringSize   = sizeof(size_t) + NumCodeUnits + TextIO_NULLTerminatorSize;
-        String              = (UTF8*) calloc(StringSize, sizeof(UTF8));
+        String              = StringIO_AllocateString(StringSize * sizeof(UTF8));
         AssertIO(String != NULL);
         static_assert(sizeof(size_t) == 4 || sizeof(size_t) == 8, "size_t is not 4 or 8 bytes!");
         if (sizeof(size_t) == 4) {
@@ -154,7 +315,7 @@ CodePoint.CodeUnits[3] = String[3];
         AssertIO(NumCodeUnits >= 1);
         UTF16 *String       = NULL;
         size_t StringSize   = (sizeof(size_t) / sizeof(UTF16)) + NumCodeUnits + TextIO_NULLTerminatorSize;
-        String              = (UTF16*) calloc(StringSize, sizeof(UTF16));
+        String              = StringIO_AllocateString(StringSize * sizeof(UTF16));
 
         static_assert(sizeof(size_t) == 4 || sizeof(size_t) == 8, "size_t is not 4 or 8 bytes!");
         if (sizeof(size_t) == 4) {
@@ -185,9 +346,9 @@ CodePoint.CodeUnits[3] = String[3];
 
 #if   (PlatformIO_BuildType == PlatformIO_BuildTypeIsDebug)
 #if   (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsBE)
-        BufferIO_MemorySet16(String, UTF16_Debug_Text_16BE, StringSize);
+        BufferIO_MemorySet16(&String[sizeof(size_t) / sizeof(UTF16)], UTF16_Debug_Text_16BE, NumCodeUnits);
 #elif (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsLE)
-        BufferIO_MemorySet16(String, UTF16_Debug_Text_16LE, StringSize);
+        BufferIO_MemorySet16(&String[sizeof(size_t) / sizeof(UTF16)], UTF16_Debug_Text_16LE, NumCodeUnits);
 #endif /* ByteOrder */
 #endif /* Debug */
         AssertIO(String != NULL);
@@ -198,7 +359,7 @@ CodePoint.CodeUnits[3] = String[3];
         AssertIO(NumCodePoints >= 1);
         UTF32 *String       = NULL;
         size_t StringSize   = (sizeof(size_t) / sizeof(UTF16)) + NumCodePoints + TextIO_NULLTerminatorSize;
-        String              = (UTF32*) calloc(StringSize, sizeof(UTF32));
+        String              = StringIO_AllocateString(StringSize * sizeof(UTF32));
         AssertIO(String != NULL);
 
         static_assert(sizeof(size_t) == 4 || sizeof(size_t) == 8, "size_t is not 4 or 8 bytes!");
@@ -222,9 +383,9 @@ CodePoint.CodeUnits[3] = String[3];
 
 #if   (PlatformIO_BuildType == PlatformIO_BuildTypeIsDebug)
 #if   (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsBE)
-        BufferIO_MemorySet32(String, UTF32_Debug_Text_32BE, StringSize);
+        BufferIO_MemorySet32(&String[sizeof(size_t) / sizeof(UTF32)], UTF32_Debug_Text_32BE, NumCodePoints);
 #elif (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsLE)
-        BufferIO_MemorySet32(String, UTF32_Debug_Text_32LE, StringSize);
+        BufferIO_MemorySet32(&String[sizeof(size_t) / sizeof(UTF32)], UTF32_Debug_Text_32LE, NumCodePoints);
 #endif /* ByteOrder */
 #endif /* Debug */
         return &String[(sizeof(size_t) / sizeof(UTF32))];
@@ -360,31 +521,6 @@ CodePoint.CodeUnits[3] = String[3];
         return CodePoint;
     }
 
-    static UTF8CodePoint UTF8_EncodeCodePoint(UTF32 CodePoint) {
-    UTF8CodePoint CodePoint = {};
-        switch (UTF32_GetCodePointSizeInUTF8CodeUnits(CodePoint)) {
-            case 1:
-                CodePoint.CodeUnits[0] = (CodePoint & UTF8Max_ASCII);
-                break;
-            case 2:
-                CodePoint.CodeUnits[0] = UTF8Header_2CodeUnits | (CodePoint & (UTF8Mask5Bit << 6)) >> 6;
-                CodePoint.CodeUnits[1] = UTF8Header_Contine    | (CodePoint &  UTF8Mask6Bit);
-                break;
-            case 3:
-                CodePoint.CodeUnits[0] = UTF8Header_3CodeUnits | (CodePoint & (UTF8Mask4Bit << 12)) >> 12;
-                CodePoint.CodeUnits[1] = UTF8Header_Contine    | (CodePoint & (UTF8Mask6Bit << 6))  >> 6;
-                CodePoint.CodeUnits[2] = UTF8Header_Contine    | (CodePoint & UTF8Mask6Bit);
-                break;
-            case 4:
-                CodePoint.CodeUnits[0] = UTF8Header_4CodeUnits | (CodePoint & (UTF8Mask3Bit << 18)) >> 18;
-                CodePoint.CodeUnits[1] = UTF8Header_Contine    | (CodePoint & (UTF8Mask6Bit << 12)) >> 12;
-                CodePoint.CodeUnits[2] = UTF8Header_Contine    | (CodePoint & (UTF8Mask6Bit << 6))  >> 6;
-                CodePoint.CodeUnits[3] = UTF8Header_Contine    | (CodePoint & UTF8Mask6Bit);
-                break;
-        }
-        return CodePoint;
-    }
-    
     UTF32 UTF16_ExtractCodePoint(PlatformIO_Immutable(UTF16 *) CodeUnits) {
         AssertIO(CodeUnits != NULL);
         UTF32 CodePoint                       = 0;
@@ -459,21 +595,6 @@ CodePoint.CodeUnits[3] = String[3];
         return Grapheme;
     }
     
-    static UTF16CodePoint UTF16_EncodeCodePoint(UTF32 CodePoint) {
-    UTF16CodePoint CodePoint = {};
-        UTF32   Ranged                                 = CodePoint + UTF16SurrogatePairStart;
-        switch (UTF32_GetCodePointSizeInUTF16CodeUnits(CodePoint)) {
-            case 1:
-                CodePoint.CodeUnits[0] = (CodePoint & UTF16MaxCodeUnitValue);
-                break;
-            case 2:
-                CodePoint.CodeUnits[0] = UTF16HighSurrogateStart + (Ranged & (UTF16SurrogateMask << UTF16SurrogateShift) >> UTF16SurrogateShift);
-                CodePoint.CodeUnits[1] = UTF16LowSurrogateStart  + (Ranged & UTF16SurrogateMask);
-                break;
-        }
-        return CodePoint;
-    }
-    
     size_t UTF8_GetGraphemeSizeInCodeUnits(UTF8 *String, size_t OffsetInCodeUnits) {
         AssertIO(String != NULL);
         size_t GraphemeSize         = 1ULL;
@@ -1256,34 +1377,246 @@ CodePoint.CodeUnits[3] = String[3];
         return CodePointIsUppercase;
     }
     
-    bool UTF8_IsValid(PlatformIO_Immutable(UTF8 *) String) {
-        AssertIO(String != NULL);
-        size_t   CodeUnit    = 0ULL;
-        bool     IsValidUTF8 = Yes;
-        while (String[CodeUnit] != TextIO_NULLTerminator) {
-            // Make sure no byte equals 0xC0 or 0xC1, or 0xF5 - 0xFF
-            // Test for Overlong encodings and shit.
-            uint8_t Byte = String[CodeUnit];
-            switch (Byte) {
-                case 0xC0:
-                case 0xC1:
-                case 0xF5:
-                case 0xF6:
-                case 0xF7:
-                case 0xF8:
-                case 0xF9:
-                case 0xFA:
-                case 0xFB:
-                case 0xFC:
-                case 0xFD:
-                case 0xFE:
-                case 0xFF:
-                    IsValidUTF8 = false;
-                    break;
+    typedef bool (*UTF8_Validator)(const uint8_t *CodeUnits, size_t NumCodeUnits);
+
+    /* Runs the validator StringIO_GetKernels chose for this CPU */
+    static bool StringIO_ValidateUTF8(const uint8_t *CodeUnits, size_t NumCodeUnits);
+
+    /* Unicode 3-7, the second code unit's range narrows after E0, ED, F0, and F4 */
+    static bool UTF8_IsValid_Portable(const uint8_t *CodeUnits, size_t NumCodeUnits) {
+        size_t CodeUnit              = 0;
+        while (CodeUnit < NumCodeUnits) {
+            if (CodeUnit + 8 <= NumCodeUnits) {
+                uint64_t Word;
+                memcpy(&Word, &CodeUnits[CodeUnit], sizeof(Word));
+                if ((Word & 0x8080808080808080ULL) == 0) {
+                    CodeUnit        += 8;
+                    continue;
+                }
             }
-            CodeUnit += 1;
+            uint8_t Lead             = CodeUnits[CodeUnit];
+            uint8_t Size             = 1;
+            uint8_t Low              = 0x80;
+            uint8_t High             = 0xBF;
+            if (Lead <= UTF8Max_ASCII) {
+                CodeUnit            += 1;
+                continue;
+            } else if (Lead >= 0xC2 && Lead <= 0xDF) {
+                Size                 = 2;
+            } else if (Lead >= 0xE0 && Lead <= 0xEF) {
+                Size                 = 3;
+                Low                  = Lead == 0xE0 ? 0xA0 : Low;
+                High                 = Lead == 0xED ? 0x9F : High;
+            } else if (Lead >= 0xF0 && Lead <= 0xF4) {
+                Size                 = 4;
+                Low                  = Lead == 0xF0 ? 0x90 : Low;
+                High                 = Lead == 0xF4 ? 0x8F : High;
+            } else {
+                return No;
+            }
+            if (NumCodeUnits - CodeUnit < Size || CodeUnits[CodeUnit + 1] < Low || CodeUnits[CodeUnit + 1] > High) {
+                return No;
+            }
+            for (uint8_t Continuation = 2; Continuation < Size; Continuation++) {
+                if ((CodeUnits[CodeUnit + Continuation] & 0xC0) != UTF8Header_Contine) {
+                    return No;
+                }
+            }
+            CodeUnit                += Size;
         }
-        return IsValidUTF8;
+        return Yes;
+    }
+
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+    /*
+     Lookup based range checking, Keiser and Lemire's "Validating UTF-8 In Less Than One Instruction Per Byte".
+     Each code unit is classified by the high nibble of the unit before it, the low nibble of the unit before it, and its own high nibble;
+     a bit survives the AND of all three only for an invalid pair. Third and fourth code units are checked by looking 2 and 3 units back.
+     */
+    typedef enum UTF8ValidationErrors : uint8_t {
+        UTF8Error_TooShort           = 1,   // Lead or ASCII, then not a continuation
+        UTF8Error_TooLong            = 2,   // ASCII, then a continuation
+        UTF8Error_Overlong3          = 4,   // E0 then 80...9F
+        UTF8Error_TooLarge           = 8,   // F4 then 90...BF, or F5 and up
+        UTF8Error_Surrogate          = 16,  // ED then A0...BF
+        UTF8Error_Overlong2          = 32,  // C0 or C1
+        UTF8Error_TooLarge1000       = 64,  // F5 and up then 80...8F
+        UTF8Error_Overlong4          = 64,  // F0 then 80...8F
+        UTF8Error_TwoContinuations   = 128, // Continuation then continuation, fine when 2 or 3 units back is a lead
+        UTF8Error_Carry              = UTF8Error_TooShort | UTF8Error_TooLong | UTF8Error_TwoContinuations,
+    } UTF8ValidationErrors;
+
+    static const uint8_t UTF8Validation_Byte1High[16] = {
+        UTF8Error_TooLong, UTF8Error_TooLong, UTF8Error_TooLong, UTF8Error_TooLong, UTF8Error_TooLong, UTF8Error_TooLong, UTF8Error_TooLong, UTF8Error_TooLong,
+        UTF8Error_TwoContinuations, UTF8Error_TwoContinuations, UTF8Error_TwoContinuations, UTF8Error_TwoContinuations,
+        UTF8Error_TooShort | UTF8Error_Overlong2,
+        UTF8Error_TooShort,
+        UTF8Error_TooShort | UTF8Error_Overlong3 | UTF8Error_Surrogate,
+        UTF8Error_TooShort | UTF8Error_TooLarge | UTF8Error_TooLarge1000 | UTF8Error_Overlong4,
+    };
+
+    static const uint8_t UTF8Validation_Byte1Low[16] = {
+        UTF8Error_Carry | UTF8Error_Overlong3 | UTF8Error_Overlong2 | UTF8Error_Overlong4,
+        UTF8Error_Carry | UTF8Error_Overlong2,
+        UTF8Error_Carry,
+        UTF8Error_Carry,
+        UTF8Error_Carry | UTF8Error_TooLarge,
+        UTF8Error_Carry | UTF8Error_TooLarge | UTF8Error_TooLarge1000,
+        UTF8Error_Carry | UTF8Error_TooLarge | UTF8Error_TooLarge1000,
+        UTF8Error_Carry | UTF8Error_TooLarge | UTF8Error_TooLarge1000,
+        UTF8Error_Carry | UTF8Error_TooLarge | UTF8Error_TooLarge1000,
+        UTF8Error_Carry | UTF8Error_TooLarge | UTF8Error_TooLarge1000,
+        UTF8Error_Carry | UTF8Error_TooLarge | UTF8Error_TooLarge1000,
+        UTF8Error_Carry | UTF8Error_TooLarge | UTF8Error_TooLarge1000,
+        UTF8Error_Carry | UTF8Error_TooLarge | UTF8Error_TooLarge1000,
+        UTF8Error_Carry | UTF8Error_TooLarge | UTF8Error_TooLarge1000 | UTF8Error_Surrogate,
+        UTF8Error_Carry | UTF8Error_TooLarge | UTF8Error_TooLarge1000,
+        UTF8Error_Carry | UTF8Error_TooLarge | UTF8Error_TooLarge1000,
+    };
+
+    static const uint8_t UTF8Validation_Byte2High[16] = {
+        UTF8Error_TooShort, UTF8Error_TooShort, UTF8Error_TooShort, UTF8Error_TooShort, UTF8Error_TooShort, UTF8Error_TooShort, UTF8Error_TooShort, UTF8Error_TooShort,
+        UTF8Error_TooLong | UTF8Error_Overlong2 | UTF8Error_TwoContinuations | UTF8Error_Overlong3 | UTF8Error_TooLarge1000 | UTF8Error_Overlong4,
+        UTF8Error_TooLong | UTF8Error_Overlong2 | UTF8Error_TwoContinuations | UTF8Error_Overlong3 | UTF8Error_TooLarge,
+        UTF8Error_TooLong | UTF8Error_Overlong2 | UTF8Error_TwoContinuations | UTF8Error_Surrogate | UTF8Error_TooLarge,
+        UTF8Error_TooLong | UTF8Error_Overlong2 | UTF8Error_TwoContinuations | UTF8Error_Surrogate | UTF8Error_TooLarge,
+        UTF8Error_TooShort, UTF8Error_TooShort, UTF8Error_TooShort, UTF8Error_TooShort,
+    };
+
+    /* Nonzero where a sequence runs past the end of the block: the last unit is C0+, the second to last E0+, or the third to last F0+ */
+    static const uint8_t UTF8Validation_Incomplete[32] = {
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1,
+    };
+
+    PlatformIO_TargetFeatures("ssse3")
+    static inline __m128i UTF8_CheckBlock_SSSE3(__m128i Input, __m128i Previous) {
+        const __m128i Nibble         = _mm_set1_epi8(0x0F);
+        __m128i Previous1            = _mm_alignr_epi8(Input, Previous, 16 - 1);
+        __m128i Previous2            = _mm_alignr_epi8(Input, Previous, 16 - 2);
+        __m128i Previous3            = _mm_alignr_epi8(Input, Previous, 16 - 3);
+        __m128i Byte1High            = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) UTF8Validation_Byte1High), _mm_and_si128(_mm_srli_epi16(Previous1, 4), Nibble));
+        __m128i Byte1Low             = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) UTF8Validation_Byte1Low), _mm_and_si128(Previous1, Nibble));
+        __m128i Byte2High            = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) UTF8Validation_Byte2High), _mm_and_si128(_mm_srli_epi16(Input, 4), Nibble));
+        __m128i Special              = _mm_and_si128(_mm_and_si128(Byte1High, Byte1Low), Byte2High);
+        __m128i IsThird              = _mm_subs_epu8(Previous2, _mm_set1_epi8((char) (0xE0 - 0x80))); // Only 111xxxxx stays at or above 0x80
+        __m128i IsFourth             = _mm_subs_epu8(Previous3, _mm_set1_epi8((char) (0xF0 - 0x80))); // Only 1111xxxx stays at or above 0x80
+        __m128i MustBeContinuation   = _mm_and_si128(_mm_or_si128(IsThird, IsFourth), _mm_set1_epi8((char) 0x80));
+        return _mm_xor_si128(MustBeContinuation, Special);
+    }
+
+    PlatformIO_TargetFeatures("ssse3")
+    static bool UTF8_IsValid_SSSE3(const uint8_t *CodeUnits, size_t NumCodeUnits) {
+        const __m128i Incomplete     = _mm_loadu_si128((const __m128i *) &UTF8Validation_Incomplete[16]);
+        __m128i Error                = _mm_setzero_si128();
+        __m128i Previous             = _mm_setzero_si128();
+        __m128i PreviousIncomplete   = _mm_setzero_si128();
+        size_t  CodeUnit             = 0;
+        while (CodeUnit < NumCodeUnits) {
+            if (NumCodeUnits - CodeUnit >= 64) {
+                __m128i Block0       = _mm_loadu_si128((const __m128i *) &CodeUnits[CodeUnit]);
+                __m128i Block1       = _mm_loadu_si128((const __m128i *) &CodeUnits[CodeUnit + 16]);
+                __m128i Block2       = _mm_loadu_si128((const __m128i *) &CodeUnits[CodeUnit + 32]);
+                __m128i Block3       = _mm_loadu_si128((const __m128i *) &CodeUnits[CodeUnit + 48]);
+                if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(Block0, Block1), _mm_or_si128(Block2, Block3))) == 0) {
+                    Error            = _mm_or_si128(Error, PreviousIncomplete);
+                    PreviousIncomplete = _mm_setzero_si128();
+                    Previous         = Block3;
+                    CodeUnit        += 64;
+                    continue;
+                }
+            }
+            __m128i Input;
+            if (NumCodeUnits - CodeUnit >= 16) {
+                Input                = _mm_loadu_si128((const __m128i *) &CodeUnits[CodeUnit]);
+            } else {
+                uint8_t Tail[16]     = {0}; // Padded with ASCII, so a sequence cut off by the end reads as too short
+                memcpy(Tail, &CodeUnits[CodeUnit], NumCodeUnits - CodeUnit);
+                Input                = _mm_loadu_si128((const __m128i *) Tail);
+            }
+            if (_mm_movemask_epi8(Input) == 0) {
+                Error                = _mm_or_si128(Error, PreviousIncomplete);
+                PreviousIncomplete   = _mm_setzero_si128();
+            } else {
+                Error                = _mm_or_si128(Error, UTF8_CheckBlock_SSSE3(Input, Previous));
+                PreviousIncomplete   = _mm_subs_epu8(Input, Incomplete);
+            }
+            Previous                 = Input;
+            CodeUnit                += 16;
+        }
+        Error                        = _mm_or_si128(Error, PreviousIncomplete);
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(Error, _mm_setzero_si128())) == 0xFFFF;
+    }
+
+    PlatformIO_TargetFeatures("avx2")
+    static inline __m256i UTF8_CheckBlock_AVX2(__m256i Input, __m256i Previous) {
+        const __m256i Nibble         = _mm256_set1_epi8(0x0F);
+        __m256i Straddle             = _mm256_permute2x128_si256(Previous, Input, 0x21); // Previous's high lane, then Input's low lane, so alignr can reach across lanes
+        __m256i Previous1            = _mm256_alignr_epi8(Input, Straddle, 16 - 1);
+        __m256i Previous2            = _mm256_alignr_epi8(Input, Straddle, 16 - 2);
+        __m256i Previous3            = _mm256_alignr_epi8(Input, Straddle, 16 - 3);
+        __m256i Byte1High            = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) UTF8Validation_Byte1High)), _mm256_and_si256(_mm256_srli_epi16(Previous1, 4), Nibble));
+        __m256i Byte1Low             = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) UTF8Validation_Byte1Low)), _mm256_and_si256(Previous1, Nibble));
+        __m256i Byte2High            = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) UTF8Validation_Byte2High)), _mm256_and_si256(_mm256_srli_epi16(Input, 4), Nibble));
+        __m256i Special              = _mm256_and_si256(_mm256_and_si256(Byte1High, Byte1Low), Byte2High);
+        __m256i IsThird              = _mm256_subs_epu8(Previous2, _mm256_set1_epi8((char) (0xE0 - 0x80)));
+        __m256i IsFourth             = _mm256_subs_epu8(Previous3, _mm256_set1_epi8((char) (0xF0 - 0x80)));
+        __m256i MustBeContinuation   = _mm256_and_si256(_mm256_or_si256(IsThird, IsFourth), _mm256_set1_epi8((char) 0x80));
+        return _mm256_xor_si256(MustBeContinuation, Special);
+    }
+
+    PlatformIO_TargetFeatures("avx2")
+    static bool UTF8_IsValid_AVX2(const uint8_t *CodeUnits, size_t NumCodeUnits) {
+        const __m256i Incomplete     = _mm256_loadu_si256((const __m256i *) UTF8Validation_Incomplete);
+        __m256i Error                = _mm256_setzero_si256();
+        __m256i Previous             = _mm256_setzero_si256();
+        __m256i PreviousIncomplete   = _mm256_setzero_si256();
+        size_t  CodeUnit             = 0;
+        while (CodeUnit < NumCodeUnits) {
+            if (NumCodeUnits - CodeUnit >= 64) {
+                __m256i Block0       = _mm256_loadu_si256((const __m256i *) &CodeUnits[CodeUnit]);
+                __m256i Block1       = _mm256_loadu_si256((const __m256i *) &CodeUnits[CodeUnit + 32]);
+                if (_mm256_movemask_epi8(_mm256_or_si256(Block0, Block1)) == 0) {
+                    Error            = _mm256_or_si256(Error, PreviousIncomplete);
+                    PreviousIncomplete = _mm256_setzero_si256();
+                    Previous         = Block1;
+                    CodeUnit        += 64;
+                    continue;
+                }
+            }
+            __m256i Input;
+            if (NumCodeUnits - CodeUnit >= 32) {
+                Input                = _mm256_loadu_si256((const __m256i *) &CodeUnits[CodeUnit]);
+            } else {
+                uint8_t Tail[32]     = {0};
+                memcpy(Tail, &CodeUnits[CodeUnit], NumCodeUnits - CodeUnit);
+                Input                = _mm256_loadu_si256((const __m256i *) Tail);
+            }
+            if (_mm256_movemask_epi8(Input) == 0) {
+                Error                = _mm256_or_si256(Error, PreviousIncomplete);
+                PreviousIncomplete   = _mm256_setzero_si256();
+            } else {
+                Error                = _mm256_or_si256(Error, UTF8_CheckBlock_AVX2(Input, Previous));
+                PreviousIncomplete   = _mm256_subs_epu8(Input, Incomplete);
+            }
+            Previous                 = Input;
+            CodeUnit                += 32;
+        }
+        Error                        = _mm256_or_si256(Error, PreviousIncomplete);
+        return _mm256_testz_si256(Error, Error) != 0;
+    }
+#endif /* PlatformIO_ArchIsAMD64 */
+
+    bool UTF8_IsValid(PlatformIO_Immutable(UTF8 *) String) {
+        AssertIO(String != NULL);
+
+        return StringIO_ValidateUTF8((const uint8_t *) String, strlen((const char *) String));
+    }
+
+    bool UTF8_IsValidWithSize(PlatformIO_Immutable(UTF8 *) String, size_t NumCodeUnits) {
+        AssertIO(String != NULL || NumCodeUnits == 0);
+
+        return NumCodeUnits == 0 || StringIO_ValidateUTF8((const uint8_t *) String, NumCodeUnits);
     }
     
     bool UTF16_IsValid(PlatformIO_Immutable(UTF16 *) String) {
@@ -1447,87 +1780,1025 @@ CodePoint.CodeUnits[3] = String[3];
         return BOMLessString;
     }
     
-    UTF32 *UTF8_Decode(PlatformIO_Immutable(UTF8 *) String) {
-        AssertIO(String != NULL);
-        size_t   CodeUnit                        = 0ULL;
-        size_t   StringSize                      = UTF8_GetStringSizeInCodePoints(String);
-        UTF32   *DecodedString                   = UTF32_Init(StringSize);
-        AssertIO(DecodedString != NULL);
-        for (size_t CodePoint = 0ULL; CodePoint < StringSize; CodePoint++) {
-            DecodedString[CodePoint]         = UTF8_ExtractCodePoint(&String[CodeUnit]);
-            CodeUnit                        += UTF8_GetCodePointSizeInCodeUnits(String[CodePoint]);
+    /* Malformed input decodes to U+FFFD one code unit at a time, so sizing and writing always agree */
+    static UTF32 UTF8_DecodeLenient(const uint8_t *CodeUnits, size_t NumCodeUnits, size_t *CodeUnit) {
+        size_t  Offset               = *CodeUnit;
+        uint8_t Lead                 = CodeUnits[Offset];
+        uint8_t Size                 = 0;
+        uint8_t Low                  = 0x80;
+        uint8_t High                 = 0xBF;
+        UTF32   CodePoint            = InvalidReplacementCodePoint;
+        if (Lead <= UTF8Max_ASCII) {
+            *CodeUnit                = Offset + 1;
+            return Lead;
+        } else if (Lead >= 0xC2 && Lead <= 0xDF) {
+            Size                     = 2;
+        } else if (Lead >= 0xE0 && Lead <= 0xEF) {
+            Size                     = 3;
+            Low                      = Lead == 0xE0 ? 0xA0 : Low;
+            High                     = Lead == 0xED ? 0x9F : High;
+        } else if (Lead >= 0xF0 && Lead <= 0xF4) {
+            Size                     = 4;
+            Low                      = Lead == 0xF0 ? 0x90 : Low;
+            High                     = Lead == 0xF4 ? 0x8F : High;
+        }
+        if (Size == 0 || NumCodeUnits - Offset < Size || CodeUnits[Offset + 1] < Low || CodeUnits[Offset + 1] > High) {
+            *CodeUnit                = Offset + 1;
+            return CodePoint;
+        }
+        CodePoint                    = Lead & (UTF8Mask6Bit >> (Size - 1));
+        for (uint8_t Continuation = 1; Continuation < Size; Continuation++) {
+            if ((CodeUnits[Offset + Continuation] & 0xC0) != UTF8Header_Contine) {
+                *CodeUnit            = Offset + 1;
+                return InvalidReplacementCodePoint;
+            }
+            CodePoint                = (CodePoint << 6) | (CodeUnits[Offset + Continuation] & UTF8Mask6Bit);
         }
-        return DecodedString;
+        *CodeUnit                    = Offset + Size;
+        return CodePoint;
     }
-    
-    UTF32 *UTF16_Decode(PlatformIO_Immutable(UTF16 *) String) {
-        AssertIO(String != NULL);
-        size_t   CodeUnit                        = 0ULL;
-        size_t   StringSize                      = UTF16_GetStringSizeInCodePoints(String);
-        UTF32   *DecodedString                   = UTF32_Init(StringSize);
-        AssertIO(DecodedString != NULL);
-        for (size_t CodePoint = 0ULL; CodePoint < StringSize; CodePoint++) {
-            DecodedString[CodePoint]         = UTF16_ExtractCodePoint(&String[CodeUnit]);
-            CodeUnit                        += UTF16_GetCodePointSizeInCodeUnits(String[CodeUnit]);
+
+    /* Unpaired surrogates decode to U+FFFD */
+    static UTF32 UTF16_DecodeLenient(const uint16_t *CodeUnits, size_t NumCodeUnits, size_t *CodeUnit) {
+        size_t   Offset              = *CodeUnit;
+        uint16_t First               = CodeUnits[Offset];
+        *CodeUnit                    = Offset + 1;
+        if (First < UTF16HighSurrogateStart || First > UTF16LowSurrogateEnd) {
+            return First;
+        } else if (First <= UTF16HighSurrogateEnd && Offset + 1 < NumCodeUnits && CodeUnits[Offset + 1] >= UTF16LowSurrogateStart && CodeUnits[Offset + 1] <= UTF16LowSurrogateEnd) {
+            *CodeUnit                = Offset + 2;
+            return UTF16SurrogatePairStart + (((UTF32) (First - UTF16HighSurrogateStart)) << UTF16SurrogateShift) + (CodeUnits[Offset + 1] - UTF16LowSurrogateStart);
+        }
+        return InvalidReplacementCodePoint;
+    }
+
+    static uint8_t UTF8_WriteCodePoint(uint8_t *CodeUnits, UTF32 CodePoint) {
+        uint8_t Size                 = 1;
+        if (CodePoint <= UTF8Max_ASCII) {
+            CodeUnits[0]             = (uint8_t) CodePoint;
+        } else if (CodePoint <= 0x7FF) {
+            CodeUnits[0]             = (uint8_t) (UTF8Header_2CodeUnits | (CodePoint >> 6));
+            CodeUnits[1]             = (uint8_t) (UTF8Header_Contine    | (CodePoint & UTF8Mask6Bit));
+            Size                     = 2;
+        } else if (CodePoint <= UTF16MaxCodeUnitValue) {
+            CodeUnits[0]             = (uint8_t) (UTF8Header_3CodeUnits | (CodePoint >> 12));
+            CodeUnits[1]             = (uint8_t) (UTF8Header_Contine    | ((CodePoint >> 6) & UTF8Mask6Bit));
+            CodeUnits[2]             = (uint8_t) (UTF8Header_Contine    | (CodePoint & UTF8Mask6Bit));
+            Size                     = 3;
+        } else {
+            CodeUnits[0]             = (uint8_t) (UTF8Header_4CodeUnits | (CodePoint >> 18));
+            CodeUnits[1]             = (uint8_t) (UTF8Header_Contine    | ((CodePoint >> 12) & UTF8Mask6Bit));
+            CodeUnits[2]             = (uint8_t) (UTF8Header_Contine    | ((CodePoint >> 6) & UTF8Mask6Bit));
+            CodeUnits[3]             = (uint8_t) (UTF8Header_Contine    | (CodePoint & UTF8Mask6Bit));
+            Size                     = 4;
         }
-        return DecodedString;
+        return Size;
     }
-    
-    UTF8 *UTF8_Encode(PlatformIO_Immutable(UTF32 *) String) {
+
+    static uint8_t UTF16_WriteCodePoint(uint16_t *CodeUnits, UTF32 CodePoint) {
+        uint8_t Size                 = 1;
+        if (CodePoint <= UTF16MaxCodeUnitValue) {
+            CodeUnits[0]             = (uint16_t) CodePoint;
+        } else {
+            CodePoint               -= UTF16SurrogatePairStart;
+            CodeUnits[0]             = (uint16_t) (UTF16HighSurrogateStart + (CodePoint >> UTF16SurrogateShift));
+            CodeUnits[1]             = (uint16_t) (UTF16LowSurrogateStart  + (CodePoint & UTF16SurrogateMask));
+            Size                     = 2;
+        }
+        return Size;
+    }
+
+    static size_t UTF16_GetNumCodeUnits(PlatformIO_Immutable(UTF16 *) String) {
+        size_t NumCodeUnits          = 0;
+        while (String[NumCodeUnits] != TextIO_NULLTerminator) {
+            NumCodeUnits            += 1;
+        }
+        return NumCodeUnits;
+    }
+
+    /* Every kernel takes an explicit size and never writes a NULL terminator */
+    typedef struct StringIO_Transcoders {
+        size_t (*UTF8_CountUTF16)(const uint8_t *CodeUnits, size_t NumCodeUnits);
+        size_t (*UTF8_WriteUTF16)(const uint8_t *CodeUnits, size_t NumCodeUnits, uint16_t *Destination);
+        size_t (*UTF16_CountUTF8)(const uint16_t *CodeUnits, size_t NumCodeUnits);
+        size_t (*UTF16_WriteUTF8)(const uint16_t *CodeUnits, size_t NumCodeUnits, uint8_t *Destination);
+        size_t (*UTF8_CountValidUTF32)(const uint8_t *CodeUnits, size_t NumCodeUnits); // Only for input that already passed StringIO_ValidateUTF8
+        size_t (*UTF8_WriteValidUTF32)(const uint8_t *CodeUnits, size_t NumCodeUnits, uint32_t *Destination);
+        size_t (*UTF16_CountUTF32)(const uint16_t *CodeUnits, size_t NumCodeUnits);
+        size_t (*UTF16_WriteUTF32)(const uint16_t *CodeUnits, size_t NumCodeUnits, uint32_t *Destination);
+        size_t (*UTF32_CountUTF8)(const uint32_t *CodePoints, size_t NumCodePoints);
+        size_t (*UTF32_WriteUTF8)(const uint32_t *CodePoints, size_t NumCodePoints, uint8_t *Destination);
+        size_t (*UTF32_CountUTF16)(const uint32_t *CodePoints, size_t NumCodePoints);
+        size_t (*UTF32_WriteUTF16)(const uint32_t *CodePoints, size_t NumCodePoints, uint16_t *Destination);
+    } StringIO_Transcoders;
+
+    static size_t UTF8_CountUTF16_Portable(const uint8_t *CodeUnits, size_t NumCodeUnits) {
+        size_t NumUTF16              = 0;
+        size_t CodeUnit              = 0;
+        while (CodeUnit < NumCodeUnits) {
+            if (CodeUnit + 8 <= NumCodeUnits) {
+                uint64_t Word;
+                memcpy(&Word, &CodeUnits[CodeUnit], sizeof(Word));
+                if ((Word & 0x8080808080808080ULL) == 0) {
+                    NumUTF16        += 8;
+                    CodeUnit        += 8;
+                    continue;
+                }
+            }
+            NumUTF16                += UTF8_DecodeLenient(CodeUnits, NumCodeUnits, &CodeUnit) > UTF16MaxCodeUnitValue ? 2 : 1;
+        }
+        return NumUTF16;
+    }
+
+    static size_t UTF8_WriteUTF16_Portable(const uint8_t *CodeUnits, size_t NumCodeUnits, uint16_t *Destination) {
+        size_t Written               = 0;
+        size_t CodeUnit              = 0;
+        while (CodeUnit < NumCodeUnits) {
+            if (CodeUnit + 8 <= NumCodeUnits) {
+                uint64_t Word;
+                memcpy(&Word, &CodeUnits[CodeUnit], sizeof(Word));
+                if ((Word & 0x8080808080808080ULL) == 0) {
+                    for (uint8_t Byte = 0; Byte < 8; Byte++) {
+                        Destination[Written + Byte] = CodeUnits[CodeUnit + Byte];
+                    }
+                    Written         += 8;
+                    CodeUnit        += 8;
+                    continue;
+                }
+            }
+            Written                 += UTF16_WriteCodePoint(&Destination[Written], UTF8_DecodeLenient(CodeUnits, NumCodeUnits, &CodeUnit));
+        }
+        return Written;
+    }
+
+    static size_t UTF16_CountUTF8_Portable(const uint16_t *CodeUnits, size_t NumCodeUnits) {
+        size_t NumUTF8               = 0;
+        size_t CodeUnit              = 0;
+        while (CodeUnit < NumCodeUnits) {
+            UTF32 CodePoint          = UTF16_DecodeLenient(CodeUnits, NumCodeUnits, &CodeUnit);
+            NumUTF8                 += UTF32_GetCodePointSizeInUTF8CodeUnits(CodePoint);
+        }
+        return NumUTF8;
+    }
+
+    static size_t UTF16_WriteUTF8_Portable(const uint16_t *CodeUnits, size_t NumCodeUnits, uint8_t *Destination) {
+        size_t Written               = 0;
+        size_t CodeUnit              = 0;
+        while (CodeUnit < NumCodeUnits) {
+            Written                 += UTF8_WriteCodePoint(&Destination[Written], UTF16_DecodeLenient(CodeUnits, NumCodeUnits, &CodeUnit));
+        }
+        return Written;
+    }
+
+    /* Surrogates and values past U+10FFFF have no encoding, they're written as U+FFFD */
+    static UTF32 UTF32_Sanitize(UTF32 CodePoint) {
+        if ((CodePoint >= UTF16HighSurrogateStart && CodePoint <= UTF16LowSurrogateEnd) || CodePoint > UnicodeMaxCodePoint) {
+            CodePoint                = InvalidReplacementCodePoint;
+        }
+        return CodePoint;
+    }
+
+    static size_t UTF32_GetNumCodePoints(PlatformIO_Immutable(UTF32 *) String) {
+        size_t NumCodePoints         = 0;
+        while (String[NumCodePoints] != TextIO_NULLTerminator) {
+            NumCodePoints           += 1;
+        }
+        return NumCodePoints;
+    }
+
+    static size_t UTF8_CountUTF32_Portable(const uint8_t *CodeUnits, size_t NumCodeUnits) {
+        size_t NumCodePoints         = 0;
+        size_t CodeUnit              = 0;
+        while (CodeUnit < NumCodeUnits) {
+            if (CodeUnit + 8 <= NumCodeUnits) {
+                uint64_t Word;
+                memcpy(&Word, &CodeUnits[CodeUnit], sizeof(Word));
+                if ((Word & 0x8080808080808080ULL) == 0) {
+                    NumCodePoints   += 8;
+                    CodeUnit        += 8;
+                    continue;
+                }
+            }
+            UTF8_DecodeLenient(CodeUnits, NumCodeUnits, &CodeUnit);
+            NumCodePoints           += 1;
+        }
+        return NumCodePoints;
+    }
+
+    static size_t UTF8_WriteUTF32_Portable(const uint8_t *CodeUnits, size_t NumCodeUnits, uint32_t *Destination) {
+        size_t Written               = 0;
+        size_t CodeUnit              = 0;
+        while (CodeUnit < NumCodeUnits) {
+            if (CodeUnit + 8 <= NumCodeUnits) {
+                uint64_t Word;
+                memcpy(&Word, &CodeUnits[CodeUnit], sizeof(Word));
+                if ((Word & 0x8080808080808080ULL) == 0) {
+                    for (uint8_t Byte = 0; Byte < 8; Byte++) {
+                        Destination[Written + Byte] = CodeUnits[CodeUnit + Byte];
+                    }
+                    Written         += 8;
+                    CodeUnit        += 8;
+                    continue;
+                }
+            }
+            Destination[Written]     = UTF8_DecodeLenient(CodeUnits, NumCodeUnits, &CodeUnit);
+            Written                 += 1;
+        }
+        return Written;
+    }
+
+    static size_t UTF16_CountUTF32_Portable(const uint16_t *CodeUnits, size_t NumCodeUnits) {
+        size_t NumCodePoints         = 0;
+        size_t CodeUnit              = 0;
+        while (CodeUnit < NumCodeUnits) {
+            UTF16_DecodeLenient(CodeUnits, NumCodeUnits, &CodeUnit);
+            NumCodePoints           += 1;
+        }
+        return NumCodePoints;
+    }
+
+    static size_t UTF16_WriteUTF32_Portable(const uint16_t *CodeUnits, size_t NumCodeUnits, uint32_t *Destination) {
+        size_t Written               = 0;
+        size_t CodeUnit              = 0;
+        while (CodeUnit < NumCodeUnits) {
+            Destination[Written]     = UTF16_DecodeLenient(CodeUnits, NumCodeUnits, &CodeUnit);
+            Written                 += 1;
+        }
+        return Written;
+    }
+
+    static size_t UTF32_CountUTF8_Portable(const uint32_t *CodePoints, size_t NumCodePoints) {
+        size_t NumCodeUnits          = 0;
+        for (size_t CodePoint = 0; CodePoint < NumCodePoints; CodePoint++) {
+            NumCodeUnits            += UTF32_GetCodePointSizeInUTF8CodeUnits(UTF32_Sanitize(CodePoints[CodePoint]));
+        }
+        return NumCodeUnits;
+    }
+
+    static size_t UTF32_WriteUTF8_Portable(const uint32_t *CodePoints, size_t NumCodePoints, uint8_t *Destination) {
+        size_t Written               = 0;
+        for (size_t CodePoint = 0; CodePoint < NumCodePoints; CodePoint++) {
+            Written                 += UTF8_WriteCodePoint(&Destination[Written], UTF32_Sanitize(CodePoints[CodePoint]));
+        }
+        return Written;
+    }
+
+    static size_t UTF32_CountUTF16_Portable(const uint32_t *CodePoints, size_t NumCodePoints) {
+        size_t NumCodeUnits          = 0;
+        for (size_t CodePoint = 0; CodePoint < NumCodePoints; CodePoint++) {
+            NumCodeUnits            += UTF32_GetCodePointSizeInUTF16CodeUnits(UTF32_Sanitize(CodePoints[CodePoint]));
+        }
+        return NumCodeUnits;
+    }
+
+    static size_t UTF32_WriteUTF16_Portable(const uint32_t *CodePoints, size_t NumCodePoints, uint16_t *Destination) {
+        size_t Written               = 0;
+        for (size_t CodePoint = 0; CodePoint < NumCodePoints; CodePoint++) {
+            Written                 += UTF16_WriteCodePoint(&Destination[Written], UTF32_Sanitize(CodePoints[CodePoint]));
+        }
+        return Written;
+    }
+
+    static const StringIO_Transcoders StringIO_Transcoders_Portable = {
+        .UTF8_CountUTF16             = UTF8_CountUTF16_Portable,
+        .UTF8_WriteUTF16             = UTF8_WriteUTF16_Portable,
+        .UTF16_CountUTF8             = UTF16_CountUTF8_Portable,
+        .UTF16_WriteUTF8             = UTF16_WriteUTF8_Portable,
+        .UTF8_CountValidUTF32        = UTF8_CountUTF32_Portable,
+        .UTF8_WriteValidUTF32        = UTF8_WriteUTF32_Portable,
+        .UTF16_CountUTF32            = UTF16_CountUTF32_Portable,
+        .UTF16_WriteUTF32            = UTF16_WriteUTF32_Portable,
+        .UTF32_CountUTF8             = UTF32_CountUTF8_Portable,
+        .UTF32_WriteUTF8             = UTF32_WriteUTF8_Portable,
+        .UTF32_CountUTF16            = UTF32_CountUTF16_Portable,
+        .UTF32_WriteUTF16            = UTF32_WriteUTF16_Portable,
+    };
+
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+    /*
+     Valid UTF-8 needs one UTF-16 code unit per non-continuation byte, plus one more per 4 byte lead,
+     so once the validator passes the size is a per-byte sum with no decoding at all.
+     */
+    PlatformIO_TargetFeatures("avx2")
+    static size_t UTF8_CountUTF16_AVX2(const uint8_t *CodeUnits, size_t NumCodeUnits) {
+        if (UTF8_IsValid_AVX2(CodeUnits, NumCodeUnits) == No) {
+            return UTF8_CountUTF16_Portable(CodeUnits, NumCodeUnits);
+        }
+        const __m256i One            = _mm256_set1_epi8(1);
+        const __m256i FirstLead      = _mm256_set1_epi8((char) 0xC0);
+        const __m256i FourLead       = _mm256_set1_epi8((char) 0xF0);
+        __m256i Sums                 = _mm256_setzero_si256();
+        size_t  CodeUnit             = 0;
+        while (NumCodeUnits - CodeUnit >= 32) {
+            __m256i Input            = _mm256_loadu_si256((const __m256i *) &CodeUnits[CodeUnit]);
+            __m256i IsContinuation   = _mm256_cmpgt_epi8(FirstLead, Input); // Signed, so only 0x80 - 0xBF are below 0xC0
+            __m256i IsFourLead       = _mm256_cmpeq_epi8(_mm256_max_epu8(Input, FourLead), Input);
+            __m256i PerByte          = _mm256_sub_epi8(_mm256_add_epi8(One, IsContinuation), IsFourLead);
+            Sums                     = _mm256_add_epi64(Sums, _mm256_sad_epu8(PerByte, _mm256_setzero_si256()));
+            CodeUnit                += 32;
+        }
+        size_t NumUTF16              = (size_t) (_mm256_extract_epi64(Sums, 0) + _mm256_extract_epi64(Sums, 1) + _mm256_extract_epi64(Sums, 2) + _mm256_extract_epi64(Sums, 3));
+        while (CodeUnit < NumCodeUnits) {
+            NumUTF16                += ((CodeUnits[CodeUnit] & 0xC0) != UTF8Header_Contine) + (CodeUnits[CodeUnit] >= UTF8Header_4CodeUnits);
+            CodeUnit                += 1;
+        }
+        return NumUTF16;
+    }
+
+    /* ASCII blocks are widened 32 at a time; a block with anything else is decoded through to its end before looking again */
+    PlatformIO_TargetFeatures("avx2")
+    static size_t UTF8_WriteUTF16_AVX2(const uint8_t *CodeUnits, size_t NumCodeUnits, uint16_t *Destination) {
+        size_t Written               = 0;
+        size_t CodeUnit              = 0;
+        while (NumCodeUnits - CodeUnit >= 32) {
+            __m256i Input            = _mm256_loadu_si256((const __m256i *) &CodeUnits[CodeUnit]);
+            if (_mm256_movemask_epi8(Input) == 0) {
+                _mm256_storeu_si256((__m256i *) &Destination[Written],      _mm256_cvtepu8_epi16(_mm256_castsi256_si128(Input)));
+                _mm256_storeu_si256((__m256i *) &Destination[Written + 16], _mm256_cvtepu8_epi16(_mm256_extracti128_si256(Input, 1)));
+                Written             += 32;
+                CodeUnit            += 32;
+            } else {
+                size_t BlockEnd      = CodeUnit + 32;
+                while (CodeUnit < BlockEnd) {
+                    Written         += UTF16_WriteCodePoint(&Destination[Written], UTF8_DecodeLenient(CodeUnits, NumCodeUnits, &CodeUnit));
+                }
+            }
+        }
+        return Written + UTF8_WriteUTF16_Portable(&CodeUnits[CodeUnit], NumCodeUnits - CodeUnit, &Destination[Written]);
+    }
+
+    /* Without surrogates each code unit needs 1, 2, or 3 bytes depending on whether it's past 0x7F and past 0x7FF */
+    PlatformIO_TargetFeatures("avx2")
+    static size_t UTF16_CountUTF8_AVX2(const uint16_t *CodeUnits, size_t NumCodeUnits) {
+        const __m256i One            = _mm256_set1_epi16(1);
+        const __m256i Three          = _mm256_set1_epi16(3);
+        const __m256i ASCIIMask      = _mm256_set1_epi16((short) 0xFF80);
+        const __m256i TwoByteMask    = _mm256_set1_epi16((short) 0xF800);
+        const __m256i Surrogate      = _mm256_set1_epi16((short) UTF16HighSurrogateStart);
+        __m256i Sums                 = _mm256_setzero_si256();
+        size_t  NumUTF8              = 0;
+        size_t  CodeUnit             = 0;
+        while (NumCodeUnits - CodeUnit >= 16) {
+            __m256i Input            = _mm256_loadu_si256((const __m256i *) &CodeUnits[CodeUnit]);
+            __m256i HighBits         = _mm256_and_si256(Input, TwoByteMask);
+            if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(HighBits, Surrogate)) != 0) {
+                size_t BlockEnd      = CodeUnit + 16;
+                while (CodeUnit < BlockEnd) {
+                    NumUTF8         += UTF32_GetCodePointSizeInUTF8CodeUnits(UTF16_DecodeLenient(CodeUnits, NumCodeUnits, &CodeUnit));
+                }
+                continue;
+            }
+            __m256i IsASCII          = _mm256_cmpeq_epi16(_mm256_and_si256(Input, ASCIIMask), _mm256_setzero_si256());
+            __m256i IsTwoByte        = _mm256_cmpeq_epi16(HighBits, _mm256_setzero_si256());
+            __m256i PerCodeUnit      = _mm256_add_epi16(Three, _mm256_add_epi16(IsASCII, IsTwoByte)); // The masks are -1 where set
+            Sums                     = _mm256_add_epi32(Sums, _mm256_madd_epi16(PerCodeUnit, One));
+            CodeUnit                += 16;
+        }
+        __m128i Folded               = _mm_add_epi32(_mm256_castsi256_si128(Sums), _mm256_extracti128_si256(Sums, 1));
+        Folded                       = _mm_add_epi32(Folded, _mm_shuffle_epi32(Folded, _MM_SHUFFLE(1, 0, 3, 2)));
+        Folded                       = _mm_add_epi32(Folded, _mm_shuffle_epi32(Folded, _MM_SHUFFLE(2, 3, 0, 1)));
+        NumUTF8                     += (uint32_t) _mm_cvtsi128_si32(Folded);
+        if (CodeUnit < NumCodeUnits) {
+            NumUTF8                 += UTF16_CountUTF8_Portable(&CodeUnits[CodeUnit], NumCodeUnits - CodeUnit);
+        }
+        return NumUTF8;
+    }
+
+    /* ASCII blocks are narrowed 16 at a time */
+    PlatformIO_TargetFeatures("avx2")
+    static size_t UTF16_WriteUTF8_AVX2(const uint16_t *CodeUnits, size_t NumCodeUnits, uint8_t *Destination) {
+        const __m256i ASCIIMask      = _mm256_set1_epi16((short) 0xFF80);
+        size_t Written               = 0;
+        size_t CodeUnit              = 0;
+        while (NumCodeUnits - CodeUnit >= 16) {
+            __m256i Input            = _mm256_loadu_si256((const __m256i *) &CodeUnits[CodeUnit]);
+            if (_mm256_testz_si256(Input, ASCIIMask) != 0) {
+                _mm_storeu_si128((__m128i *) &Destination[Written], _mm_packus_epi16(_mm256_castsi256_si128(Input), _mm256_extracti128_si256(Input, 1)));
+                Written             += 16;
+                CodeUnit            += 16;
+            } else {
+                size_t BlockEnd      = CodeUnit + 16;
+                while (CodeUnit < BlockEnd) {
+                    Written         += UTF8_WriteCodePoint(&Destination[Written], UTF16_DecodeLenient(CodeUnits, NumCodeUnits, &CodeUnit));
+                }
+            }
+        }
+        return Written + UTF16_WriteUTF8_Portable(&CodeUnits[CodeUnit], NumCodeUnits - CodeUnit, &Destination[Written]);
+    }
+
+    /* Lane indices of the set bits of each 8 bit mask, for compacting 8 decoded lanes down to the ones that started a code point */
+    static const uint64_t UTF8Decode_Compact[256] = {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000001ULL, 0x0000000000000100ULL,
+        0x0000000000000002ULL, 0x0000000000000200ULL, 0x0000000000000201ULL, 0x0000000000020100ULL,
+        0x0000000000000003ULL, 0x0000000000000300ULL, 0x0000000000000301ULL, 0x0000000000030100ULL,
+        0x0000000000000302ULL, 0x0000000000030200ULL, 0x0000000000030201ULL, 0x0000000003020100ULL,
+        0x0000000000000004ULL, 0x0000000000000400ULL, 0x0000000000000401ULL, 0x0000000000040100ULL,
+        0x0000000000000402ULL, 0x0000000000040200ULL, 0x0000000000040201ULL, 0x0000000004020100ULL,
+        0x0000000000000403ULL, 0x0000000000040300ULL, 0x0000000000040301ULL, 0x0000000004030100ULL,
+        0x0000000000040302ULL, 0x0000000004030200ULL, 0x0000000004030201ULL, 0x0000000403020100ULL,
+        0x0000000000000005ULL, 0x0000000000000500ULL, 0x0000000000000501ULL, 0x0000000000050100ULL,
+        0x0000000000000502ULL, 0x0000000000050200ULL, 0x0000000000050201ULL, 0x0000000005020100ULL,
+        0x0000000000000503ULL, 0x0000000000050300ULL, 0x0000000000050301ULL, 0x0000000005030100ULL,
+        0x0000000000050302ULL, 0x0000000005030200ULL, 0x0000000005030201ULL, 0x0000000503020100ULL,
+        0x0000000000000504ULL, 0x0000000000050400ULL, 0x0000000000050401ULL, 0x0000000005040100ULL,
+        0x0000000000050402ULL, 0x0000000005040200ULL, 0x0000000005040201ULL, 0x0000000504020100ULL,
+        0x0000000000050403ULL, 0x0000000005040300ULL, 0x0000000005040301ULL, 0x0000000504030100ULL,
+        0x0000000005040302ULL, 0x0000000504030200ULL, 0x0000000504030201ULL, 0x0000050403020100ULL,
+        0x0000000000000006ULL, 0x0000000000000600ULL, 0x0000000000000601ULL, 0x0000000000060100ULL,
+        0x0000000000000602ULL, 0x0000000000060200ULL, 0x0000000000060201ULL, 0x0000000006020100ULL,
+        0x0000000000000603ULL, 0x0000000000060300ULL, 0x0000000000060301ULL, 0x0000000006030100ULL,
+        0x0000000000060302ULL, 0x0000000006030200ULL, 0x0000000006030201ULL, 0x0000000603020100ULL,
+        0x0000000000000604ULL, 0x0000000000060400ULL, 0x0000000000060401ULL, 0x0000000006040100ULL,
+        0x0000000000060402ULL, 0x0000000006040200ULL, 0x0000000006040201ULL, 0x0000000604020100ULL,
+        0x0000000000060403ULL, 0x0000000006040300ULL, 0x0000000006040301ULL, 0x0000000604030100ULL,
+        0x0000000006040302ULL, 0x0000000604030200ULL, 0x0000000604030201ULL, 0x0000060403020100ULL,
+        0x0000000000000605ULL, 0x0000000000060500ULL, 0x0000000000060501ULL, 0x0000000006050100ULL,
+        0x0000000000060502ULL, 0x0000000006050200ULL, 0x0000000006050201ULL, 0x0000000605020100ULL,
+        0x0000000000060503ULL, 0x0000000006050300ULL, 0x0000000006050301ULL, 0x0000000605030100ULL,
+        0x0000000006050302ULL, 0x0000000605030200ULL, 0x0000000605030201ULL, 0x0000060503020100ULL,
+        0x0000000000060504ULL, 0x0000000006050400ULL, 0x0000000006050401ULL, 0x0000000605040100ULL,
+        0x0000000006050402ULL, 0x0000000605040200ULL, 0x0000000605040201ULL, 0x0000060504020100ULL,
+        0x0000000006050403ULL, 0x0000000605040300ULL, 0x0000000605040301ULL, 0x0000060504030100ULL,
+        0x0000000605040302ULL, 0x0000060504030200ULL, 0x0000060504030201ULL, 0x0006050403020100ULL,
+        0x0000000000000007ULL, 0x0000000000000700ULL, 0x0000000000000701ULL, 0x0000000000070100ULL,
+        0x0000000000000702ULL, 0x0000000000070200ULL, 0x0000000000070201ULL, 0x0000000007020100ULL,
+        0x0000000000000703ULL, 0x0000000000070300ULL, 0x0000000000070301ULL, 0x0000000007030100ULL,
+        0x0000000000070302ULL, 0x0000000007030200ULL, 0x0000000007030201ULL, 0x0000000703020100ULL,
+        0x0000000000000704ULL, 0x0000000000070400ULL, 0x0000000000070401ULL, 0x0000000007040100ULL,
+        0x0000000000070402ULL, 0x0000000007040200ULL, 0x0000000007040201ULL, 0x0000000704020100ULL,
+        0x0000000000070403ULL, 0x0000000007040300ULL, 0x0000000007040301ULL, 0x0000000704030100ULL,
+        0x0000000007040302ULL, 0x0000000704030200ULL, 0x0000000704030201ULL, 0x0000070403020100ULL,
+        0x0000000000000705ULL, 0x0000000000070500ULL, 0x0000000000070501ULL, 0x0000000007050100ULL,
+        0x0000000000070502ULL, 0x0000000007050200ULL, 0x0000000007050201ULL, 0x0000000705020100ULL,
+        0x0000000000070503ULL, 0x0000000007050300ULL, 0x0000000007050301ULL, 0x0000000705030100ULL,
+        0x0000000007050302ULL, 0x0000000705030200ULL, 0x0000000705030201ULL, 0x0000070503020100ULL,
+        0x0000000000070504ULL, 0x0000000007050400ULL, 0x0000000007050401ULL, 0x0000000705040100ULL,
+        0x0000000007050402ULL, 0x0000000705040200ULL, 0x0000000705040201ULL, 0x0000070504020100ULL,
+        0x0000000007050403ULL, 0x0000000705040300ULL, 0x0000000705040301ULL, 0x0000070504030100ULL,
+        0x0000000705040302ULL, 0x0000070504030200ULL, 0x0000070504030201ULL, 0x0007050403020100ULL,
+        0x0000000000000706ULL, 0x0000000000070600ULL, 0x0000000000070601ULL, 0x0000000007060100ULL,
+        0x0000000000070602ULL, 0x0000000007060200ULL, 0x0000000007060201ULL, 0x0000000706020100ULL,
+        0x0000000000070603ULL, 0x0000000007060300ULL, 0x0000000007060301ULL, 0x0000000706030100ULL,
+        0x0000000007060302ULL, 0x0000000706030200ULL, 0x0000000706030201ULL, 0x0000070603020100ULL,
+        0x0000000000070604ULL, 0x0000000007060400ULL, 0x0000000007060401ULL, 0x0000000706040100ULL,
+        0x0000000007060402ULL, 0x0000000706040200ULL, 0x0000000706040201ULL, 0x0000070604020100ULL,
+        0x0000000007060403ULL, 0x0000000706040300ULL, 0x0000000706040301ULL, 0x0000070604030100ULL,
+        0x0000000706040302ULL, 0x0000070604030200ULL, 0x0000070604030201ULL, 0x0007060403020100ULL,
+        0x0000000000070605ULL, 0x0000000007060500ULL, 0x0000000007060501ULL, 0x0000000706050100ULL,
+        0x0000000007060502ULL, 0x0000000706050200ULL, 0x0000000706050201ULL, 0x0000070605020100ULL,
+        0x0000000007060503ULL, 0x0000000706050300ULL, 0x0000000706050301ULL, 0x0000070605030100ULL,
+        0x0000000706050302ULL, 0x0000070605030200ULL, 0x0000070605030201ULL, 0x0007060503020100ULL,
+        0x0000000007060504ULL, 0x0000000706050400ULL, 0x0000000706050401ULL, 0x0000070605040100ULL,
+        0x0000000706050402ULL, 0x0000070605040200ULL, 0x0000070605040201ULL, 0x0007060504020100ULL,
+        0x0000000706050403ULL, 0x0000070605040300ULL, 0x0000070605040301ULL, 0x0007060504030100ULL,
+        0x0000070605040302ULL, 0x0007060504030200ULL, 0x0007060504030201ULL, 0x0706050403020100ULL,
+    };
+
+    /* PSHUFB controls packing 4 lanes of 1 to 3 encoded code units each, indexed by the lane sizes minus one in base 3 */
+    static const uint8_t UTF8Encode_Compact[81][16] = {
+        {0x00, 0x04, 0x08, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x04, 0x08, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x04, 0x08, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x04, 0x05, 0x08, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x05, 0x08, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x02, 0x04, 0x05, 0x08, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x04, 0x05, 0x06, 0x08, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x04, 0x05, 0x06, 0x08, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x04, 0x08, 0x09, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x08, 0x09, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x02, 0x04, 0x08, 0x09, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x04, 0x05, 0x08, 0x09, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x04, 0x05, 0x08, 0x09, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x04, 0x05, 0x08, 0x09, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x04, 0x08, 0x09, 0x0A, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x04, 0x08, 0x09, 0x0A, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x04, 0x08, 0x09, 0x0A, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x04, 0x05, 0x08, 0x09, 0x0A, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x05, 0x08, 0x09, 0x0A, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x02, 0x04, 0x05, 0x08, 0x09, 0x0A, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x04, 0x08, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x08, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x02, 0x04, 0x08, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x04, 0x05, 0x08, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x04, 0x05, 0x08, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x04, 0x05, 0x08, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x04, 0x05, 0x06, 0x08, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x05, 0x06, 0x08, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x04, 0x08, 0x09, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x04, 0x08, 0x09, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x04, 0x08, 0x09, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x04, 0x05, 0x08, 0x09, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x05, 0x08, 0x09, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x02, 0x04, 0x05, 0x08, 0x09, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x04, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x02, 0x04, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x04, 0x05, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x04, 0x05, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x04, 0x05, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x04, 0x08, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x04, 0x08, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x04, 0x08, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x04, 0x05, 0x08, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x05, 0x08, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x02, 0x04, 0x05, 0x08, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x04, 0x05, 0x06, 0x08, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x04, 0x05, 0x06, 0x08, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x04, 0x08, 0x09, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x08, 0x09, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x02, 0x04, 0x08, 0x09, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x04, 0x05, 0x08, 0x09, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x04, 0x05, 0x08, 0x09, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x04, 0x05, 0x08, 0x09, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x04, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x04, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x04, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x04, 0x05, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x05, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x02, 0x04, 0x05, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, {0x00, 0x01, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x80, 0x80, 0x80, 0x80},
+    };
+
+    /* A 4 bit lane mask read as base 3 digits */
+    static const uint8_t UTF8Encode_Base3[16] = {0, 1, 3, 4, 9, 10, 12, 13, 27, 28, 30, 31, 36, 37, 39, 40};
+
+    /* Valid UTF-8 has one code point per code unit that isn't a continuation */
+    PlatformIO_TargetFeatures("avx2")
+    static size_t UTF8_CountValidUTF32_AVX2(const uint8_t *CodeUnits, size_t NumCodeUnits) {
+        const __m256i One            = _mm256_set1_epi8(1);
+        const __m256i FirstLead      = _mm256_set1_epi8((char) 0xC0);
+        __m256i Sums                 = _mm256_setzero_si256();
+        size_t  CodeUnit             = 0;
+        while (NumCodeUnits - CodeUnit >= 32) {
+            __m256i Input            = _mm256_loadu_si256((const __m256i *) &CodeUnits[CodeUnit]);
+            __m256i PerByte          = _mm256_add_epi8(One, _mm256_cmpgt_epi8(FirstLead, Input));
+            Sums                     = _mm256_add_epi64(Sums, _mm256_sad_epu8(PerByte, _mm256_setzero_si256()));
+            CodeUnit                += 32;
+        }
+        size_t NumCodePoints         = (size_t) (_mm256_extract_epi64(Sums, 0) + _mm256_extract_epi64(Sums, 1) + _mm256_extract_epi64(Sums, 2) + _mm256_extract_epi64(Sums, 3));
+        while (CodeUnit < NumCodeUnits) {
+            NumCodePoints           += (CodeUnits[CodeUnit] & 0xC0) != UTF8Header_Contine;
+            CodeUnit                += 1;
+        }
+        return NumCodePoints;
+    }
+
+    /*
+     16 code units at a time: every position is decoded as if it started a 1, 2, or 3 code unit sequence,
+     then the lanes that really do start one are packed together with UTF8Decode_Compact.
+     Blocks with a 4 code unit sequence are decoded one code point at a time.
+     The 64 code unit margin keeps the 8 lane stores inside the NumCodePoints the count kernel gave.
+     */
+    PlatformIO_TargetFeatures("avx2,popcnt")
+    static size_t UTF8_WriteValidUTF32_AVX2(const uint8_t *CodeUnits, size_t NumCodeUnits, uint32_t *Destination) {
+        const __m128i FourLead       = _mm_set1_epi8((char) 0xF0);
+        const __m256i ASCIIEnd       = _mm256_set1_epi32(0x80);
+        const __m256i ThreeLead      = _mm256_set1_epi32(0xDF);
+        const __m256i Mask6Bit       = _mm256_set1_epi32(UTF8Mask6Bit);
+        const __m256i Continuation   = _mm256_set1_epi32(UTF8Header_Contine);
+        const __m256i HeaderMask     = _mm256_set1_epi32(0xC0);
+        size_t Written               = 0;
+        size_t CodeUnit              = 0;
+        while (NumCodeUnits - CodeUnit >= 64) {
+            __m128i Block            = _mm_loadu_si128((const __m128i *) &CodeUnits[CodeUnit]);
+            if (_mm_movemask_epi8(Block) == 0) {
+                _mm256_storeu_si256((__m256i *) &Destination[Written],     _mm256_cvtepu8_epi32(Block));
+                _mm256_storeu_si256((__m256i *) &Destination[Written + 8], _mm256_cvtepu8_epi32(_mm_srli_si128(Block, 8)));
+                Written             += 16;
+                CodeUnit            += 16;
+                continue;
+            } else if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(Block, FourLead), Block)) != 0) {
+                size_t BlockEnd      = CodeUnit + 16;
+                while (CodeUnit < BlockEnd) {
+                    Destination[Written] = UTF8_DecodeLenient(CodeUnits, NumCodeUnits, &CodeUnit);
+                    Written         += 1;
+                }
+                continue;
+            }
+            for (uint8_t Half = 0; Half < 16; Half += 8) {
+                const uint8_t *Start = &CodeUnits[CodeUnit + Half];
+                __m256i First        = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *) &Start[0]));
+                __m256i Second       = _mm256_and_si256(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *) &Start[1])), Mask6Bit);
+                __m256i Third        = _mm256_and_si256(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *) &Start[2])), Mask6Bit);
+                __m256i Two          = _mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(First, _mm256_set1_epi32(UTF8Mask5Bit)), 6), Second);
+                __m256i Three        = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(First, _mm256_set1_epi32(UTF8Mask4Bit)), 12), _mm256_slli_epi32(Second, 6)), Third);
+                __m256i Decoded      = _mm256_blendv_epi8(Two, Three, _mm256_cmpgt_epi32(First, ThreeLead));
+                Decoded              = _mm256_blendv_epi8(Decoded, First, _mm256_cmpgt_epi32(ASCIIEnd, First));
+                __m256i IsContinue   = _mm256_cmpeq_epi32(_mm256_and_si256(First, HeaderMask), Continuation);
+                uint32_t Leads       = ~((uint32_t) _mm256_movemask_ps(_mm256_castsi256_ps(IsContinue))) & 0xFF;
+                __m256i Compact      = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128((long long) UTF8Decode_Compact[Leads]));
+                _mm256_storeu_si256((__m256i *) &Destination[Written], _mm256_permutevar8x32_epi32(Decoded, Compact));
+                Written             += (size_t) _mm_popcnt_u32(Leads);
+            }
+            CodeUnit                += 16;
+            while ((CodeUnits[CodeUnit] & 0xC0) == UTF8Header_Contine) { // The last sequence may run up to 2 past the block
+                CodeUnit            += 1;
+            }
+        }
+        return Written + UTF8_WriteUTF32_Portable(&CodeUnits[CodeUnit], NumCodeUnits - CodeUnit, &Destination[Written]);
+    }
+
+    PlatformIO_TargetFeatures("avx2")
+    static size_t UTF16_CountUTF32_AVX2(const uint16_t *CodeUnits, size_t NumCodeUnits) {
+        const __m256i HighMask       = _mm256_set1_epi16((short) 0xF800);
+        const __m256i Surrogate      = _mm256_set1_epi16((short) UTF16HighSurrogateStart);
+        size_t NumCodePoints         = 0;
+        size_t CodeUnit              = 0;
+        while (NumCodeUnits - CodeUnit >= 16) {
+            __m256i Input            = _mm256_loadu_si256((const __m256i *) &CodeUnits[CodeUnit]);
+            if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(Input, HighMask), Surrogate)) == 0) {
+                NumCodePoints       += 16;
+                CodeUnit            += 16;
+            } else {
+                size_t BlockEnd      = CodeUnit + 16;
+                while (CodeUnit < BlockEnd) {
+                    UTF16_DecodeLenient(CodeUnits, NumCodeUnits, &CodeUnit);
+                    NumCodePoints   += 1;
+                }
+            }
+        }
+        return NumCodePoints + UTF16_CountUTF32_Portable(&CodeUnits[CodeUnit], NumCodeUnits - CodeUnit);
+    }
+
+    PlatformIO_TargetFeatures("avx2")
+    static size_t UTF16_WriteUTF32_AVX2(const uint16_t *CodeUnits, size_t NumCodeUnits, uint32_t *Destination) {
+        const __m256i HighMask       = _mm256_set1_epi16((short) 0xF800);
+        const __m256i Surrogate      = _mm256_set1_epi16((short) UTF16HighSurrogateStart);
+        size_t Written               = 0;
+        size_t CodeUnit              = 0;
+        while (NumCodeUnits - CodeUnit >= 16) {
+            __m256i Input            = _mm256_loadu_si256((const __m256i *) &CodeUnits[CodeUnit]);
+            if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(Input, HighMask), Surrogate)) == 0) {
+                _mm256_storeu_si256((__m256i *) &Destination[Written],     _mm256_cvtepu16_epi32(_mm256_castsi256_si128(Input)));
+                _mm256_storeu_si256((__m256i *) &Destination[Written + 8], _mm256_cvtepu16_epi32(_mm256_extracti128_si256(Input, 1)));
+                Written             += 16;
+                CodeUnit            += 16;
+            } else {
+                size_t BlockEnd      = CodeUnit + 16;
+                while (CodeUnit < BlockEnd) {
+                    Destination[Written] = UTF16_DecodeLenient(CodeUnits, NumCodeUnits, &CodeUnit);
+                    Written         += 1;
+                }
+            }
+        }
+        return Written + UTF16_WriteUTF32_Portable(&CodeUnits[CodeUnit], NumCodeUnits - CodeUnit, &Destination[Written]);
+    }
+
+    /* Lanes holding a surrogate or anything past U+10FFFF need UTF32_Sanitize, so those blocks go one code point at a time */
+    PlatformIO_TargetFeatures("avx2")
+    static bool UTF32_HasUnencodable_AVX2(__m256i CodePoints) {
+        __m256i TooLarge             = _mm256_cmpeq_epi32(_mm256_max_epu32(CodePoints, _mm256_set1_epi32(UnicodeMaxCodePoint + 1)), CodePoints);
+        __m256i IsSurrogate          = _mm256_cmpeq_epi32(_mm256_and_si256(CodePoints, _mm256_set1_epi32((int) 0xFFFFF800)), _mm256_set1_epi32(UTF16HighSurrogateStart));
+        return _mm256_testz_si256(_mm256_or_si256(TooLarge, IsSurrogate), _mm256_or_si256(TooLarge, IsSurrogate)) == 0;
+    }
+
+    PlatformIO_TargetFeatures("avx2")
+    static size_t UTF32_CountUTF8_AVX2(const uint32_t *CodePoints, size_t NumCodePoints) {
+        const __m256i One            = _mm256_set1_epi32(1);
+        __m256i Sums                 = _mm256_setzero_si256();
+        size_t  NumCodeUnits         = 0;
+        size_t  CodePoint            = 0;
+        while (NumCodePoints - CodePoint >= 8) {
+            __m256i Input            = _mm256_loadu_si256((const __m256i *) &CodePoints[CodePoint]);
+            if (UTF32_HasUnencodable_AVX2(Input)) {
+                NumCodeUnits        += UTF32_CountUTF8_Portable(&CodePoints[CodePoint], 8);
+            } else {
+                __m256i Longer       = _mm256_add_epi32(_mm256_add_epi32(_mm256_cmpgt_epi32(Input, _mm256_set1_epi32(0x7F)), _mm256_cmpgt_epi32(Input, _mm256_set1_epi32(0x7FF))), _mm256_cmpgt_epi32(Input, _mm256_set1_epi32(UTF16MaxCodeUnitValue)));
+                Sums                 = _mm256_add_epi32(Sums, _mm256_sub_epi32(One, Longer)); // The compares are -1 where true
+            }
+            CodePoint               += 8;
+        }
+        __m128i Folded               = _mm_add_epi32(_mm256_castsi256_si128(Sums), _mm256_extracti128_si256(Sums, 1));
+        Folded                       = _mm_add_epi32(Folded, _mm_shuffle_epi32(Folded, _MM_SHUFFLE(1, 0, 3, 2)));
+        Folded                       = _mm_add_epi32(Folded, _mm_shuffle_epi32(Folded, _MM_SHUFFLE(2, 3, 0, 1)));
+        NumCodeUnits                += (uint32_t) _mm_cvtsi128_si32(Folded);
+        return NumCodeUnits + UTF32_CountUTF8_Portable(&CodePoints[CodePoint], NumCodePoints - CodePoint);
+    }
+
+    /*
+     8 code points at a time: each lane is encoded in place as 1 to 3 code units in output order,
+     then each half is packed with UTF8Encode_Compact and stored 16 bytes wide.
+     Blocks past the BMP, or with anything UTF32_Sanitize would change, are encoded one code point at a time.
+     The 24 code point margin keeps the 16 byte stores inside the size the count kernel gave.
+     */
+    PlatformIO_TargetFeatures("avx2,popcnt")
+    static size_t UTF32_WriteUTF8_AVX2(const uint32_t *CodePoints, size_t NumCodePoints, uint8_t *Destination) {
+        const __m256i Mask6Bit       = _mm256_set1_epi32(UTF8Mask6Bit);
+        const __m256i Continuation   = _mm256_set1_epi32(UTF8Header_Contine);
+        size_t Written               = 0;
+        size_t CodePoint             = 0;
+        while (NumCodePoints - CodePoint >= 24) {
+            __m256i Input            = _mm256_loadu_si256((const __m256i *) &CodePoints[CodePoint]);
+            __m256i IsTwo            = _mm256_cmpgt_epi32(Input, _mm256_set1_epi32(0x7F));
+            __m256i IsThree          = _mm256_cmpgt_epi32(Input, _mm256_set1_epi32(0x7FF));
+            if (UTF32_HasUnencodable_AVX2(Input) || _mm256_movemask_epi8(_mm256_cmpgt_epi32(Input, _mm256_set1_epi32(UTF16MaxCodeUnitValue))) != 0) {
+                Written             += UTF32_WriteUTF8_Portable(&CodePoints[CodePoint], 8, &Destination[Written]);
+                CodePoint           += 8;
+                continue;
+            } else if (_mm256_movemask_epi8(IsTwo) == 0) {
+                __m128i Packed       = _mm_packus_epi32(_mm256_castsi256_si128(Input), _mm256_extracti128_si256(Input, 1));
+                _mm_storel_epi64((__m128i *) &Destination[Written], _mm_packus_epi16(Packed, Packed));
+                Written             += 8;
+                CodePoint           += 8;
+                continue;
+            }
+            __m256i Low              = _mm256_slli_epi32(_mm256_or_si256(Continuation, _mm256_and_si256(Input, Mask6Bit)), 8);
+            __m256i Middle           = _mm256_or_si256(Continuation, _mm256_and_si256(_mm256_srli_epi32(Input, 6), Mask6Bit));
+            __m256i Two              = _mm256_or_si256(_mm256_or_si256(_mm256_set1_epi32(UTF8Header_2CodeUnits), _mm256_srli_epi32(Input, 6)), Low);
+            __m256i Three            = _mm256_or_si256(_mm256_or_si256(_mm256_set1_epi32(UTF8Header_3CodeUnits), _mm256_srli_epi32(Input, 12)), _mm256_or_si256(_mm256_slli_epi32(Middle, 8), _mm256_slli_epi32(Low, 8)));
+            __m256i Encoded          = _mm256_blendv_epi8(Input, _mm256_blendv_epi8(Two, Three, IsThree), IsTwo);
+            uint32_t TwoMask         = (uint32_t) _mm256_movemask_ps(_mm256_castsi256_ps(IsTwo));
+            uint32_t ThreeMask       = (uint32_t) _mm256_movemask_ps(_mm256_castsi256_ps(IsThree));
+            for (uint8_t Half = 0; Half < 2; Half++) {
+                __m128i Lanes        = Half == 0 ? _mm256_castsi256_si128(Encoded) : _mm256_extracti128_si256(Encoded, 1);
+                uint32_t Two4        = (TwoMask >> (Half * 4)) & 0xF;
+                uint32_t Three4      = (ThreeMask >> (Half * 4)) & 0xF;
+                __m128i Control      = _mm_loadu_si128((const __m128i *) UTF8Encode_Compact[UTF8Encode_Base3[Two4] + UTF8Encode_Base3[Three4]]);
+                _mm_storeu_si128((__m128i *) &Destination[Written], _mm_shuffle_epi8(Lanes, Control));
+                Written             += 4 + (size_t) _mm_popcnt_u32(Two4) + (size_t) _mm_popcnt_u32(Three4);
+            }
+            CodePoint               += 8;
+        }
+        return Written + UTF32_WriteUTF8_Portable(&CodePoints[CodePoint], NumCodePoints - CodePoint, &Destination[Written]);
+    }
+
+    PlatformIO_TargetFeatures("avx2")
+    static size_t UTF32_CountUTF16_AVX2(const uint32_t *CodePoints, size_t NumCodePoints) {
+        const __m256i One            = _mm256_set1_epi32(1);
+        __m256i Sums                 = _mm256_setzero_si256();
+        size_t  NumCodeUnits         = 0;
+        size_t  CodePoint            = 0;
+        while (NumCodePoints - CodePoint >= 8) {
+            __m256i Input            = _mm256_loadu_si256((const __m256i *) &CodePoints[CodePoint]);
+            if (UTF32_HasUnencodable_AVX2(Input)) {
+                NumCodeUnits        += UTF32_CountUTF16_Portable(&CodePoints[CodePoint], 8);
+            } else {
+                Sums                 = _mm256_sub_epi32(_mm256_add_epi32(Sums, One), _mm256_cmpgt_epi32(Input, _mm256_set1_epi32(UTF16MaxCodeUnitValue)));
+            }
+            CodePoint               += 8;
+        }
+        __m128i Folded               = _mm_add_epi32(_mm256_castsi256_si128(Sums), _mm256_extracti128_si256(Sums, 1));
+        Folded                       = _mm_add_epi32(Folded, _mm_shuffle_epi32(Folded, _MM_SHUFFLE(1, 0, 3, 2)));
+        Folded                       = _mm_add_epi32(Folded, _mm_shuffle_epi32(Folded, _MM_SHUFFLE(2, 3, 0, 1)));
+        NumCodeUnits                += (uint32_t) _mm_cvtsi128_si32(Folded);
+        return NumCodeUnits + UTF32_CountUTF16_Portable(&CodePoints[CodePoint], NumCodePoints - CodePoint);
+    }
+
+    PlatformIO_TargetFeatures("avx2")
+    static size_t UTF32_WriteUTF16_AVX2(const uint32_t *CodePoints, size_t NumCodePoints, uint16_t *Destination) {
+        size_t Written               = 0;
+        size_t CodePoint             = 0;
+        while (NumCodePoints - CodePoint >= 8) {
+            __m256i Input            = _mm256_loadu_si256((const __m256i *) &CodePoints[CodePoint]);
+            if (UTF32_HasUnencodable_AVX2(Input) || _mm256_movemask_epi8(_mm256_cmpgt_epi32(Input, _mm256_set1_epi32(UTF16MaxCodeUnitValue))) != 0) {
+                Written             += UTF32_WriteUTF16_Portable(&CodePoints[CodePoint], 8, &Destination[Written]);
+            } else {
+                _mm_storeu_si128((__m128i *) &Destination[Written], _mm_packus_epi32(_mm256_castsi256_si128(Input), _mm256_extracti128_si256(Input, 1)));
+                Written             += 8;
+            }
+            CodePoint               += 8;
+        }
+        return Written + UTF32_WriteUTF16_Portable(&CodePoints[CodePoint], NumCodePoints - CodePoint, &Destination[Written]);
+    }
+
+    static const StringIO_Transcoders StringIO_Transcoders_AVX2 = {
+        .UTF8_CountUTF16             = UTF8_CountUTF16_AVX2,
+        .UTF8_WriteUTF16             = UTF8_WriteUTF16_AVX2,
+        .UTF16_CountUTF8             = UTF16_CountUTF8_AVX2,
+        .UTF16_WriteUTF8             = UTF16_WriteUTF8_AVX2,
+        .UTF8_CountValidUTF32        = UTF8_CountValidUTF32_AVX2,
+        .UTF8_WriteValidUTF32        = UTF8_WriteValidUTF32_AVX2,
+        .UTF16_CountUTF32            = UTF16_CountUTF32_AVX2,
+        .UTF16_WriteUTF32            = UTF16_WriteUTF32_AVX2,
+        .UTF32_CountUTF8             = UTF32_CountUTF8_AVX2,
+        .UTF32_WriteUTF8             = UTF32_WriteUTF8_AVX2,
+        .UTF32_CountUTF16            = UTF32_CountUTF16_AVX2,
+        .UTF32_WriteUTF16            = UTF32_WriteUTF16_AVX2,
+    };
+#endif /* PlatformIO_ArchIsAMD64 */
+
+    /* Chosen once from the CPU's SIMD extensions, see StringIO_GetKernels */
+    typedef struct StringIO_Kernels {
+        UTF8_Validator              ValidateUTF8;
+        const StringIO_Transcoders *Transcoders;
+    } StringIO_Kernels;
+
+    static StringIO_Kernels StringIO_SelectedKernels;
+
+    static void StringIO_SelectKernels(void) {
+        UTF8_Validator              Validator   = UTF8_IsValid_Portable;
+        const StringIO_Transcoders *Transcoders = &StringIO_Transcoders_Portable;
+#if (PlatformIO_Architecture == PlatformIO_ArchIsAMD64)
+        PlatformIO_SIMDExtensions Extensions = PlatformIO_GetSIMDExtensions();
+        if ((Extensions & SIMDExtension_AVX2) == SIMDExtension_AVX2) {
+            Validator                           = UTF8_IsValid_AVX2;
+            Transcoders                         = &StringIO_Transcoders_AVX2;
+        } else if ((Extensions & SIMDExtension_SSSE3) == SIMDExtension_SSSE3) {
+            Validator                           = UTF8_IsValid_SSSE3;
+        }
+#endif /* PlatformIO_ArchIsAMD64 */
+        StringIO_SelectedKernels.ValidateUTF8   = Validator;
+        StringIO_SelectedKernels.Transcoders    = Transcoders;
+    }
+
+#if PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+    static BOOL CALLBACK StringIO_SelectKernels_Once(PINIT_ONCE Once, PVOID Parameter, PVOID *Context) {
+        StringIO_SelectKernels();
+        return TRUE;
+    }
+#endif /* PlatformIO_TargetOS */
+
+    static const StringIO_Kernels *StringIO_GetKernels(void) { // Selected exactly once, the once primitive publishes the choice to every thread
+#if   PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsPOSIX)
+        static pthread_once_t Once = PTHREAD_ONCE_INIT;
+        pthread_once(&Once, StringIO_SelectKernels);
+#elif PlatformIO_Is(PlatformIO_TargetOS, PlatformIO_TargetOSIsWindows)
+        static INIT_ONCE      Once = INIT_ONCE_STATIC_INIT;
+        InitOnceExecuteOnce(&Once, StringIO_SelectKernels_Once, NULL, NULL);
+#endif /* PlatformIO_TargetOS */
+        return &StringIO_SelectedKernels;
+    }
+
+    static const StringIO_Transcoders *StringIO_GetTranscoders(void) {
+        return StringIO_GetKernels()->Transcoders;
+    }
+
+    static bool StringIO_ValidateUTF8(const uint8_t *CodeUnits, size_t NumCodeUnits) {
+        return StringIO_GetKernels()->ValidateUTF8(CodeUnits, NumCodeUnits);
+    }
+
+    size_t UTF8_ConvertInto(PlatformIO_Immutable(UTF8 *) String, UTF16 *Destination, size_t Capacity) {
         AssertIO(String != NULL);
-        size_t   UTF8CodeUnits                     = UTF32_GetStringSizeInUTF8CodeUnits(String);
-        UTF8    *EncodedString                     = UTF8_Init(UTF8CodeUnits);
-        size_t   CodePoint                         = 0ULL;
-        size_t   CodeUnit                          = 0ULL;
-        uint8_t  Index                             = 0;
-        AssertIO(EncodedString != NULL);
-        while (String[CodePoint] != TextIO_NULLTerminator) {
-            UTF8_EncodeCodePoint(String[CodePoint]);
-            for (uint8_t CodeUnit2 = 0; CodeUnit2 < UTF32_GetCodePointSizeInUTF8CodeUnits(String[CodePoint]); CodeUnit2++) {
-                EncodedString[CodeUnit]        = StringIO_PreallocateCodePoint_UTF8[Index];
+        AssertIO(Destination != NULL || Capacity == 0);
+        const StringIO_Transcoders *Transcoders = StringIO_GetTranscoders();
+        const uint8_t *CodeUnits     = (const uint8_t *) String;
+        size_t NumCodeUnits          = strlen((const char *) String);
+        size_t NumUTF16              = 0;
+        if (Capacity > NumCodeUnits) { // UTF-16 never needs more code units than UTF-8, so skip the sizing pass
+            NumUTF16                 = Transcoders->UTF8_WriteUTF16(CodeUnits, NumCodeUnits, (uint16_t *) Destination);
+            Destination[NumUTF16]    = TextIO_NULLTerminator;
+        } else {
+            NumUTF16                 = Transcoders->UTF8_CountUTF16(CodeUnits, NumCodeUnits);
+            if (Capacity > NumUTF16) {
+                Transcoders->UTF8_WriteUTF16(CodeUnits, NumCodeUnits, (uint16_t *) Destination);
+                Destination[NumUTF16] = TextIO_NULLTerminator;
             }
-            CodePoint += 1;
         }
-        return EncodedString;
+        return NumUTF16;
     }
-    
-    UTF16 *UTF16_Encode(PlatformIO_Immutable(UTF32 *) String) {
+
+    size_t UTF16_ConvertInto(PlatformIO_Immutable(UTF16 *) String, UTF8 *Destination, size_t Capacity) {
         AssertIO(String != NULL);
-        UTF16   *EncodedString                       = NULL;
-        size_t   CodePoint                           = 0ULL;
-        size_t   CodeUnit                            = 0ULL;
-        size_t   NumCodeUnits                        = UTF32_GetStringSizeInUTF16CodeUnits(String);
-        EncodedString                                = UTF16_Init(NumCodeUnits);
-        AssertIO(EncodedString != NULL);
-        // This is kinda dumb... just call UTF16_EncodeCodePoint for each UTF32 codepoint
-        while (String[CodePoint] != TextIO_NULLTerminator) {
-            UTF16_EncodeCodePoint(String[CodePoint]);
-            for (uint8_t CodeUnit2 = 0; CodeUnit2 < UTF32_GetCodePointSizeInUTF16CodeUnits(String[CodePoint]); CodeUnit2++) {
-                EncodedString[CodeUnit] = StringIO_PreallocateCodePoint_UTF16[CodeUnit2];
+        AssertIO(Destination != NULL || Capacity == 0);
+        const StringIO_Transcoders *Transcoders = StringIO_GetTranscoders();
+        const uint16_t *CodeUnits    = (const uint16_t *) String;
+        size_t NumCodeUnits          = UTF16_GetNumCodeUnits(String);
+        size_t NumUTF8               = 0;
+        if (Capacity > NumCodeUnits * 3) { // A UTF-16 code unit never needs more than 3 UTF-8 code units
+            NumUTF8                  = Transcoders->UTF16_WriteUTF8(CodeUnits, NumCodeUnits, (uint8_t *) Destination);
+            Destination[NumUTF8]     = TextIO_NULLTerminator;
+        } else {
+            NumUTF8                  = Transcoders->UTF16_CountUTF8(CodeUnits, NumCodeUnits);
+            if (Capacity > NumUTF8) {
+                Transcoders->UTF16_WriteUTF8(CodeUnits, NumCodeUnits, (uint8_t *) Destination);
+                Destination[NumUTF8] = TextIO_NULLTerminator;
             }
-            CodePoint += 1;
         }
-        return EncodedString;
+        return NumUTF8;
     }
-    
+
     UTF8 *UTF16_Convert(PlatformIO_Immutable(UTF16 *) String) {
         AssertIO(String != NULL);
-        UTF8 *String8       = NULL;
-        UTF32 *String32 = UTF16_Decode(String);
-        String8         = UTF8_Encode(String32);
-        UTF32_Deinit(String32);
+        const StringIO_Transcoders *Transcoders = StringIO_GetTranscoders();
+        size_t NumCodeUnits          = UTF16_GetNumCodeUnits(String);
+        size_t NumUTF8               = Transcoders->UTF16_CountUTF8((const uint16_t *) String, NumCodeUnits);
+        UTF8  *String8               = UTF8_Init(NumUTF8);
+        AssertIO(String8 != NULL);
+        Transcoders->UTF16_WriteUTF8((const uint16_t *) String, NumCodeUnits, (uint8_t *) String8);
+        String8[NumUTF8]             = TextIO_NULLTerminator;
         return String8;
     }
     
     UTF16 *UTF8_Convert(PlatformIO_Immutable(UTF8 *) String) {
         AssertIO(String != NULL);
-        UTF16 *String16     = NULL;
-        UTF32 *String32 = UTF8_Decode(String);
-        String16        = UTF16_Encode(String32);
-        UTF32_Deinit(String32);
+        const StringIO_Transcoders *Transcoders = StringIO_GetTranscoders();
+        size_t NumCodeUnits          = strlen((const char *) String);
+        size_t NumUTF16              = Transcoders->UTF8_CountUTF16((const uint8_t *) String, NumCodeUnits);
+        UTF16 *String16              = UTF16_Init(NumUTF16);
+        AssertIO(String16 != NULL);
+        Transcoders->UTF8_WriteUTF16((const uint8_t *) String, NumCodeUnits, (uint16_t *) String16);
+        String16[NumUTF16]           = TextIO_NULLTerminator;
         return String16;
     }
     
+    UTF32 *UTF8_Decode(PlatformIO_Immutable(UTF8 *) String) {
+        AssertIO(String != NULL);
+        const StringIO_Transcoders *Transcoders = StringIO_GetTranscoders();
+        const uint8_t *CodeUnits     = (const uint8_t *) String;
+        size_t  NumCodeUnits         = strlen((const char *) String);
+        bool    IsValid              = NumCodeUnits == 0 || StringIO_ValidateUTF8(CodeUnits, NumCodeUnits);
+        size_t  NumCodePoints        = IsValid ? Transcoders->UTF8_CountValidUTF32(CodeUnits, NumCodeUnits) : UTF8_CountUTF32_Portable(CodeUnits, NumCodeUnits);
+        UTF32  *Decoded              = UTF32_Init(NumCodePoints);
+        AssertIO(Decoded != NULL);
+        if (IsValid) {
+            Transcoders->UTF8_WriteValidUTF32(CodeUnits, NumCodeUnits, (uint32_t *) Decoded);
+        } else {
+            UTF8_WriteUTF32_Portable(CodeUnits, NumCodeUnits, (uint32_t *) Decoded);
+        }
+        Decoded[NumCodePoints]       = TextIO_NULLTerminator;
+        return Decoded;
+    }
+    
+    UTF32 *UTF16_Decode(PlatformIO_Immutable(UTF16 *) String) {
+        AssertIO(String != NULL);
+        const StringIO_Transcoders *Transcoders = StringIO_GetTranscoders();
+        size_t  NumCodeUnits         = UTF16_GetNumCodeUnits(String);
+        size_t  NumCodePoints        = Transcoders->UTF16_CountUTF32((const uint16_t *) String, NumCodeUnits);
+        UTF32  *Decoded              = UTF32_Init(NumCodePoints);
+        AssertIO(Decoded != NULL);
+        Transcoders->UTF16_WriteUTF32((const uint16_t *) String, NumCodeUnits, (uint32_t *) Decoded);
+        Decoded[NumCodePoints]       = TextIO_NULLTerminator;
+        return Decoded;
+    }
+    
+    UTF8 *UTF8_Encode(PlatformIO_Immutable(UTF32 *) String) {
+        AssertIO(String != NULL);
+        const StringIO_Transcoders *Transcoders = StringIO_GetTranscoders();
+        size_t  NumCodePoints        = UTF32_GetNumCodePoints(String);
+        size_t  NumCodeUnits         = Transcoders->UTF32_CountUTF8((const uint32_t *) String, NumCodePoints);
+        UTF8   *Encoded              = UTF8_Init(NumCodeUnits);
+        AssertIO(Encoded != NULL);
+        Transcoders->UTF32_WriteUTF8((const uint32_t *) String, NumCodePoints, (uint8_t *) Encoded);
+        Encoded[NumCodeUnits]        = TextIO_NULLTerminator;
+        return Encoded;
+    }
+    
+    UTF16 *UTF16_Encode(PlatformIO_Immutable(UTF32 *) String) {
+        AssertIO(String != NULL);
+        const StringIO_Transcoders *Transcoders = StringIO_GetTranscoders();
+        size_t  NumCodePoints        = UTF32_GetNumCodePoints(String);
+        size_t  NumCodeUnits         = Transcoders->UTF32_CountUTF16((const uint32_t *) String, NumCodePoints);
+        UTF16  *Encoded              = UTF16_Init(NumCodeUnits);
+        AssertIO(Encoded != NULL);
+        Transcoders->UTF32_WriteUTF16((const uint32_t *) String, NumCodePoints, (uint16_t *) Encoded);
+        Encoded[NumCodeUnits]        = TextIO_NULLTerminator;
+        return Encoded;
+    }
+
+    size_t UTF8_DecodeInto(PlatformIO_Immutable(UTF8 *) String, UTF32 *Destination, size_t Capacity) {
+        AssertIO(String != NULL);
+        AssertIO(Destination != NULL || Capacity == 0);
+        const StringIO_Transcoders *Transcoders = StringIO_GetTranscoders();
+        const uint8_t *CodeUnits     = (const uint8_t *) String;
+        size_t  NumCodeUnits         = strlen((const char *) String);
+        bool    IsValid              = NumCodeUnits == 0 || StringIO_ValidateUTF8(CodeUnits, NumCodeUnits);
+        size_t  NumCodePoints        = 0;
+        if (Capacity <= NumCodeUnits) { // A code unit never decodes to more than one code point, so only size when it might not fit
+            NumCodePoints            = IsValid ? Transcoders->UTF8_CountValidUTF32(CodeUnits, NumCodeUnits) : UTF8_CountUTF32_Portable(CodeUnits, NumCodeUnits);
+            if (Capacity <= NumCodePoints) {
+                return NumCodePoints;
+            }
+        }
+        if (IsValid) {
+            NumCodePoints            = Transcoders->UTF8_WriteValidUTF32(CodeUnits, NumCodeUnits, (uint32_t *) Destination);
+        } else {
+            NumCodePoints            = UTF8_WriteUTF32_Portable(CodeUnits, NumCodeUnits, (uint32_t *) Destination);
+        }
+        Destination[NumCodePoints]   = TextIO_NULLTerminator;
+        return NumCodePoints;
+    }
+
+    size_t UTF16_DecodeInto(PlatformIO_Immutable(UTF16 *) String, UTF32 *Destination, size_t Capacity) {
+        AssertIO(String != NULL);
+        AssertIO(Destination != NULL || Capacity == 0);
+        const StringIO_Transcoders *Transcoders = StringIO_GetTranscoders();
+        const uint16_t *CodeUnits    = (const uint16_t *) String;
+        size_t  NumCodeUnits         = UTF16_GetNumCodeUnits(String);
+        if (Capacity <= NumCodeUnits) {
+            size_t NumCodePoints     = Transcoders->UTF16_CountUTF32(CodeUnits, NumCodeUnits);
+            if (Capacity <= NumCodePoints) {
+                return NumCodePoints;
+            }
+        }
+        size_t  NumCodePoints        = Transcoders->UTF16_WriteUTF32(CodeUnits, NumCodeUnits, (uint32_t *) Destination);
+        Destination[NumCodePoints]   = TextIO_NULLTerminator;
+        return NumCodePoints;
+    }
+
+    size_t UTF8_EncodeInto(PlatformIO_Immutable(UTF32 *) String, UTF8 *Destination, size_t Capacity) {
+        AssertIO(String != NULL);
+        AssertIO(Destination != NULL || Capacity == 0);
+        const StringIO_Transcoders *Transcoders = StringIO_GetTranscoders();
+        const uint32_t *CodePoints   = (const uint32_t *) String;
+        size_t  NumCodePoints        = UTF32_GetNumCodePoints(String);
+        if (Capacity <= NumCodePoints * UTF8MaxCodeUnitsInCodePoint) {
+            size_t NumCodeUnits      = Transcoders->UTF32_CountUTF8(CodePoints, NumCodePoints);
+            if (Capacity <= NumCodeUnits) {
+                return NumCodeUnits;
+            }
+        }
+        size_t  NumCodeUnits         = Transcoders->UTF32_WriteUTF8(CodePoints, NumCodePoints, (uint8_t *) Destination);
+        Destination[NumCodeUnits]    = TextIO_NULLTerminator;
+        return NumCodeUnits;
+    }
+
+    size_t UTF16_EncodeInto(PlatformIO_Immutable(UTF32 *) String, UTF16 *Destination, size_t Capacity) {
+        AssertIO(String != NULL);
+        AssertIO(Destination != NULL || Capacity == 0);
+        const StringIO_Transcoders *Transcoders = StringIO_GetTranscoders();
+        const uint32_t *CodePoints   = (const uint32_t *) String;
+        size_t  NumCodePoints        = UTF32_GetNumCodePoints(String);
+        if (Capacity <= NumCodePoints * UTF16MaxCodeUnitsInCodePoint) {
+            size_t NumCodeUnits      = Transcoders->UTF32_CountUTF16(CodePoints, NumCodePoints);
+            if (Capacity <= NumCodeUnits) {
+                return NumCodeUnits;
+            }
+        }
+        size_t  NumCodeUnits         = Transcoders->UTF32_WriteUTF16(CodePoints, NumCodePoints, (uint16_t *) Destination);
+        Destination[NumCodeUnits]    = TextIO_NULLTerminator;
+        return NumCodeUnits;
+    }
+
     UTF8 *UTF8_Clone(PlatformIO_Immutable(UTF8 *) String) {
         AssertIO(String != NULL);
         UTF8 *Copy = NULL;
@@ -1671,51 +2942,27 @@ CodePoint.CodeUnits[3] = String[3];
     
     UTF32 UTF8_ReadCodePoint(FILE *Source) {
         AssertIO(Source != NULL);
-        UTF32 CodePoint         = 0;
-        UTF8_Clear_Preallocated();
-        UTF8 HeaderCodeUnit = UTF8_ReadCodeUnit(Source);
-        StringIO_PreallocateCodePoint_UTF8[0] = HeaderCodeUnit;
-        switch (UTF8_GetCodePointSizeInCodeUnits(HeaderCodeUnit)) {
-            case 4:
-                // Read the following 3 CodeUnits and decode them all
-                FileIO_Read(Source, &StringIO_PreallocateCodePoint_UTF8[1], sizeof(UTF8), 1);
-                FileIO_Read(Source, &StringIO_PreallocateCodePoint_UTF8[2], sizeof(UTF8), 1);
-                FileIO_Read(Source, &StringIO_PreallocateCodePoint_UTF8[3], sizeof(UTF8), 1);
-                break;
-            case 3:
-                FileIO_Read(Source, &StringIO_PreallocateCodePoint_UTF8[1], sizeof(UTF8), 1);
-                FileIO_Read(Source, &StringIO_PreallocateCodePoint_UTF8[2], sizeof(UTF8), 1);
-                break;
-            case 2:
-                FileIO_Read(Source, &StringIO_PreallocateCodePoint_UTF8[1], sizeof(UTF8), 1);
-                break;
+        uint8_t CodeUnits[UTF8MaxCodeUnitsInCodePoint] = {0};
+        size_t  CodeUnit        = 0;
+        size_t  NumCodeUnits    = 1;
+        CodeUnits[0]            = (uint8_t) UTF8_ReadCodeUnit(Source);
+        if (CodeUnits[0] >= UTF8Header_2CodeUnits) {
+            size_t Expected     = CodeUnits[0] >= UTF8Header_4CodeUnits ? 3 : CodeUnits[0] >= UTF8Header_3CodeUnits ? 2 : 1;
+            NumCodeUnits       += FileIO_Read(Source, &CodeUnits[1], sizeof(UTF8), Expected);
         }
-        CodePoint           = UTF8_Decode(&StringIO_PreallocateCodePoint_UTF8[0]);
-        return CodePoint;
+        return UTF8_DecodeLenient(CodeUnits, NumCodeUnits, &CodeUnit);
     }
     
     UTF32 UTF16_ReadCodePoint(FILE *Source) {
         AssertIO(Source != NULL);
-        UTF32 CodePoint          = 0;
-        UTF16_Clear_Preallocated();
-        UTF16 HeaderCodeUnit = UTF16_ReadCodeUnit(Source);
-        StringIO_PreallocateCodePoint_UTF16[0] = HeaderCodeUnit;
-        switch (UTF16_GetCodePointSizeInCodeUnits(HeaderCodeUnit)) {
-            case 4:
-                FileIO_Read(Source, &StringIO_PreallocateCodePoint_UTF16[1], sizeof(UTF16), 1);
-                FileIO_Read(Source, &StringIO_PreallocateCodePoint_UTF16[2], sizeof(UTF16), 1);
-                FileIO_Read(Source, &StringIO_PreallocateCodePoint_UTF16[3], sizeof(UTF16), 1);
-                break;
-            case 3:
-                FileIO_Read(Source, &StringIO_PreallocateCodePoint_UTF16[1], sizeof(UTF16), 1);
-                FileIO_Read(Source, &StringIO_PreallocateCodePoint_UTF16[2], sizeof(UTF16), 1);
-                break;
-            case 2:
-                FileIO_Read(Source, &StringIO_PreallocateCodePoint_UTF16[1], sizeof(UTF16), 1);
-                break;
+        uint16_t CodeUnits[UTF16MaxCodeUnitsInCodePoint] = {0};
+        size_t   CodeUnit       = 0;
+        size_t   NumCodeUnits   = 1;
+        CodeUnits[0]            = (uint16_t) UTF16_ReadCodeUnit(Source);
+        if (CodeUnits[0] >= UTF16HighSurrogateStart && CodeUnits[0] <= UTF16HighSurrogateEnd) {
+            NumCodeUnits       += FileIO_Read(Source, &CodeUnits[1], sizeof(UTF16), 1);
         }
-        CodePoint         = UTF16_Decode(&StringIO_PreallocateCodePoint_UTF16[0]);
-        return CodePoint;
+        return UTF16_DecodeLenient(CodeUnits, NumCodeUnits, &CodeUnit);
     }
     
     UTF32 UTF32_ReadCodePoint(FILE *Source) {
@@ -2607,6 +3854,42 @@ CodePoint.CodeUnits[3] = String[3];
         return CaseFoldedString;
     }
     
+    size_t UTF8_CaseFoldInto(PlatformIO_Immutable(UTF8 *) String, UTF8 *Destination, size_t Capacity) {
+        AssertIO(String != NULL);
+        AssertIO(Destination != NULL || Capacity == 0);
+        UTF8  *CaseFolded     = UTF8_CaseFold(String);
+        size_t CaseFoldedSize = UTF8_GetStringSizeInCodeUnits(CaseFolded);
+        if (Capacity > CaseFoldedSize) {
+            memcpy(Destination, CaseFolded, (CaseFoldedSize + 1) * sizeof(UTF8));
+        }
+        UTF8_Deinit(CaseFolded);
+        return CaseFoldedSize;
+    }
+    
+    size_t UTF16_CaseFoldInto(PlatformIO_Immutable(UTF16 *) String, UTF16 *Destination, size_t Capacity) {
+        AssertIO(String != NULL);
+        AssertIO(Destination != NULL || Capacity == 0);
+        UTF16 *CaseFolded     = UTF16_CaseFold(String);
+        size_t CaseFoldedSize = UTF16_GetStringSizeInCodeUnits(CaseFolded);
+        if (Capacity > CaseFoldedSize) {
+            memcpy(Destination, CaseFolded, (CaseFoldedSize + 1) * sizeof(UTF16));
+        }
+        UTF16_Deinit(CaseFolded);
+        return CaseFoldedSize;
+    }
+    
+    size_t UTF32_CaseFoldInto(PlatformIO_Immutable(UTF32 *) String, UTF32 *Destination, size_t Capacity) {
+        AssertIO(String != NULL);
+        AssertIO(Destination != NULL || Capacity == 0);
+        UTF32 *CaseFolded     = UTF32_CaseFold(String);
+        size_t CaseFoldedSize = UTF32_GetStringSizeInCodePoints(CaseFolded);
+        if (Capacity > CaseFoldedSize) {
+            memcpy(Destination, CaseFolded, (CaseFoldedSize + 1) * sizeof(UTF32));
+        }
+        UTF32_Deinit(CaseFolded);
+        return CaseFoldedSize;
+    }
+    
     static UTF32 *UTF32_Reorder(UTF32 *String) { // Stable sort
         AssertIO(String != NULL);
         size_t   CodePoint  = 1ULL;
@@ -2770,6 +4053,60 @@ CodePoint.CodeUnits[3] = String[3];
         }
         return NormalizedString;
     }
+    
+    size_t UTF8_NormalizeInto(PlatformIO_Immutable(UTF8 *) String, StringIO_NormalizationForms NormalizedForm, UTF8 *Destination, size_t Capacity) {
+        AssertIO(String != NULL);
+        AssertIO(NormalizedForm != NormalizationForm_Unspecified);
+        AssertIO(Destination != NULL || Capacity == 0);
+        UTF8  *Normalized     = UTF8_Normalize(String, NormalizedForm);
+        size_t NormalizedSize = 0;
+        if (Normalized != NULL) {
+            NormalizedSize = UTF8_GetStringSizeInCodeUnits(Normalized);
+            if (Capacity > NormalizedSize) {
+                memcpy(Destination, Normalized, (NormalizedSize + 1) * sizeof(UTF8));
+            }
+            UTF8_Deinit(Normalized);
+        } else if (Capacity > 0) {
+            Destination[0] = TextIO_NULLTerminator;
+        }
+        return NormalizedSize;
+    }
+    
+    size_t UTF16_NormalizeInto(PlatformIO_Immutable(UTF16 *) String, StringIO_NormalizationForms NormalizedForm, UTF16 *Destination, size_t Capacity) {
+        AssertIO(String != NULL);
+        AssertIO(NormalizedForm != NormalizationForm_Unspecified);
+        AssertIO(Destination != NULL || Capacity == 0);
+        UTF16 *Normalized     = UTF16_Normalize(String, NormalizedForm);
+        size_t NormalizedSize = 0;
+        if (Normalized != NULL) {
+            NormalizedSize = UTF16_GetStringSizeInCodeUnits(Normalized);
+            if (Capacity > NormalizedSize) {
+                memcpy(Destination, Normalized, (NormalizedSize + 1) * sizeof(UTF16));
+            }
+            UTF16_Deinit(Normalized);
+        } else if (Capacity > 0) {
+            Destination[0] = TextIO_NULLTerminator;
+        }
+        return NormalizedSize;
+    }
+    
+    size_t UTF32_NormalizeInto(PlatformIO_Immutable(UTF32 *) String, StringIO_NormalizationForms NormalizedForm, UTF32 *Destination, size_t Capacity) {
+        AssertIO(String != NULL);
+        AssertIO(NormalizedForm != NormalizationForm_Unspecified);
+        AssertIO(Destination != NULL || Capacity == 0);
+        UTF32 *Normalized     = UTF32_Normalize(String, NormalizedForm);
+        size_t NormalizedSize = 0;
+        if (Normalized != NULL) {
+            NormalizedSize = UTF32_GetStringSizeInCodePoints(Normalized);
+            if (Capacity > NormalizedSize) {
+                memcpy(Destination, Normalized, (NormalizedSize + 1) * sizeof(UTF32));
+            }
+            UTF32_Deinit(Normalized);
+        } else if (Capacity > 0) {
+            Destination[0] = TextIO_NULLTerminator;
+        }
+        return NormalizedSize;
+    }
     /* TextIOTables Operations */
     
     int64_t UTF8_String2Integer(TextIO_Bases Base, PlatformIO_Immutable(UTF8 *) String) { // Replaces atoi, atol, strtol, strtoul,
@@ -2866,9 +4203,9 @@ CodePoint.CodeUnits[3] = String[3];
         return IntegerString16;
     }
     
-    UTF32 *UTF32_Integer2String(TextIO_Bases Base, int64_t Integer2Convert) {
+    static size_t UTF32_FormatInteger(TextIO_Bases Base, int64_t Integer2Convert, UTF32 String[StringIO_MaxIntegerSize]) {
         AssertIO(PlatformIO_Is(Base, Base_Integer));
-        UTF32   *String               = NULL;
+        AssertIO(String != NULL);
         int64_t  Sign                 = 0LL;
         uint64_t Num                  = AbsoluteI(Integer2Convert);
         uint8_t  Radix                = 1;
@@ -2891,8 +4228,7 @@ CodePoint.CodeUnits[3] = String[3];
 
         NumDigits                    += NumDigitsInInteger(Radix, Integer2Convert);
 
-        String                        = UTF32_Init(NumDigits);
-        AssertIO(String != NULL);
+        AssertIO(NumDigits <= StringIO_MaxIntegerSize);
 
         for (size_t CodePoint = NumDigits; CodePoint > 0; CodePoint--) {
             uint8_t Digit                 = Num % Radix;
@@ -2916,8 +4252,46 @@ CodePoint.CodeUnits[3] = String[3];
                 Radix                     = 16;
             }
         }
+        return NumDigits;
+    }
+
+    UTF32 *UTF32_Integer2String(TextIO_Bases Base, int64_t Integer2Convert) {
+        AssertIO(PlatformIO_Is(Base, Base_Integer));
+        UTF32  Digits[StringIO_MaxIntegerSize] = {0};
+        size_t NumDigits                       = UTF32_FormatInteger(Base, Integer2Convert, Digits);
+        UTF32 *String                          = UTF32_Init(NumDigits);
+        AssertIO(String != NULL);
+        memcpy(String, Digits, NumDigits * sizeof(UTF32));
         return String;
     }
+    
+    size_t UTF8_Integer2StringInto(TextIO_Bases Base, int64_t Integer2Convert, UTF8 *Destination, size_t Capacity) {
+        AssertIO(PlatformIO_Is(Base, Base_Integer));
+        AssertIO(Destination != NULL || Capacity == 0);
+        UTF32  Digits[StringIO_MaxIntegerSize + 1] = {0};
+        UTF32_FormatInteger(Base, Integer2Convert, Digits);
+        return UTF8_EncodeInto(Digits, Destination, Capacity);
+    }
+    
+    size_t UTF16_Integer2StringInto(TextIO_Bases Base, int64_t Integer2Convert, UTF16 *Destination, size_t Capacity) {
+        AssertIO(PlatformIO_Is(Base, Base_Integer));
+        AssertIO(Destination != NULL || Capacity == 0);
+        UTF32  Digits[StringIO_MaxIntegerSize + 1] = {0};
+        UTF32_FormatInteger(Base, Integer2Convert, Digits);
+        return UTF16_EncodeInto(Digits, Destination, Capacity);
+    }
+    
+    size_t UTF32_Integer2StringInto(TextIO_Bases Base, int64_t Integer2Convert, UTF32 *Destination, size_t Capacity) {
+        AssertIO(PlatformIO_Is(Base, Base_Integer));
+        AssertIO(Destination != NULL || Capacity == 0);
+        UTF32  Digits[StringIO_MaxIntegerSize] = {0};
+        size_t NumDigits                       = UTF32_FormatInteger(Base, Integer2Convert, Digits);
+        if (Capacity > NumDigits) {
+            memcpy(Destination, Digits, NumDigits * sizeof(UTF32));
+            Destination[NumDigits]             = TextIO_NULLTerminator;
+        }
+        return NumDigits;
+    }
 
     double UTF8_String2Decimal(TextIO_Bases Base, PlatformIO_Immutable(UTF8 *) String) {
         AssertIO(PlatformIO_Is(Base, Base_Decimal));
@@ -3837,24 +5211,19 @@ CodePoint.CodeUnits[3] = String[3];
         AssertIO(CodePage != CodePage_Unspecified);
         UTF8 *Unicode = NULL;
 
-        UTF32   *Decoded          = UTF8_Decode(String);
-        size_t   Character        = 0ULL;
-        size_t   CodePoint        = 0ULL;
-        size_t   NumCodeUnits     = 0ULL;
         if (CodePage == CodePage_ISO_8859_1) {
-            while (Decoded[Character] != TextIO_NULLTerminator) {
-                size_t NormOffset = UTF32_ShouldCodePointBeNormalized(NormalizationForm_KompatibleCompose, Decoded[Character]);
-                if (NormOffset > -1) {
-                    NumCodeUnits += UTF32_GetCodePointSizeInUTF8CodeUnits(Decoded[Character]);
-                }
-                Character        += 1;
+            UTF32   *Decoded          = UTF8_Decode(String);
+            size_t   NumCodePoints    = UTF32_GetNumCodePoints(Decoded);
+            size_t   NumCodeUnits     = 0ULL;
+            size_t   CodeUnit         = 0ULL;
+            for (size_t Character = 0ULL; Character < NumCodePoints; Character++) {
+                NumCodeUnits         += UTF32_GetCodePointSizeInUTF8CodeUnits(UTF32_Sanitize(Decoded[Character]));
             }
-            Unicode               = UTF8_Init(NumCodeUnits);
-            while (Decoded[Character] != TextIO_NULLTerminator && Unicode[CodePoint] != TextIO_NULLTerminator) {
-                for (uint8_t Byte = 0; Byte < UTF32_GetCodePointSizeInUTF8CodeUnits(Decoded[Character]); Byte++) {
-                    Unicode[CodePoint + Byte] = StringIO_PreallocateCodePoint_UTF8[Byte];
-                }
+            Unicode                   = UTF8_Init(NumCodeUnits);
+            for (size_t Character = 0ULL; Character < NumCodePoints; Character++) {
+                CodeUnit             += UTF8_WriteCodePoint((uint8_t *) &Unicode[CodeUnit], UTF32_Sanitize(Decoded[Character]));
             }
+            UTF32_Deinit(Decoded);
         }
         return Unicode;
     }
@@ -3864,24 +5233,19 @@ CodePoint.CodeUnits[3] = String[3];
         AssertIO(CodePage != CodePage_Unspecified);
         UTF16 *Unicode = NULL;
 
-        UTF32   *Decoded          = UTF16_Decode(String);
-        size_t   Character        = 0ULL;
-        size_t   CodePoint        = 0ULL;
-        size_t   NumCodeUnits     = 0ULL;
         if (CodePage == CodePage_ISO_8859_1) {
-            while (Decoded[Character] != TextIO_NULLTerminator) {
-                size_t NormOffset = UTF32_ShouldCodePointBeNormalized(NormalizationForm_KompatibleCompose, Decoded[Character]);
-                if (NormOffset > -1) {
-                    NumCodeUnits += UTF32_GetCodePointSizeInUTF8CodeUnits(Decoded[Character]);
-                }
-                Character        += 1;
+            UTF32   *Decoded          = UTF16_Decode(String);
+            size_t   NumCodePoints    = UTF32_GetNumCodePoints(Decoded);
+            size_t   NumCodeUnits     = 0ULL;
+            size_t   CodeUnit         = 0ULL;
+            for (size_t Character = 0ULL; Character < NumCodePoints; Character++) {
+                NumCodeUnits         += UTF32_GetCodePointSizeInUTF16CodeUnits(UTF32_Sanitize(Decoded[Character]));
             }
-            Unicode               = UTF16_Init(NumCodeUnits);
-            while (Decoded[Character] != TextIO_NULLTerminator && Unicode[CodePoint] != TextIO_NULLTerminator) {
-                for (uint8_t Byte = 0; Byte < UTF32_GetCodePointSizeInUTF16CodeUnits(Decoded[Character]); Byte++) {
-                    Unicode[CodePoint + Byte] = StringIO_PreallocateCodePoint_UTF16[Byte];
-                }
+            Unicode                   = UTF16_Init(NumCodeUnits);
+            for (size_t Character = 0ULL; Character < NumCodePoints; Character++) {
+                CodeUnit             += UTF16_WriteCodePoint((uint16_t *) &Unicode[CodeUnit], UTF32_Sanitize(Decoded[Character]));
             }
+            UTF32_Deinit(Decoded);
         }
 
         return Unicode;
@@ -3914,17 +5278,17 @@ CodePoint.CodeUnits[3] = String[3];
 
     void UTF8_Deinit(UTF8 *String) {
         AssertIO(String != NULL);
-        free(String[-sizeof(size_t)]);
+        StringIO_ReleaseString(String);
     }
 
     void UTF16_Deinit(UTF16 *String) {
         AssertIO(String != NULL);
-        free(String[-(sizeof(size_t) / sizeof(UTF16))]);
+        StringIO_ReleaseString(String);
     }
 
     void UTF32_Deinit(UTF32 *String) {
         AssertIO(String != NULL);
-        free(String[-(sizeof(size_t) / sizeof(UTF32))]);
+        StringIO_ReleaseString(String);
     }
 
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
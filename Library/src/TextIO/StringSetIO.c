@@ -1,7 +1,6 @@
 #include "../../include/TextIO/StringSetIO.h"          /* Included for our declarations */
 
 #include "../../include/AssertIO.h"                    /* Included for Assertions */
-#include "../../include/BufferIO.h"                    /* Included for BufferIO_MemorySet */
 #include "../../include/FileIO.h"                      /* Included for File operations */
 #include "../../include/MathIO.h"                      /* Included for endian swapping */
 #include "../../include/TextIO/StringIO.h"             /* Included for Encoding/Decoding functions */
@@ -10,63 +9,53 @@
 extern "C" {
 #endif
 
-    typedef enum StringSetConstants : uint16_t {
-        UTF8_Debug_Text_8       = 0x38,
-        UTF16_Debug_Text_16BE   = 0x3136,
-        UTF16_Debug_Text_16LE   = 0x3631,
-        UTF32_Debug_Text_32BE   = 0x3332,
-        UTF32_Debug_Text_32LE   = 0x3233,
-    } StringSetConstants;
-
     UTF8 **UTF8_StringSet_Init(size_t NumStrings) {
         AssertIO(NumStrings > 0);
 
         UTF8 **StringSet = NULL;
         StringSet        = calloc(sizeof(size_t) + NumStrings + TextIO_NULLTerminatorSize, sizeof(UTF8*));
         AssertIO(StringSet != NULL);
+        uint8_t *Prefix  = (uint8_t *) StringSet;
 
         static_assert(sizeof(size_t) == 4 || sizeof(size_t) == 8, "size_t is not 4 or 8 bytes!");
         if (sizeof(size_t) == 4) {
             uint8_t Unpacked[4];
             UnpackInteger32To8(NumStrings, Unpacked);
 #if   (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsBE)
-            StringSet[0][0] = Unpacked[3];
-            StringSet[0][1] = Unpacked[2];
-            StringSet[0][2] = Unpacked[1];
-            StringSet[0][3] = Unpacked[0];
+            Prefix[0] = Unpacked[3];
+            Prefix[1] = Unpacked[2];
+            Prefix[2] = Unpacked[1];
+            Prefix[3] = Unpacked[0];
 #elif (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsLE)
-            StringSet[0][0] = Unpacked[0];
-            StringSet[0][1] = Unpacked[1];
-            StringSet[0][2] = Unpacked[2];
-            StringSet[0][3] = Unpacked[3];
+            Prefix[0] = Unpacked[0];
+            Prefix[1] = Unpacked[1];
+            Prefix[2] = Unpacked[2];
+            Prefix[3] = Unpacked[3];
 #endif
         } else if (sizeof(size_t) == 8) {
             uint8_t Unpacked[8];
             UnpackInteger64To8(NumStrings, Unpacked);
 #if   (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsBE)
-            StringSet[0][0] = Unpacked[7];
-            StringSet[0][1] = Unpacked[6];
-            StringSet[0][2] = Unpacked[5];
-            StringSet[0][3] = Unpacked[4];
-            StringSet[0][4] = Unpacked[3];
-            StringSet[0][5] = Unpacked[2];
-            StringSet[0][6] = Unpacked[1];
-            StringSet[0][7] = Unpacked[0];
+            Prefix[0] = Unpacked[7];
+            Prefix[1] = Unpacked[6];
+            Prefix[2] = Unpacked[5];
+            Prefix[3] = Unpacked[4];
+            Prefix[4] = Unpacked[3];
+            Prefix[5] = Unpacked[2];
+            Prefix[6] = Unpacked[1];
+            Prefix[7] = Unpacked[0];
 #elif (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsLE)
-            StringSet[0][0] = Unpacked[0];
-            StringSet[0][1] = Unpacked[1];
-            StringSet[0][2] = Unpacked[2];
-            StringSet[0][3] = Unpacked[3];
-            StringSet[0][4] = Unpacked[4];
-            StringSet[0][5] = Unpacked[5];
-            StringSet[0][6] = Unpacked[6];
-            StringSet[0][7] = Unpacked[7];
+            Prefix[0] = Unpacked[0];
+            Prefix[1] = Unpacked[1];
+            Prefix[2] = Unpacked[2];
+            Prefix[3] = Unpacked[3];
+            Prefix[4] = Unpacked[4];
+            Prefix[5] = Unpacked[5];
+            Prefix[6] = Unpacked[6];
+            Prefix[7] = Unpacked[7];
 #endif
         }
 
-#if   (PlatformIO_BuildType == PlatformIO_BuildTypeIsDebug)
-        BufferIO_MemorySet8(*StringSet, UTF8_Debug_Text_8, NumStrings + TextIO_NULLTerminatorSize);
-#endif
         return &StringSet[sizeof(size_t)];
     }
 
@@ -75,41 +64,35 @@ extern "C" {
         UTF16 **StringSet = NULL;
         StringSet         = (UTF16**) calloc((sizeof(size_t) / sizeof(UTF16)) + NumStrings + TextIO_NULLTerminatorSize, sizeof(UTF16*));
         AssertIO(StringSet != NULL);
+        uint16_t *Prefix  = (uint16_t *) StringSet;
 
         static_assert(sizeof(size_t) == 4 || sizeof(size_t) == 8, "size_t is not 4 or 8 bytes!");
         if (sizeof(size_t) == 4) {
             uint16_t Unpacked[2];
             UnpackInteger32To16(NumStrings, Unpacked);
 #if   (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsBE)
-            StringSet[0][0] = Unpacked[1];
-            StringSet[0][1] = Unpacked[0];
+            Prefix[0] = Unpacked[1];
+            Prefix[1] = Unpacked[0];
 #elif (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsLE)
-            StringSet[0][0] = Unpacked[0];
-            StringSet[0][1] = Unpacked[1];
+            Prefix[0] = Unpacked[0];
+            Prefix[1] = Unpacked[1];
 #endif
         } else if (sizeof(size_t) == 8) {
             uint16_t Unpacked[4];
             UnpackInteger64To16(NumStrings, Unpacked);
 #if   (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsBE)
-            StringSet[0][0] = Unpacked[3];
-            StringSet[0][1] = Unpacked[2];
-            StringSet[0][2] = Unpacked[1];
-            StringSet[0][3] = Unpacked[0];
+            Prefix[0] = Unpacked[3];
+            Prefix[1] = Unpacked[2];
+            Prefix[2] = Unpacked[1];
+            Prefix[3] = Unpacked[0];
 #elif (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsLE)
-            StringSet[0][0] = Unpacked[0];
-            StringSet[0][1] = Unpacked[1];
-            StringSet[0][2] = Unpacked[2];
-            StringSet[0][3] = Unpacked[3];
+            Prefix[0] = Unpacked[0];
+            Prefix[1] = Unpacked[1];
+            Prefix[2] = Unpacked[2];
+            Prefix[3] = Unpacked[3];
 #endif
         }
 
-#if   (PlatformIO_BuildType == PlatformIO_BuildTypeIsDebug)
-#if   (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsBE)
-        BufferIO_MemorySet16(*StringSet, UTF16_Debug_Text_16BE, NumStrings + TextIO_NULLTerminatorSize);
-#elif (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsLE)
-        BufferIO_MemorySet16(*StringSet, UTF16_Debug_Text_16LE, NumStrings + TextIO_NULLTerminatorSize);
-#endif /* ByteOrder */
-#endif /* BuildType */
         return &StringSet[(sizeof(size_t) / sizeof(UTF16))];
     }
 
@@ -118,33 +101,27 @@ extern "C" {
         UTF32 **StringSet = NULL;
         StringSet     = (UTF32**) calloc((sizeof(size_t) / sizeof(UTF32)) + NumStrings + TextIO_NULLTerminatorSize, sizeof(UTF32*));
         AssertIO(StringSet != NULL);
+        uint32_t *Prefix  = (uint32_t *) StringSet;
 
         static_assert(sizeof(size_t) == 4 || sizeof(size_t) == 8, "size_t is not 4 or 8 bytes!");
         if (sizeof(size_t) == 4) {
 #if   (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsBE)
-            StringSet[0][0] = NumStrings;
+            Prefix[0] = NumStrings;
 #elif (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsLE)
-            StringSet[0][0] = NumStrings;
+            Prefix[0] = NumStrings;
 #endif
         } else if (sizeof(size_t) == 8) {
             uint32_t Unpacked[2];
             UnpackInteger64To32(NumStrings, Unpacked);
 #if   (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsBE)
-            StringSet[0][0] = Unpacked[1];
-            StringSet[0][1] = Unpacked[0];
+            Prefix[0] = Unpacked[1];
+            Prefix[1] = Unpacked[0];
 #elif (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsLE)
-            StringSet[0][0] = Unpacked[0];
-            StringSet[0][1] = Unpacked[1];
+            Prefix[0] = Unpacked[0];
+            Prefix[1] = Unpacked[1];
 #endif
         }
 
-#if   (PlatformIO_BuildType == PlatformIO_BuildTypeIsDebug)
-#if   (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsBE)
-        BufferIO_MemorySet32(*StringSet, UTF32_Debug_Text_32BE, NumStrings + TextIO_NULLTerminatorSize);
-#elif (PlatformIO_ByteOrder == PlatformIO_ByteOrderIsLE)
-        BufferIO_MemorySet32(*StringSet, UTF32_Debug_Text_32LE, NumStrings + TextIO_NULLTerminatorSize);
-#endif /* ByteOrder */
-#endif /* BuildType */
         return &StringSet[(sizeof(size_t) / sizeof(UTF32))];
     }
 
@@ -428,7 +405,7 @@ extern "C" {
             UTF8_Deinit(StringSet[String]);
             String += 1;
         }
-        free(StringSet[-sizeof(size_t)]);
+        free(&StringSet[-sizeof(size_t)]);
     }
 
     void UTF16_StringSet_Deinit(UTF16 **StringSet) {
@@ -439,7 +416,7 @@ extern "C" {
             UTF16_Deinit(StringSet[String]);
             String += 1;
         }
-        free(StringSet[-(sizeof(size_t) / sizeof(UTF16))]);
+        free(&StringSet[-(sizeof(size_t) / sizeof(UTF16))]);
     }
 
     void UTF32_StringSet_Deinit(UTF32 **StringSet) {
@@ -450,7 +427,7 @@ extern "C" {
             UTF32_Deinit(StringSet[String]);
             String += 1;
         }
-        free(StringSet[-(sizeof(size_t) / sizeof(UTF32))]);
+        free(&StringSet[-(sizeof(size_t) / sizeof(UTF32))]);
     }
 
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
@@ -1,8 +1,15 @@
-#include "../../../include/TestIO.h"            /* Included for testing */
-#include "../../../include/TextIO/StringIO.h"   /* Included for our declarations */
+#include "../../../include/TestIO.h"                /* Included for testing */
+#include "../../../include/TextIO/StringIO.h"       /* Included for our declarations */
 
-#include "../../../include/AssertIO.h"          /* Included for Assertions */
-#include "../../../include/CryptographyIO.h"    /* Included for testing */
+#include "../../../include/AssertIO.h"              /* Included for Assertions */
+#include "../../../include/CryptographyIO.h"        /* Included for testing */
+#include "../../../include/TextIO/LocalizationIO.h" /* Included for the arena caller test */
+#include "../../../include/TextIO/LogIO.h"          /* Included for the arena caller test */
+#include "../../../include/TextIO/StringSetIO.h"    /* Included for the arena caller test */
+
+#include <stdio.h>                                  /* Included for printf */
+#include <stdlib.h>                                 /* Included for calloc, free */
+#include <string.h>                                 /* Included for memcpy, memset, strlen */
 
 #if (PlatformIO_Language == PlatformIO_LanguageIsCXX)
 extern "C" {
@@ -181,11 +188,342 @@ extern "C" {
         return TestSuitePassed;
     }
     
+    /* Each case straddles the 16 and 32 code unit blocks at some offset, and the 64 code unit ASCII skip */
+    bool Test_UTF8_IsValid(InsecurePRNG *Insecure) {
+        AssertIO(Insecure != NULL);
+        bool TestPassed                  = Yes;
+        static const char *Valid[]       = {"", "Hello", "\xC2\x80", "\xDF\xBF", "\xE0\xA0\x80", "\xED\x9F\xBF", "\xEE\x80\x80", "\xEF\xBF\xBF", "\xF0\x90\x80\x80", "\xF0\x9F\x98\x80", "\xF4\x8F\xBF\xBF"};
+        static const char *Invalid[]     = {"\x80", "\xBF", "\xC0\xAF", "\xC1\xBF", "\xC2", "\xC2\x41", "\xE0\x80\xAF", "\xE0\x9F\xBF", "\xE2\x82", "\xED\xA0\x80", "\xED\xBF\xBF", "\xF0\x80\x80\xAF", "\xF0\x8F\xBF\xBF", "\xF0\x9F\x98", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xF8\x88\x80\x80\x80", "\xFF", "\xC2\x80\x80"};
+        char               Padded[160];
+        for (size_t Padding = 0; Padding < 100; Padding += 1 + (size_t) InsecurePRNG_CreateInteger(Insecure, 2)) {
+            memset(Padded, 'A', Padding);
+            for (size_t Case = 0; Case < sizeof(Valid) / sizeof(Valid[0]); Case++) {
+                size_t Size              = strlen(Valid[Case]);
+                memcpy(&Padded[Padding], Valid[Case], Size);
+                memset(&Padded[Padding + Size], 'z', 40);
+                TestPassed              &= UTF8_IsValidWithSize((const UTF8 *) Padded, Padding + Size) == Yes;
+                TestPassed              &= UTF8_IsValidWithSize((const UTF8 *) Padded, Padding + Size + 40) == Yes;
+            }
+            for (size_t Case = 0; Case < sizeof(Invalid) / sizeof(Invalid[0]); Case++) {
+                size_t Size              = strlen(Invalid[Case]);
+                memcpy(&Padded[Padding], Invalid[Case], Size);
+                memset(&Padded[Padding + Size], 'z', 40);
+                TestPassed              &= UTF8_IsValidWithSize((const UTF8 *) Padded, Padding + Size) == No;
+                TestPassed              &= UTF8_IsValidWithSize((const UTF8 *) Padded, Padding + Size + 40) == No;
+            }
+        }
+        TestPassed                      &= UTF8_IsValid(UTF8String("Grüße, 世界 🌍")) == Yes;
+        TestPassed                      &= UTF8_IsValidWithSize((const UTF8 *) "A\0B", 3) == Yes;
+        return TestPassed;
+    }
+
+    bool Test_UTF8_Convert(InsecurePRNG *Insecure) {
+        AssertIO(Insecure != NULL);
+        bool               TestPassed    = Yes;
+        static const UTF8  Source8[]     = "A\xC3\xBC\xE4\xB8\x96\xF0\x9F\x8C\x8D\xC0z"; // C0 is never valid
+        static const UTF16 Expected16[]  = {0x41, 0xFC, 0x4E16, 0xD83C, 0xDF0D, 0xFFFD, 0x7A, 0};
+        static const UTF16 Lone16[]      = {0x41, 0xDC00, 0xD800, 0};
+        UTF16              Buffer16[600];
+        UTF8               Buffer8[1800];
+        TestPassed                      &= UTF8_ConvertInto(Source8, NULL, 0) == 7;
+        TestPassed                      &= UTF8_ConvertInto(Source8, Buffer16, 7) == 7;
+        TestPassed                      &= UTF8_ConvertInto(Source8, Buffer16, 8) == 7 && memcmp(Buffer16, Expected16, sizeof(Expected16)) == 0;
+        TestPassed                      &= UTF16_ConvertInto(Lone16, Buffer8, sizeof(Buffer8)) == 7 && memcmp(Buffer8, "A\xEF\xBF\xBD\xEF\xBF\xBD", 8) == 0;
+        UTF16             *Converted16   = UTF8_Convert(Source8);
+        TestPassed                      &= memcmp(Converted16, Expected16, sizeof(Expected16)) == 0;
+        UTF16_Deinit(Converted16);
+        /* Random well formed UTF-16 has to survive the trip through UTF-8 unchanged, at every length around the SIMD block sizes */
+        for (size_t NumCodeUnits = 1; NumCodeUnits < 580; NumCodeUnits += 1 + (size_t) InsecurePRNG_CreateInteger(Insecure, 3)) {
+            size_t CodeUnit              = 0;
+            uint8_t Kind                 = (uint8_t) InsecurePRNG_CreateInteger(Insecure, 2);
+            while (CodeUnit < NumCodeUnits) {
+                UTF16 Value              = (UTF16) InsecurePRNG_CreateInteger(Insecure, Kind == 0 ? 7 : 16);
+                if (Value == TextIO_NULLTerminator) {
+                    continue;
+                } else if (Value >= UTF16HighSurrogateStart && Value <= UTF16LowSurrogateEnd) {
+                    if (CodeUnit + 1 == NumCodeUnits) {
+                        continue;
+                    }
+                    Buffer16[CodeUnit++] = (UTF16) (UTF16HighSurrogateStart + (Value & UTF16SurrogateMask));
+                    Value                = (UTF16) (UTF16LowSurrogateStart + (Value >> UTF16SurrogateShift));
+                }
+                Buffer16[CodeUnit++]     = Value;
+            }
+            Buffer16[NumCodeUnits]       = TextIO_NULLTerminator;
+            UTF8  *Converted8            = UTF16_Convert(Buffer16);
+            UTF16 *RoundTrip             = UTF8_Convert(Converted8);
+            TestPassed                  &= UTF8_IsValid(Converted8);
+            TestPassed                  &= memcmp(RoundTrip, Buffer16, (NumCodeUnits + 1) * sizeof(UTF16)) == 0;
+            TestPassed                  &= UTF16_ConvertInto(Buffer16, Buffer8, sizeof(Buffer8)) == strlen((const char *) Converted8);
+            UTF8_Deinit(Converted8);
+            UTF16_Deinit(RoundTrip);
+        }
+        return TestPassed;
+    }
+
+    /* Round trips through both encoders at lengths around the SIMD blocks; unencodable values have to come back as U+FFFD */
+    bool Test_UTF32_EncodeDecodeBlocks(InsecurePRNG *Insecure) {
+        AssertIO(Insecure != NULL);
+        bool TestPassed                  = Yes;
+        static const UTF32 Ranges[4][2]  = {{0x1, 0x7F}, {0x80, 0x7FF}, {0x800, 0xD7FF}, {0x10000, 0x10FFFF}};
+        for (size_t NumCodePoints = 1; NumCodePoints < 300; NumCodePoints += 1 + (size_t) InsecurePRNG_CreateInteger(Insecure, 3)) {
+            UTF32  *Original             = UTF32_Init(NumCodePoints);
+            UTF32  *Expected             = UTF32_Init(NumCodePoints);
+            uint8_t Widest               = (uint8_t) InsecurePRNG_CreateInteger(Insecure, 2);
+            for (size_t CodePoint = 0; CodePoint < NumCodePoints; CodePoint++) {
+                uint8_t Range            = (uint8_t) (InsecurePRNG_CreateInteger(Insecure, 8) % (Widest + 1));
+                UTF32   Span             = Ranges[Range][1] - Ranges[Range][0] + 1;
+                Original[CodePoint]      = Ranges[Range][0] + (UTF32) (InsecurePRNG_CreateInteger(Insecure, 24) % Span);
+                Expected[CodePoint]      = Original[CodePoint];
+                if (InsecurePRNG_CreateInteger(Insecure, 6) == 0) {
+                    Original[CodePoint]  = InsecurePRNG_CreateInteger(Insecure, 1) == 0 ? 0xDC00 : 0x110000;
+                    Expected[CodePoint]  = InvalidReplacementCodePoint;
+                }
+            }
+            Original[NumCodePoints]      = TextIO_NULLTerminator;
+            Expected[NumCodePoints]      = TextIO_NULLTerminator;
+            UTF8  *Encoded8              = UTF8_Encode(Original);
+            UTF16 *Encoded16             = UTF16_Encode(Original);
+            UTF32 *Decoded8              = UTF8_Decode(Encoded8);
+            UTF32 *Decoded16             = UTF16_Decode(Encoded16);
+            TestPassed                  &= UTF8_IsValid(Encoded8);
+            TestPassed                  &= memcmp(Decoded8, Expected, (NumCodePoints + 1) * sizeof(UTF32)) == 0;
+            TestPassed                  &= memcmp(Decoded16, Expected, (NumCodePoints + 1) * sizeof(UTF32)) == 0;
+            UTF8_Deinit(Encoded8);
+            UTF16_Deinit(Encoded16);
+            UTF32_Deinit(Decoded8);
+            UTF32_Deinit(Decoded16);
+            UTF32_Deinit(Original);
+            UTF32_Deinit(Expected);
+        }
+        return TestPassed;
+    }
+
+    /* Every Into variant reports the size it needs when Capacity is too small, and writes nothing past Capacity */
+    bool Test_StringIO_Into(InsecurePRNG *Insecure) {
+        AssertIO(Insecure != NULL);
+        bool               TestPassed    = Yes;
+        static const UTF32 Source32[]    = {0x41, 0xFC, 0x4E16, 0x1F30D, 0};
+        static const UTF8  Source8[]     = "A\xC3\xBC\xE4\xB8\x96\xF0\x9F\x8C\x8D";
+        UTF32              Buffer32[16];
+        UTF16              Buffer16[16];
+        UTF8               Buffer8[16];
+        memset(Buffer8, 0xAA, sizeof(Buffer8));
+        TestPassed                      &= UTF8_EncodeInto(Source32, Buffer8, 10) == 10 && Buffer8[0] == 0xAA;
+        TestPassed                      &= UTF8_EncodeInto(Source32, Buffer8, 11) == 10 && memcmp(Buffer8, Source8, sizeof(Source8)) == 0;
+        TestPassed                      &= UTF16_EncodeInto(Source32, NULL, 0) == 5;
+        TestPassed                      &= UTF16_EncodeInto(Source32, Buffer16, 6) == 5 && Buffer16[3] == 0xD83C && Buffer16[5] == TextIO_NULLTerminator;
+        TestPassed                      &= UTF8_DecodeInto(Source8, Buffer32, 4) == 4;
+        TestPassed                      &= UTF8_DecodeInto(Source8, Buffer32, 5) == 4 && memcmp(Buffer32, Source32, sizeof(Source32)) == 0;
+        TestPassed                      &= UTF16_DecodeInto(Buffer16, Buffer32, 5) == 4 && memcmp(Buffer32, Source32, sizeof(Source32)) == 0;
+        TestPassed                      &= UTF8_Integer2StringInto(Base_Integer | Base_Radix10, -1234, Buffer8, 5) == 5;
+        TestPassed                      &= UTF8_Integer2StringInto(Base_Integer | Base_Radix10, -1234, Buffer8, 6) == 5 && strcmp((const char *) Buffer8, "-1234") == 0;
+        TestPassed                      &= UTF16_Integer2StringInto(Base_Integer | Base_Radix16 | Base_Lowercase, 0xBEEF, Buffer16, 5) == 4 && Buffer16[0] == 0x62;
+        TestPassed                      &= UTF32_Integer2StringInto(Base_Integer | Base_Radix2, 5, Buffer32, 4) == 3 && Buffer32[0] == 0x31 && Buffer32[3] == TextIO_NULLTerminator;
+        /* The sizing pass and the writing pass have to agree for any input, including malformed input */
+        for (size_t Trial = 0; Trial < 256; Trial++) {
+            UTF8   Random[12];
+            for (size_t CodeUnit = 0; CodeUnit < sizeof(Random) - 1; CodeUnit++) {
+                Random[CodeUnit]         = (UTF8) (1 + InsecurePRNG_CreateInteger(Insecure, 8) % 255);
+            }
+            Random[sizeof(Random) - 1]   = TextIO_NULLTerminator;
+            size_t Needed                = UTF8_DecodeInto(Random, NULL, 0);
+            UTF32 *Decoded               = UTF8_Decode(Random);
+            TestPassed                  &= UTF32_GetStringSizeInCodePoints(Decoded) == Needed;
+            UTF32_Deinit(Decoded);
+        }
+        return TestPassed;
+    }
+
+    bool Test_TextIO_Arena(InsecurePRNG *Insecure) {
+        AssertIO(Insecure != NULL);
+        bool              TestPassed     = Yes;
+        TextIO_Arena     *Arena          = TextIO_Arena_Init(256);
+        TextIO_Arena     *Previous       = TextIO_Arena_SetDefault(Arena);
+        TestPassed                      &= TextIO_Arena_GetDefault() == Arena;
+        TextIO_ArenaMark  Mark           = TextIO_Arena_GetMark(Arena);
+        UTF8             *First          = UTF8_Init(8);
+        TestPassed                      &= First[8] == TextIO_NULLTerminator;
+        /* Integer2String's temporary and its result come from the arena too, Deinit leaves them be */
+        UTF8             *Integer        = UTF8_Integer2String(Base_Integer | Base_Radix10, -42);
+        TestPassed                      &= strcmp((const char *) Integer, "-42") == 0;
+        UTF8_Deinit(Integer);
+        /* Bigger than a block, so it gets a block of its own */
+        UTF16            *Large          = UTF16_Init(1024);
+        TestPassed                      &= Large[1024] == TextIO_NULLTerminator;
+        UTF16_Deinit(Large);
+        TextIO_Arena_ResetToMark(Arena, Mark);
+        TestPassed                      &= UTF8_Init(8) == First;
+        for (size_t Trial = 0; Trial < 64; Trial++) {
+            UTF8   Random[12];
+            for (size_t CodeUnit = 0; CodeUnit < sizeof(Random) - 1; CodeUnit++) {
+                Random[CodeUnit]         = (UTF8) (1 + InsecurePRNG_CreateInteger(Insecure, 8) % 255);
+            }
+            Random[sizeof(Random) - 1]   = TextIO_NULLTerminator;
+            TextIO_ArenaMark Batch       = TextIO_Arena_GetMark(Arena);
+            UTF32 *Decoded               = UTF8_Decode(Random);
+            TestPassed                  &= UTF32_GetStringSizeInCodePoints(Decoded) == UTF8_DecodeInto(Random, NULL, 0);
+            TextIO_Arena_ResetToMark(Arena, Batch);
+        }
+        TextIO_Arena_Reset(Arena);
+        TestPassed                      &= UTF8_Init(8) == First;
+        TestPassed                      &= TextIO_Arena_SetDefault(Previous) == Arena;
+        UTF8             *Heap           = UTF8_Init(4);
+        TestPassed                      &= Heap != First;
+        UTF8_Deinit(Heap);
+        TextIO_Arena_Deinit(Arena);
+        return TestPassed;
+    }
+
+    /* Log, LocalizationIO and StringSetIO release the strings they make through Deinit, once from the heap and once from an arena */
+    bool Test_TextIO_ArenaCallers(InsecurePRNG *Insecure) {
+        AssertIO(Insecure != NULL);
+        bool              TestPassed     = Yes;
+        TextIO_Arena     *Arena          = TextIO_Arena_Init(4096);
+        FILE             *LogFile        = tmpfile();
+        UTF8             *ProgramName    = UTF8_Init(4);
+        if (LogFile == NULL) {
+            return No;
+        }
+        memcpy(ProgramName, "Test", 4);
+        Log_SetProgramName(ProgramName);
+        Log_SetLogFile(LogFile);
+        for (uint8_t Pass = 0; Pass < 2; Pass++) {
+            TextIO_Arena    *Previous    = TextIO_Arena_SetDefault(Pass == 0 ? NULL : Arena);
+            TextIO_ArenaMark Start       = TextIO_Arena_GetMark(Arena);
+            Log(Severity_WARNING, UTF8String(__func__), UTF8String("Pass %u"), Pass);
+            UTF8  *Delocalized           = UTF8_DelocalizeInteger(Base_Integer | Base_Radix10, UTF8String("1,234"));
+            TestPassed                  &= Delocalized != NULL;
+            UTF8_Deinit(Delocalized);
+            UTF8 **StringSet             = UTF8_StringSet_Init(2);
+            TestPassed                  &= UTF8_StringSet_GetNumStrings((PlatformIO_Immutable(UTF8 **)) StringSet) == 2;
+            TestPassed                  &= UTF8_StringSet_Attach(StringSet, UTF8_Init(4), 0);
+            TestPassed                  &= UTF8_StringSet_Attach(StringSet, UTF8_Init(4), 1);
+            UTF8_StringSet_Deinit(StringSet);
+            TextIO_ArenaMark End         = TextIO_Arena_GetMark(Arena);
+            TestPassed                  &= (Start.Block != End.Block || Start.Offset != End.Offset) == (Pass == 1);
+            TextIO_Arena_SetDefault(Previous);
+            TextIO_Arena_Reset(Arena);
+        }
+        Log_Deinit();
+        TextIO_Arena_Deinit(Arena);
+        return TestPassed;
+    }
+
+    /* Reads every sequence length back out of a file; a sequence cut short by the end of the file reads as U+FFFD */
+    bool Test_ReadCodePoint(InsecurePRNG *Insecure) {
+        AssertIO(Insecure != NULL);
+        bool                  TestPassed = Yes;
+        static const uint8_t  Source8[]  = {0x41, 0xC3, 0xA9, 0xE2, 0x82, 0xAC, 0xF0, 0x9F, 0x98, 0x80, 0xE2, 0x82};
+        static const uint16_t Source16[] = {0x41, 0xD83D, 0xDE00, 0x20AC, 0xD83D};
+        static const UTF32    Expected[] = {0x41, 0xE9, 0x20AC, 0x1F600, InvalidReplacementCodePoint};
+        FILE                 *File8      = tmpfile();
+        FILE                 *File16     = tmpfile();
+        if (File8 == NULL || File16 == NULL) {
+            return No;
+        }
+        fwrite(Source8, sizeof(Source8[0]), sizeof(Source8) / sizeof(Source8[0]), File8);
+        fwrite(Source16, sizeof(Source16[0]), sizeof(Source16) / sizeof(Source16[0]), File16);
+        rewind(File8);
+        rewind(File16);
+        for (size_t CodePoint = 0; CodePoint < sizeof(Expected) / sizeof(Expected[0]); CodePoint++) {
+            TestPassed                  &= UTF8_ReadCodePoint(File8) == Expected[CodePoint];
+        }
+        TestPassed                      &= UTF16_ReadCodePoint(File16) == Expected[0];
+        TestPassed                      &= UTF16_ReadCodePoint(File16) == Expected[3];
+        TestPassed                      &= UTF16_ReadCodePoint(File16) == Expected[2];
+        TestPassed                      &= UTF16_ReadCodePoint(File16) == Expected[4];
+        fclose(File8);
+        fclose(File16);
+        /* ISO 8859-1 is a subset of Unicode, so converting it has to hand back the same string */
+        UTF8  *Converted8                = UTF8_ConvertCharSet2Unicode((CharSet8 *) "A\xC3\xA9\xE2\x82\xAC", CodePage_ISO_8859_1);
+        UTF16 *Converted16               = UTF16_ConvertCharSet2Unicode((CharSet16 *) UTF16String("A\u00E9\U0001F600"), CodePage_ISO_8859_1);
+        TestPassed                      &= strcmp((const char *) Converted8, "A\xC3\xA9\xE2\x82\xAC") == 0;
+        TestPassed                      &= Converted16[0] == 0x41 && Converted16[1] == 0xE9 && Converted16[2] == 0xD83D && Converted16[3] == 0xDE00 && Converted16[4] == TextIO_NULLTerminator;
+        UTF8_Deinit(Converted8);
+        UTF16_Deinit(Converted16);
+        return TestPassed;
+    }
+
+#define BenchmarkBufferSize   (4 * 1024 * 1024)
+#define BenchmarkNumPasses    8
+
+    /* UTF8_IsValid before the SIMD validator: only looks for code units that can never appear */
+    static bool Benchmark_UTF8_IsValidLegacy(const uint8_t *CodeUnits, size_t NumCodeUnits) {
+        bool IsValidUTF8                 = Yes;
+        for (size_t CodeUnit = 0; CodeUnit < NumCodeUnits; CodeUnit++) {
+            switch (CodeUnits[CodeUnit]) {
+                case 0xC0: case 0xC1: case 0xF5: case 0xF6: case 0xF7: case 0xF8:
+                case 0xF9: case 0xFA: case 0xFB: case 0xFC: case 0xFD: case 0xFE: case 0xFF:
+                    IsValidUTF8          = No;
+                    break;
+            }
+        }
+        return IsValidUTF8;
+    }
+
+    static double Benchmark_GetGigabytesPerSecond(uint64_t NumBytes, uint64_t ElapsedNanoseconds) {
+        return ElapsedNanoseconds > 0 ? (double) NumBytes / (double) ElapsedNanoseconds : 0.0;
+    }
+
+    bool Benchmark_UTF8_IsValid(InsecurePRNG *Insecure) {
+        AssertIO(Insecure != NULL);
+        bool     TestPassed              = Yes;
+        uint8_t *Text                    = calloc(BenchmarkBufferSize + 4, sizeof(uint8_t));
+        static const char *Names[2]      = {"ASCII", "Mixed"};
+        for (uint8_t Kind = 0; Kind < 2; Kind++) {
+            size_t NumCodeUnits          = 0;
+            while (NumCodeUnits < BenchmarkBufferSize) {
+                uint32_t CodePoint       = 0x20 + (uint32_t) InsecurePRNG_CreateInteger(Insecure, 6);
+                uint8_t  Width           = Kind == 0 ? 0 : (uint8_t) InsecurePRNG_CreateInteger(Insecure, 2); // Mixed is a quarter each of 1 to 4 code unit sequences
+                if (Width == 1) {
+                    Text[NumCodeUnits++] = 0xC2 + (uint8_t) InsecurePRNG_CreateInteger(Insecure, 4);
+                } else if (Width == 2) {
+                    Text[NumCodeUnits++] = 0xE1 + (uint8_t) InsecurePRNG_CreateInteger(Insecure, 3);
+                    Text[NumCodeUnits++] = 0x80 + (uint8_t) InsecurePRNG_CreateInteger(Insecure, 5);
+                } else if (Width == 3) {
+                    Text[NumCodeUnits++] = 0xF1;
+                    Text[NumCodeUnits++] = 0x80 + (uint8_t) InsecurePRNG_CreateInteger(Insecure, 5);
+                    Text[NumCodeUnits++] = 0x80 + (uint8_t) InsecurePRNG_CreateInteger(Insecure, 5);
+                }
+                Text[NumCodeUnits++]     = Width == 0 ? (uint8_t) CodePoint : 0x80 + (uint8_t) InsecurePRNG_CreateInteger(Insecure, 5);
+            }
+            uint64_t LegacyTime          = 0ULL;
+            uint64_t EngineTime          = 0ULL;
+            for (uint8_t Pass = 0; Pass < BenchmarkNumPasses; Pass++) {
+                uint64_t Start           = GetTime_Elapsed();
+                TestPassed              &= Benchmark_UTF8_IsValidLegacy(Text, NumCodeUnits);
+                LegacyTime              += GetTime_Elapsed() - Start;
+                Start                    = GetTime_Elapsed();
+                TestPassed              &= UTF8_IsValidWithSize((const UTF8 *) Text, NumCodeUnits);
+                EngineTime              += GetTime_Elapsed() - Start;
+            }
+            uint64_t NumBytes            = (uint64_t) NumCodeUnits * BenchmarkNumPasses;
+            printf("UTF8_IsValid %s: Legacy %.2f GB/s, Engine %.2f GB/s (%.2fx)\n", Names[Kind],
+                   Benchmark_GetGigabytesPerSecond(NumBytes, LegacyTime),
+                   Benchmark_GetGigabytesPerSecond(NumBytes, EngineTime),
+                   EngineTime > 0 ? (double) LegacyTime / (double) EngineTime : 0.0);
+        }
+        free(Text);
+        return TestPassed;
+    }
+
+#undef BenchmarkBufferSize
+#undef BenchmarkNumPasses
+
     int main(const int argc, const char *argv[]) {
         bool TestSuitePassed      = No;
         InsecurePRNG *Insecure    = InsecurePRNG_Init(0);
         //TestSuitePassed           = Test_StringSet(Insecure);
         TestSuitePassed           = Test_UTF8_Graphemes(Insecure);
+        TestSuitePassed          &= Test_UTF8_IsValid(Insecure);
+        TestSuitePassed          &= Benchmark_UTF8_IsValid(Insecure);
+        TestSuitePassed          &= Test_UTF8_Convert(Insecure);
+        TestSuitePassed          &= Test_UTF32_EncodeDecodeBlocks(Insecure);
+        TestSuitePassed          &= Test_ReadCodePoint(Insecure);
+        TestSuitePassed          &= Test_StringIO_Into(Insecure);
+        TestSuitePassed          &= Test_TextIO_Arena(Insecure);
+        TestSuitePassed          &= Test_TextIO_ArenaCallers(Insecure);
         //TestSuitePassed           = Test_UTF8_StringSet(Insecure);
         //TestSuitePassed           = Test_UTF16_EncodeDecode(Insecure);
         return TestSuitePassed;